@@ -0,0 +1,21 @@
+/// @example for_each_prime.cpp
+/// This example shows how to use a function object with
+/// for_each_prime(), its operator() is inlined.
+
+#include <primesieve.hpp>
+#include <stdint.h>
+#include <iostream>
+
+struct SumPrimes
+{
+  SumPrimes() : sum(0) { }
+  void operator()(uint64_t prime) { sum += prime; }
+  uint64_t sum;
+};
+
+int main()
+{
+  SumPrimes sp = primesieve::for_each_prime(2, 1000, SumPrimes());
+  std::cout << "Sum of the primes below 1000 = " << sp.sum << std::endl;
+  return 0;
+}
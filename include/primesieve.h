@@ -71,6 +71,17 @@ enum {
  */
 void* primesieve_generate_primes(uint64_t start, uint64_t stop, size_t* size, int type);
 
+/** Get an array with the primes inside the interval [start, stop]
+ *  using multiple threads, the array is allocated only once with
+ *  the exact number of primes. By default all CPU cores are used,
+ *  use primesieve_set_num_threads(int) to change the number of
+ *  threads.
+ *  @param size  The size of the returned primes array.
+ *  @param type  The type of the primes to generate, e.g. INT_PRIMES.
+ *  @pre stop <= 2^64 - 2^32 * 10.
+ */
+void* primesieve_parallel_generate_primes(uint64_t start, uint64_t stop, size_t* size, int type);
+
 /** Get an array with the first n primes >= start.
  *  @param type  The type of the primes to generate, e.g. INT_PRIMES.
  *  @pre stop <= 2^64 - 2^32 * 10.
@@ -95,6 +106,20 @@ uint64_t primesieve_nth_prime(int64_t n, uint64_t start);
  */
 uint64_t primesieve_parallel_nth_prime(int64_t n, uint64_t start);
 
+/** Find the n[i]th prime for each i < size and store it in
+ *  primes[i]. The primes are found in a single ascending sweep
+ *  instead of restarting the sieve for each rank.
+ *  @return 1 if success, 0 if error.
+ */
+int primesieve_nth_primes(const uint64_t* n, uint64_t* primes, size_t size);
+
+/** Find the n[i]th prime for each i < size in parallel.
+ *  By default all CPU cores are used, use
+ *  primesieve_set_num_threads(int) to change the number of threads.
+ *  @return 1 if success, 0 if error.
+ */
+int primesieve_parallel_nth_primes(const uint64_t* n, uint64_t* primes, size_t size);
+
 /** Count the primes within the interval [start, stop].
  *  @pre stop <= 2^64 - 2^32 * 10.
  */
@@ -179,6 +204,22 @@ uint64_t primesieve_parallel_count_sextuplets(uint64_t start, uint64_t stop);
  */
 uint64_t primesieve_parallel_count_septuplets(uint64_t start, uint64_t stop);
 
+/** Count the primes within [starts[i], stops[i]] for each
+ *  i < size and store the count in counts[i]. Nearby intervals
+ *  are merged and sieved only once.
+ *  @pre stops[i] <= 2^64 - 2^32 * 10.
+ *  @return 1 if success, 0 if error.
+ */
+int primesieve_count_primes_batch(const uint64_t* starts, const uint64_t* stops, uint64_t* counts, size_t size);
+
+/** Count the primes within [starts[i], stops[i]] for each
+ *  i < size in parallel. By default all CPU cores are used, use
+ *  primesieve_set_num_threads(int) to change the number of threads.
+ *  @pre stops[i] <= 2^64 - 2^32 * 10.
+ *  @return 1 if success, 0 if error.
+ */
+int primesieve_parallel_count_primes_batch(const uint64_t* starts, const uint64_t* stops, uint64_t* counts, size_t size);
+
 /** Print the primes within the interval [start, stop]
  *  to the standard output.
  *  @pre stop <= 2^64 - 2^32 * 10.
@@ -237,6 +278,18 @@ void primesieve_callback_primes(uint64_t start, uint64_t stop, void (*callback)(
  */
 void primesieve_parallel_callback_primes(uint64_t start, uint64_t stop, void (*callback)(uint64_t prime, int thread_id));
 
+/** Call back the primes within the interval [start, stop] in
+ *  parallel together with their ranks: primes[i] is the
+ *  (rank + i)th prime, e.g. the rank of 2 is 1. This function is
+ *  not synchronized, multiple threads call back chunks of primes
+ *  in parallel. By default all CPU cores are used, use
+ *  primesieve_set_num_threads(int) to change the number of threads.
+ *  @warning         Chunks are not called back in arithmetic order.
+ *  @param callback  A callback function.
+ *  @pre   stop      <= 2^64 - 2^32 * 10.
+ */
+void primesieve_parallel_callback_ranks(uint64_t start, uint64_t stop, void (*callback)(const uint64_t* primes, size_t size, uint64_t rank));
+
 /** Get the current set sieve size in kilobytes. */
 int primesieve_get_sieve_size();
 
@@ -245,11 +298,39 @@ int primesieve_get_sieve_size();
  */
 int primesieve_get_num_threads();
 
+/** Get the number of threads used by default (MAX_THREADS),
+ *  this is the number of CPU cores the current process is
+ *  allowed to use, it takes into account the CPU affinity mask
+ *  and the cgroup CPU quota (Linux containers).
+ */
+int primesieve_get_available_threads();
+
+/** Returns 1 if NUMA-aware thread placement is enabled, else 0. */
+int primesieve_is_numa();
+
+/** Returns 1 if huge pages are enabled, else 0. */
+int primesieve_is_huge_pages();
+
 /** Returns the largest valid stop number for primesieve.
  *  @return (2^64-1) - (2^32-1) * 10.
  */
 uint64_t primesieve_get_max_stop();
 
+/** Returns the maximum number of results kept in
+ *  the result cache, 0 if the cache is disabled.
+ */
+int primesieve_get_cache_size();
+
+/** Returns the number of count and nth prime function
+ *  calls answered from the result cache.
+ */
+uint64_t primesieve_get_cache_hits();
+
+/** Returns the number of count and nth prime function
+ *  calls not found in the result cache.
+ */
+uint64_t primesieve_get_cache_misses();
+
 /** Set the sieve size in kilobytes.
  *  The best sieving performance is achieved with a sieve size of
  *  your CPU's L1 data cache size (per core). For sieving >= 10^17 a
@@ -264,10 +345,58 @@ void primesieve_set_sieve_size(int sieve_size);
  *  primesieve_parallel_* function calls. Note that this only
  *  changes the number of threads for the current process.
  *  @param num_threads  Number of threads for sieving
- *                      or MAX_THREADS to use all CPU cores.
+ *                      or MAX_THREADS to use all available
+ *                      CPU cores, see primesieve_get_available_threads().
+ *                      An explicit number of threads may exceed
+ *                      primesieve_get_available_threads().
  */
 void primesieve_set_num_threads(int num_threads);
 
+/** Enable (1) or disable (0) NUMA-aware thread placement for use
+ *  in subsequent primesieve_parallel_* function calls. If enabled
+ *  the threads are spread across the NUMA nodes and pinned to
+ *  their node so that each thread's sieve array and buckets are
+ *  allocated from node-local memory. Disabled by default, has
+ *  no effect on non-NUMA systems.
+ */
+void primesieve_set_numa(int enable);
+
+/** Enable (1) or disable (0) 2 megabyte huge pages for
+ *  primesieve's large arrays (sieve array, pre-sieved array and
+ *  buckets). Reduces TLB misses when sieving near 2^64 using big
+ *  sieving primes. Explicit huge pages are used if available,
+ *  else transparent huge pages. Disabled by default, has no
+ *  effect on systems other than Linux.
+ */
+void primesieve_set_huge_pages(int enable);
+
+/** Use custom functions for allocating and deallocating
+ *  primesieve's large arrays, NULL restores the built-in
+ *  allocators. Takes precedence over primesieve_set_huge_pages().
+ *  @warning Must not be called while primesieve is sieving.
+ */
+void primesieve_set_allocator(void* (*allocate)(size_t), void (*deallocate)(void*));
+
+/** Store the prime and prime k-tuplet counts of aligned blocks
+ *  of 30 * 2^19 numbers in a memory-mapped index file. The
+ *  index is filled while counting, subsequent count functions
+ *  add up the counts of the indexed blocks and sieve only the
+ *  remaining parts of [start, stop]. The file may be shared by
+ *  multiple processes, NULL closes the index (POSIX only).
+ *  @warning Must not be called while primesieve is sieving.
+ *  @return 1 if success, else 0 and errno is set to EDOM.
+ */
+int primesieve_set_count_index(const char* filename);
+
+/** Set the maximum number of results of the count and nth prime
+ *  functions kept in the in-process LRU result cache, repeated
+ *  calls with the same arguments are then answered without
+ *  sieving. The cache is shared by all threads, 0 disables the
+ *  cache. Default: 1024. The cache requires OpenMP, if
+ *  primesieve is built without OpenMP it is always disabled.
+ */
+void primesieve_set_cache_size(int size);
+
 /** Deallocate a primes array created using the
  *  primesieve_generate_primes() or primesieve_generate_n_primes()
  *  functions.
@@ -25,9 +25,11 @@
 #include "primesieve/cancel_callback.hpp"
 #include "primesieve/iterator.hpp"
 #include "primesieve/PushBackPrimes.hpp"
+#include "primesieve/ForEachPrime.hpp"
 #include "primesieve/primesieve_error.hpp"
 
 #include <stdint.h>
+#include <cstddef>
 #include <vector>
 
 /// All of primesieve's C++ functions and classes are declared
@@ -110,7 +112,25 @@ namespace primesieve
   ///
   uint64_t parallel_nth_prime(int64_t n, uint64_t start = 0);
 
-  /// Count the primes within the interval [start, stop].
+  /// Find the n[i]th prime for each i, primes[i] = nth_prime(n[i]).
+  /// The ranks are sorted and the primes are found in a single
+  /// ascending sweep instead of restarting the sieve for each rank.
+  /// @pre   n[i] <= pi(2^64 - 2^32 * 11).
+  ///
+  void nth_primes(const std::vector<uint64_t>& n, std::vector<uint64_t>* primes);
+
+  /// Find the n[i]th prime for each i in parallel.
+  /// By default all CPU cores are used, use
+  /// primesieve::set_num_threads(int) to change the number of
+  /// threads.
+  /// @pre   n[i] <= pi(2^64 - 2^32 * 11).
+  ///
+  void parallel_nth_primes(const std::vector<uint64_t>& n, std::vector<uint64_t>* primes);
+
+  /// Count the primes within the interval [start, stop]. Large
+  /// intervals are counted using an embedded table of pi(k * 2^32)
+  /// checkpoints below 2^43 or the Lagarias-Miller-Odlyzko
+  /// algorithm in O(stop^(2/3)) operations instead of sieving.
   /// @pre stop <= 2^64 - 2^32 * 10.
   ///
   uint64_t count_primes(uint64_t start, uint64_t stop);
@@ -201,6 +221,26 @@ namespace primesieve
   ///
   uint64_t parallel_count_septuplets(uint64_t start, uint64_t stop);
 
+  /// Count the primes within [starts[i], stops[i]] for each i,
+  /// counts[i] = count_primes(starts[i], stops[i]). The intervals
+  /// are sorted and nearby intervals are merged so that the sieve
+  /// sweeps each region only once and reuses its sieving primes.
+  /// @pre stops[i] <= 2^64 - 2^32 * 10.
+  ///
+  void count_primes(const std::vector<uint64_t>& starts,
+                    const std::vector<uint64_t>& stops,
+                    std::vector<uint64_t>* counts);
+
+  /// Count the primes within [starts[i], stops[i]] for each i in
+  /// parallel. By default all CPU cores are used, use
+  /// primesieve::set_num_threads(int) to change the number of
+  /// threads.
+  /// @pre stops[i] <= 2^64 - 2^32 * 10.
+  ///
+  void parallel_count_primes(const std::vector<uint64_t>& starts,
+                             const std::vector<uint64_t>& stops,
+                             std::vector<uint64_t>* counts);
+
   /// Print the primes within the interval [start, stop]
   /// to the standard output.
   /// @pre stop <= 2^64 - 2^32 * 10.
@@ -299,6 +339,119 @@ namespace primesieve
   ///
   void parallel_callback_primes(uint64_t start, uint64_t stop, primesieve::Callback<uint64_t, int>* callback);
 
+  /// Call back the primes within the interval [start, stop].
+  /// The primes are passed in chunks (in ascending order) to
+  /// the callback method of the callback object.
+  /// @param callback  An object derived from primesieve::SegmentCallback.
+  /// @pre   stop <= 2^64 - 2^32 * 10.
+  ///
+  void callback_primes(uint64_t start, uint64_t stop, primesieve::SegmentCallback* callback);
+
+  /// Call back the primes within the interval [start, stop].
+  /// This function is synchronized, only one thread at a time calls
+  /// back a chunk of primes. By default all CPU cores are used, use
+  /// primesieve::set_num_threads(int) to change the number of
+  /// threads.
+  /// @warning         Chunks are not called back in arithmetic order.
+  /// @param callback  An object derived from primesieve::SegmentCallback.
+  /// @pre   stop      <= 2^64 - 2^32 * 10.
+  ///
+  void parallel_callback_primes(uint64_t start, uint64_t stop, primesieve::SegmentCallback* callback);
+
+  /// Call back the primes within the interval [start, stop] in
+  /// parallel together with their ranks: primes[i] is the
+  /// (rank + i)th prime, e.g. the rank of 2 is 1. The ranks are
+  /// computed from pi(start - 1) and the prime counts of the
+  /// chunks, which are counted in a first pass. This function is
+  /// not synchronized, multiple threads call back chunks of primes
+  /// in parallel. By default all CPU cores are used, use
+  /// primesieve::set_num_threads(int) to change the number of
+  /// threads.
+  /// @warning         Chunks are not called back in arithmetic order.
+  /// @param callback  An object derived from primesieve::RankCallback.
+  /// @pre   stop      <= 2^64 - 2^32 * 10.
+  ///
+  void parallel_callback_primes(uint64_t start, uint64_t stop, primesieve::RankCallback* callback);
+
+  /// Call f(prime) for each prime within the interval [start, stop]
+  /// (in ascending order). Unlike callback_primes() there is no
+  /// indirect function call per prime, f's operator() is inlined.
+  /// @param f  A function object (or a C++11 lambda).
+  /// @return   f, like std::for_each().
+  /// @pre      stop <= 2^64 - 2^32 * 10.
+  ///
+  template <typename F>
+  inline F for_each_prime(uint64_t start, uint64_t stop, F f)
+  {
+    ForEachPrime<F> forEach(f);
+    callback_primes(start, stop, &forEach);
+    return f;
+  }
+
+  /// Call f(prime) for each prime within the interval [start, stop].
+  /// This function is synchronized, only one thread at a time calls
+  /// f. By default all CPU cores are used, use
+  /// primesieve::set_num_threads(int) to change the number of
+  /// threads.
+  /// @warning  Primes are not called back in arithmetic order.
+  /// @param f  A function object (or a C++11 lambda).
+  /// @return   f, like std::for_each().
+  /// @pre      stop <= 2^64 - 2^32 * 10.
+  ///
+  template <typename F>
+  inline F parallel_for_each_prime(uint64_t start, uint64_t stop, F f)
+  {
+    ForEachPrime<F> forEach(f);
+    parallel_callback_primes(start, stop, &forEach);
+    return f;
+  }
+
+  /// Store the primes within the interval [start, stop] using
+  /// multiple threads. First the primes are counted, then
+  /// slices->resize(count) is called once and the threads
+  /// concurrently store the primes of their chunks into disjoint
+  /// slices. By default all CPU cores are used, use
+  /// primesieve::set_num_threads(int) to change the number of
+  /// threads.
+  /// @param slices  An object derived from primesieve::PrimeSlices.
+  /// @pre   stop    <= 2^64 - 2^32 * 10.
+  ///
+  void parallel_store_primes(uint64_t start, uint64_t stop, primesieve::PrimeSlices* slices);
+
+  /// Store the primes <= stop in the primes vector using multiple
+  /// threads, the vector is resized only once to the exact number
+  /// of primes. By default all CPU cores are used, use
+  /// primesieve::set_num_threads(int) to change the number of
+  /// threads.
+  /// @pre stop <= 2^64 - 2^32 * 10.
+  ///
+  template <typename T>
+  inline void parallel_generate_primes(uint64_t stop, std::vector<T>* primes)
+  {
+    if (primes)
+    {
+      ParallelPushBackPrimes<T> pb(*primes);
+      parallel_store_primes(0, stop, &pb);
+    }
+  }
+
+  /// Store the primes within the interval [start, stop] in the
+  /// primes vector using multiple threads, the vector is resized
+  /// only once to the exact number of primes. By default all CPU
+  /// cores are used, use primesieve::set_num_threads(int) to
+  /// change the number of threads.
+  /// @pre stop <= 2^64 - 2^32 * 10.
+  ///
+  template <typename T>
+  inline void parallel_generate_primes(uint64_t start, uint64_t stop, std::vector<T>* primes)
+  {
+    if (primes)
+    {
+      ParallelPushBackPrimes<T> pb(*primes);
+      parallel_store_primes(start, stop, &pb);
+    }
+  }
+
   /// Get the current set sieve size in kilobytes.
   int get_sieve_size();
 
@@ -307,11 +460,39 @@ namespace primesieve
   ///
   int get_num_threads();
 
+  /// Get the number of threads used by default (MAX_THREADS),
+  /// this is the number of CPU cores the current process is
+  /// allowed to use, it takes into account the CPU affinity mask
+  /// and the cgroup CPU quota (Linux containers).
+  ///
+  int get_available_threads();
+
+  /// Returns true if NUMA-aware thread placement is enabled.
+  bool is_numa();
+
+  /// Returns true if huge pages are enabled.
+  bool is_huge_pages();
+
   /// Returns the largest valid stop number for primesieve.
   /// @return (2^64-1) - (2^32-1) * 10.
   ///
   uint64_t get_max_stop();
 
+  /// Returns the maximum number of results kept in
+  /// the result cache, 0 if the cache is disabled.
+  ///
+  int get_cache_size();
+
+  /// Returns the number of count and nth prime function
+  /// calls answered from the result cache.
+  ///
+  uint64_t get_cache_hits();
+
+  /// Returns the number of count and nth prime function
+  /// calls not found in the result cache.
+  ///
+  uint64_t get_cache_misses();
+
   /// Set the sieve size in kilobytes.
   /// The best sieving performance is achieved with a sieve size of
   /// your CPU's L1 data cache size (per core). For sieving >= 10^17 a
@@ -326,10 +507,58 @@ namespace primesieve
   /// primesieve::parallel_* function calls. Note that this only
   /// changes the number of threads for the current process.
   /// @param num_threads  Number of threads for sieving
-  ///                     or MAX_THREADS to use all CPU cores.
+  ///                     or MAX_THREADS to use all available
+  ///                     CPU cores, see get_available_threads().
+  ///                     An explicit number of threads may exceed
+  ///                     get_available_threads().
   ///
   void set_num_threads(int num_threads);
 
+  /// Enable or disable NUMA-aware thread placement for use in
+  /// subsequent primesieve::parallel_* function calls. If enabled
+  /// the threads are spread across the NUMA nodes and pinned to
+  /// their node so that each thread's sieve array and buckets are
+  /// allocated from node-local memory. Disabled by default, has
+  /// no effect on non-NUMA systems.
+  ///
+  void set_numa(bool enable);
+
+  /// Enable or disable 2 megabyte huge pages for primesieve's
+  /// large arrays (sieve array, pre-sieved array and buckets).
+  /// Reduces TLB misses when sieving near 2^64 using big sieving
+  /// primes. Explicit huge pages are used if available, else
+  /// transparent huge pages. Disabled by default, has no effect
+  /// on systems other than Linux.
+  ///
+  void set_huge_pages(bool enable);
+
+  /// Use custom functions for allocating and deallocating
+  /// primesieve's large arrays, NULL restores the built-in
+  /// allocators. Takes precedence over set_huge_pages().
+  /// @warning Must not be called while primesieve is sieving.
+  ///
+  void set_allocator(void* (*allocate)(std::size_t), void (*deallocate)(void*));
+
+  /// Store the prime and prime k-tuplet counts of aligned blocks
+  /// of 30 * 2^19 numbers in a memory-mapped index file. The
+  /// index is filled while counting, subsequent count functions
+  /// add up the counts of the indexed blocks and sieve only the
+  /// remaining parts of [start, stop]. The file may be shared by
+  /// multiple processes, NULL closes the index (POSIX only).
+  /// @warning Must not be called while primesieve is sieving.
+  /// @throw primesieve_error if the file cannot be opened.
+  ///
+  void set_count_index(const char* filename);
+
+  /// Set the maximum number of results of the count and nth prime
+  /// functions kept in the in-process LRU result cache, repeated
+  /// calls with the same arguments are then answered without
+  /// sieving. The cache is shared by all threads, 0 disables the
+  /// cache. Default: 1024. The cache requires OpenMP, if
+  /// primesieve is built without OpenMP it is always disabled.
+  ///
+  void set_cache_size(int size);
+
   /// Run extensive correctness tests.
   /// The tests last about one minute on a quad core CPU from
   /// 2013 and use up to 1 gigabyte of memory.
@@ -0,0 +1,94 @@
+///
+/// @file   Allocator.hpp
+/// @brief  Memory allocators for primesieve's large arrays: the
+///         sieve array, the pre-sieved array, the sieving primes
+///         of EratSmall and EratMedium and the buckets of EratBig.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef ALLOCATOR_PRIMESIEVE_HPP
+#define ALLOCATOR_PRIMESIEVE_HPP
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <new>
+
+namespace primesieve {
+
+/// Abstract memory allocator. Objects that allocate memory keep
+/// a reference to the allocator returned by Allocator::get() at
+/// construction, the memory is deallocated using that same
+/// allocator.
+///
+class Allocator
+{
+public:
+  virtual ~Allocator() { }
+  virtual void* allocate(std::size_t size) = 0;
+  virtual void deallocate(void* ptr, std::size_t size) = 0;
+  /// Get the allocator for new memory allocations, this is
+  /// the user's allocator if set, else the huge page allocator
+  /// if enabled, else the default allocator (operator new).
+  ///
+  static Allocator& get();
+  /// Use the functions allocate and deallocate for subsequent
+  /// memory allocations, NULL restores the built-in allocators.
+  ///
+  static void setFunctions(void* (*allocate)(std::size_t), void (*deallocate)(void*));
+  static void setHugePages(bool enable);
+  static bool isHugePages();
+};
+
+/// STL allocator that forwards to an Allocator,
+/// used for the sieving primes of EratSmall and EratMedium.
+///
+template <typename T>
+class StlAllocator
+{
+public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template <typename U>
+  struct rebind { typedef StlAllocator<U> other; };
+
+  StlAllocator() : allocator_(&Allocator::get()) { }
+  template <typename U>
+  StlAllocator(const StlAllocator<U>& other) : allocator_(other.getAllocator()) { }
+
+  Allocator* getAllocator() const { return allocator_; }
+  pointer address(reference x) const { return &x; }
+  const_pointer address(const_reference x) const { return &x; }
+  size_type max_size() const { return static_cast<size_type>(-1) / sizeof(T); }
+  void construct(pointer p, const T& value) { new (p) T(value); }
+  void destroy(pointer p) { p->~T(); }
+
+  pointer allocate(size_type n, const void* = 0)
+  {
+    return static_cast<pointer>(allocator_->allocate(n * sizeof(T)));
+  }
+  void deallocate(pointer p, size_type n)
+  {
+    allocator_->deallocate(p, n * sizeof(T));
+  }
+  template <typename U>
+  bool operator==(const StlAllocator<U>& other) const { return allocator_ == other.getAllocator(); }
+  template <typename U>
+  bool operator!=(const StlAllocator<U>& other) const { return allocator_ != other.getAllocator(); }
+private:
+  Allocator* allocator_;
+};
+
+} // namespace primesieve
+
+#endif
@@ -12,6 +12,7 @@
 #define CALLBACK_PRIMESIEVE_HPP
 
 #include <stdint.h>
+#include <cstddef>
 
 namespace primesieve {
 
@@ -42,6 +43,44 @@ public:
   virtual ~Callback() { }
 };
 
+/// Segment callback interface class. Objects derived from this
+/// class are called back once per chunk of (up to a few thousand)
+/// primes instead of once per prime, the primes are in ascending
+/// order. @see ForEachPrime.hpp
+///
+class SegmentCallback
+{
+public:
+  virtual void callback(const uint64_t* primes, std::size_t size) = 0;
+  virtual ~SegmentCallback() { }
+};
+
+/// Rank callback interface class. Like SegmentCallback but the
+/// callback method also gets the rank of the first prime of the
+/// chunk, i.e. primes[i] is the (rank + i)th prime.
+/// @see primesieve::parallel_callback_primes()
+///
+class RankCallback
+{
+public:
+  virtual void callback(const uint64_t* primes, std::size_t size, uint64_t rank) = 0;
+  virtual ~RankCallback() { }
+};
+
+/// Output interface class of ParallelPrimeSieve::storePrimes().
+/// resize() is called once with the exact number of primes, then
+/// multiple threads concurrently store() the primes of their
+/// chunk into the disjoint slice [pos, pos + size).
+/// @see PushBackPrimes.hpp
+///
+class PrimeSlices
+{
+public:
+  virtual void resize(std::size_t size) = 0;
+  virtual void store(std::size_t pos, const uint64_t* primes, std::size_t size) = 0;
+  virtual ~PrimeSlices() { }
+};
+
 } // namespace primesieve
 
 #endif
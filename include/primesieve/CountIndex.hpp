@@ -0,0 +1,86 @@
+///
+/// @file   CountIndex.hpp
+/// @brief  Persistent, memory-mapped index of the prime and prime
+///         k-tuplet counts of aligned blocks, reused by subsequent
+///         count queries.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef COUNTINDEX_HPP
+#define COUNTINDEX_HPP
+
+#include "config.hpp"
+
+#include <stdint.h>
+#include <cstddef>
+#include <string>
+
+namespace primesieve {
+
+/// CountIndex stores the counts of primes, twins, ..., septuplets
+/// of each block of 30 * 2^19 numbers (2^19 sieve bytes) in a
+/// memory-mapped file. Block b contains the numbers within
+/// [b * 30 * 2^19 + 7, (b + 1) * 30 * 2^19 + 6], prime k-tuplets
+/// never cross block boundaries as they never cross the sieve's
+/// byte boundaries. The index is filled as a side effect of
+/// PrimeFinder::count() and used by PrimeSieve::sieve() to sieve
+/// only the parts of [start, stop] that are not in the index.
+/// The file may be shared by multiple processes.
+///
+class CountIndex
+{
+public:
+  enum
+  {
+    LOG2_BLOCK_BYTES = 19,
+    BLOCK_BYTES = 1 << LOG2_BLOCK_BYTES,
+    COUNTS = 7
+  };
+  /// Get the opened index, NULL if none.
+  static CountIndex* get();
+  /// Open (or create) the index file, NULL closes the index.
+  /// @warning Must not be called while primesieve is sieving.
+  ///
+  static void open(const char* filename);
+  /// @return false if memory-mapped files are
+  /// not supported on this system.
+  ///
+  static bool isSupported();
+  static uint64_t getBlockLow(uint64_t block);
+  static uint64_t getBlockHigh(uint64_t block);
+  /// Map the entire index file which may have been enlarged
+  /// by other processes.
+  /// @return Number of blocks within the index file.
+  ///
+  uint64_t getBlocks();
+  /// Get the counts of the block,
+  /// @param countFlags  Bit i set: counts[i] is needed.
+  /// @return true if all needed counts are in the index.
+  ///
+  bool find(uint64_t block, int countFlags, uint64_t* counts);
+  /// Add the counts of a fully sieved block to the index.
+  void store(uint64_t block, int countFlags, const uint64_t* counts);
+private:
+  /// Counts of a block + 1, 0 = unknown
+  struct Entry
+  {
+    uint32_t counts[8];
+  };
+  std::string filename_;
+  int fd_;
+  Entry* entries_;
+  std::size_t size_;
+  CountIndex(const char*);
+  ~CountIndex();
+  bool map(uint64_t block, bool grow);
+  void unmap();
+  DISALLOW_COPY_AND_ASSIGN(CountIndex);
+};
+
+} // namespace primesieve
+
+#endif
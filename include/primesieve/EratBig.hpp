@@ -12,8 +12,11 @@
 
 #include "config.hpp"
 #include "WheelFactorization.hpp"
+#include "Allocator.hpp"
 
 #include <stdint.h>
+#include <cassert>
+#include <cstddef>
 #include <vector>
 
 namespace primesieve {
@@ -22,9 +25,9 @@ namespace primesieve {
 /// Eratosthenes optimized for big sieving primes that have very few
 /// multiples per segment.
 ///
-class EratBig: public Modulo210Wheel_t {
+class EratBig: public Modulo210Wheel<EratBig>::type {
 public:
-  EratBig(uint64_t, uint_t, uint_t);
+  EratBig(uint64_t, uint64_t, uint_t, uint_t);
   ~EratBig();
   void crossOff(byte_t*);
 private:
@@ -32,20 +35,110 @@ private:
   /// log2 of SieveOfEratosthenes::sieveSize_
   const uint_t log2SieveSize_;
   const uint_t moduloSieveSize_;
-  /// Vector of bucket lists, holds the sieving primes
+  /// Sieving primes whose next multiple is less than
+  /// nearSegments_ segments ahead are stored in lists_
+  uint_t nearSegments_;
+  /// log2 of the number of segments per block
+  uint_t log2BlockSize_;
+  uint_t moduloBlockSize_;
+  /// Position of the current segment within the current block
+  uint_t segment_;
+  /// Index of the current block within farLists_
+  uint_t block_;
+  /// false if the next multiple of each sieving prime is
+  /// less than nearSegments_ segments ahead (or > stop)
+  bool farStore_;
+  /// One bucket list per segment, lists_[segment_] holds the
+  /// sieving primes that have multiple(s) in the current segment
   std::vector<Bucket*> lists_;
+  /// One bucket list per future block (ring buffer), holds the
+  /// sieving primes whose next multiple is too far ahead
+  std::vector<Bucket*> farLists_;
   /// List of empty buckets
   Bucket* stock_;
-  /// Pointers of the allocated buckets
-  std::vector<Bucket*> pointers_;
-  void init(uint_t);
+  /// Allocator of the buckets
+  Allocator& allocator_;
+  /// Size in bytes of the next bucket allocation
+  std::size_t allocSize_;
+  /// Memory chunk of buckets
+  struct Memory
+  {
+    Bucket* buckets;
+    std::size_t size;
+    Allocator* allocator;
+    /// NUMA node of the thread that allocated the chunk
+    int node;
+  };
+  /// Chunks allocated (or recycled) by this EratBig object
+  std::vector<Memory> memory_;
+  /// Chunks of destroyed EratBig objects, recycled by new
+  /// EratBig objects on the same NUMA node (shared by all
+  /// threads). Only used while a BucketPool object exists.
+  ///
+  static std::vector<Memory> pool_;
+  static std::size_t poolSize_;
+  /// Number of existing BucketPool objects
+  static int poolUsers_;
+  friend class BucketPool;
+  static void openPool();
+  static void closePool();
+  void init(uint64_t, uint64_t, uint_t);
+  void allocateBuckets();
+  void release();
+  static bool recycle(Memory&);
   static void moveBucket(Bucket&, Bucket*&);
-  void pushBucket(uint_t);
+  void pushBucket(Bucket*&);
+  void store(uint_t, uint_t, uint_t);
+  void storeFar(uint_t, uint_t, uint_t);
   void storeSievingPrime(uint_t, uint_t, uint_t);
+  friend class WheelFactorization<EratBig, 210, 48, wheel210Init, wheel210>;
+  void nextBlock();
+  template <bool FAR_LISTS>
   void crossOff(byte_t*, SievingPrime*, SievingPrime*);
   DISALLOW_COPY_AND_ASSIGN(EratBig);
 };
 
+/// While a BucketPool object exists the bucket memory of
+/// destroyed EratBig objects is kept for reuse by new EratBig
+/// objects, this avoids repeated page faults if many small
+/// intervals are sieved. When the last BucketPool object is
+/// destroyed the pooled memory is deallocated.
+///
+class BucketPool
+{
+public:
+  BucketPool() { EratBig::openPool(); }
+  ~BucketPool() { EratBig::closePool(); }
+private:
+  DISALLOW_COPY_AND_ASSIGN(BucketPool);
+};
+
+/// Add a new sieving prime to EratBig
+inline void EratBig::storeSievingPrime(uint_t prime, uint_t multipleIndex, uint_t wheelIndex)
+{
+  assert(prime <= limit_);
+  uint_t sievingPrime = prime / NUMBERS_PER_BYTE;
+  store(sievingPrime, multipleIndex, wheelIndex);
+}
+
+/// Move a sieving prime to the bucket list related to its next
+/// multiple, multipleIndex is relative to the current segment.
+///
+inline void EratBig::store(uint_t sievingPrime, uint_t multipleIndex, uint_t wheelIndex)
+{
+  uint_t segment = multipleIndex >> log2SieveSize_;
+
+  if (segment >= nearSegments_)
+    storeFar(sievingPrime, multipleIndex, wheelIndex);
+  else
+  {
+    segment += segment_;
+    multipleIndex &= moduloSieveSize_;
+    if (!lists_[segment]->store(sievingPrime, multipleIndex, wheelIndex))
+      pushBucket(lists_[segment]);
+  }
+}
+
 } // namespace primesieve
 
 #endif
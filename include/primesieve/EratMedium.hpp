@@ -12,9 +12,11 @@
 
 #include "config.hpp"
 #include "WheelFactorization.hpp"
+#include "Allocator.hpp"
 
 #include <stdint.h>
-#include <list>
+#include <cassert>
+#include <vector>
 
 namespace primesieve {
 
@@ -22,21 +24,32 @@ namespace primesieve {
 /// Eratosthenes optimized for medium sieving primes that have a few
 /// multiples per segment.
 ///
-class EratMedium : public Modulo210Wheel_t {
+class EratMedium : public Modulo210Wheel<EratMedium>::type {
 public:
   EratMedium(uint64_t, uint_t, uint_t);
   uint_t getLimit() const { return limit_; }
   void crossOff(byte_t*, uint_t);
 private:
-  typedef std::list<Bucket>::iterator BucketIterator_t;
+  typedef std::vector<SievingPrime, StlAllocator<SievingPrime> > SievingPrimes_t;
   const uint_t limit_;
-  /// List of buckets, holds the sieving primes
-  std::list<Bucket> buckets_;
+  /// Contiguous array of sieving primes
+  SievingPrimes_t sievingPrimes_;
   void storeSievingPrime(uint_t, uint_t, uint_t);
-  static void crossOff(byte_t*, uint_t, Bucket&);
+  friend class WheelFactorization<EratMedium, 210, 48, wheel210Init, wheel210>;
+  static void crossOff(byte_t*, uint_t, SievingPrime*, SievingPrime*);
   DISALLOW_COPY_AND_ASSIGN(EratMedium);
 };
 
+/// Add a new sieving prime to EratMedium
+inline void EratMedium::storeSievingPrime(uint_t prime, uint_t multipleIndex, uint_t wheelIndex)
+{
+  assert(prime <= limit_);
+  uint_t sievingPrime = prime / NUMBERS_PER_BYTE;
+  SievingPrime sPrime;
+  sPrime.set(sievingPrime, multipleIndex, wheelIndex);
+  sievingPrimes_.push_back(sPrime);
+}
+
 } // namespace primesieve
 
 #endif
@@ -12,9 +12,11 @@
 
 #include "config.hpp"
 #include "WheelFactorization.hpp"
+#include "Allocator.hpp"
 
 #include <stdint.h>
-#include <list>
+#include <cassert>
+#include <vector>
 
 namespace primesieve {
 
@@ -22,21 +24,58 @@ namespace primesieve {
 /// Eratosthenes optimized for small sieving primes that have many
 /// multiples per segment.
 ///
-class EratSmall : public Modulo30Wheel_t {
+class EratSmall : public Modulo30Wheel<EratSmall>::type {
 public:
   EratSmall(uint64_t, uint_t, uint_t);
   uint_t getLimit() const { return limit_; }
   void crossOff(byte_t*, byte_t*);
 private:
-  typedef std::list<Bucket>::iterator BucketIterator_t;
+  typedef std::vector<SievingPrime, StlAllocator<SievingPrime> > SievingPrimes_t;
+  /// Sieving prime whose multiples are removed using a
+  /// pattern of prime + PATTERN_PADDING sieve bytes
+  struct Pattern
+  {
+    uint_t prime;
+    /// Position of the pattern within patternBytes_
+    uint_t offset;
+    /// The pattern byte of sieve[0] is pattern[index]
+    uint_t index;
+    /// Byte of the first multiple, 0 after the first segment
+    uint_t start;
+  };
+  enum { PATTERN_PADDING = 64 };
+  typedef void (*AndPattern_t)(byte_t*, byte_t*, const byte_t*, uint_t, uint_t);
   const uint_t limit_;
-  /// List of buckets, holds the sieving primes
-  std::list<Bucket> buckets_;
+  /// Contiguous array of sieving primes
+  SievingPrimes_t sievingPrimes_;
+  /// Sieving primes < ERATSMALL_PATTERN_LIMIT
+  std::vector<Pattern> patterns_;
+  std::vector<byte_t> patternBytes_;
+  /// Fastest pattern kernel supported by the CPU, NULL if none
+  AndPattern_t andPattern_;
   void storeSievingPrime(uint_t, uint_t, uint_t);
-  static void crossOff(byte_t*, byte_t*, Bucket&);
+  friend class WheelFactorization<EratSmall, 30, 8, wheel30Init, wheel30>;
+  void addPattern(uint_t, uint_t, uint_t);
+  void crossOffPatterns(byte_t*, byte_t*);
+  static void crossOff(byte_t*, byte_t*, SievingPrime*, SievingPrime*);
   DISALLOW_COPY_AND_ASSIGN(EratSmall);
 };
 
+/// Add a new sieving prime to EratSmall
+inline void EratSmall::storeSievingPrime(uint_t prime, uint_t multipleIndex, uint_t wheelIndex)
+{
+  assert(prime <= limit_);
+  if (andPattern_ && prime < config::ERATSMALL_PATTERN_LIMIT)
+  {
+    addPattern(prime, multipleIndex, wheelIndex);
+    return;
+  }
+  uint_t sievingPrime = prime / NUMBERS_PER_BYTE;
+  SievingPrime sPrime;
+  sPrime.set(sievingPrime, multipleIndex, wheelIndex);
+  sievingPrimes_.push_back(sPrime);
+}
+
 } // namespace primesieve
 
 #endif
@@ -0,0 +1,44 @@
+///
+/// @file   ForEachPrime.hpp
+/// @brief  ForEachPrime derives from SegmentCallback and calls a
+///         function object for each prime. The loop over the primes
+///         of a chunk is instantiated in the user's code, hence the
+///         function object's operator() can be inlined.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef FOREACHPRIME_HPP
+#define FOREACHPRIME_HPP
+
+#include "Callback.hpp"
+
+#include <stdint.h>
+#include <cstddef>
+
+namespace primesieve {
+
+template <typename F>
+class ForEachPrime : public SegmentCallback
+{
+public:
+  ForEachPrime(F& f)
+    : f_(f)
+  { }
+  void callback(const uint64_t* primes, std::size_t size)
+  {
+    for (std::size_t i = 0; i < size; i++)
+      f_(primes[i]);
+  }
+private:
+  ForEachPrime(const ForEachPrime&);
+  void operator=(const ForEachPrime&);
+  F& f_;
+};
+
+} // namespace primesieve
+
+#endif
@@ -14,6 +14,7 @@
 
 #include "PrimeSieve.hpp"
 #include <stdint.h>
+#include <vector>
 
 namespace primesieve {
 
@@ -41,24 +42,57 @@ public:
   virtual ~ParallelPrimeSieve() { }
   void init(SharedMemory&);
   static int getMaxThreads();
+  static int getAvailableThreads();
   int getNumThreads() const;
   void setNumThreads(int numThreads);
+  bool isNuma() const;
+  void setNuma(bool numa);
   using PrimeSieve::sieve;
   virtual void sieve();
+  using PrimeSieve::callbackPrimes;
+  void callbackPrimes(uint64_t, uint64_t, uint64_t, RankCallback*);
+  void storePrimes(uint64_t, uint64_t, PrimeSlices*);
 private:
   enum { IDEAL_NUM_THREADS = -1 };
   void* lock_;
   SharedMemory* shm_;
   int numThreads_;
+  /// Pin threads round-robin to the NUMA nodes
+  bool numa_;
+  /// Contiguous interval [start, stop] sieved by one thread
+  /// using a single PrimeSieve object. Other threads may steal
+  /// the end of the interval i.e. (reserved, stop].
+  struct Stripe
+  {
+    uint64_t start;
+    uint64_t stop;
+    /// Numbers <= reserved are (being) sieved by the owner
+    uint64_t reserved;
+    /// Numbers sieved by the owner in its previous stripes
+    uint64_t processed;
+    /// True until the owner starts sieving the stripe
+    bool isNew;
+  };
+  std::vector<Stripe> stripes_;
+  /// Smallest interval stolen from another thread
+  uint64_t minSteal_;
+  /// Wall time at the start of the parallel region
+  double startTime_;
   bool tooMany(int) const;
   int idealNumThreads() const;
-  uint64_t getThreadInterval(int) const;
+  void initStripes(int);
+  void newStripe(int, uint64_t, uint64_t);
+  double getThroughput(int, double) const;
+  bool nextStripe(int, uint64_t*, uint64_t*);
+  bool steal(int);
   uint64_t align(uint64_t) const;
+  int countChunks(uint64_t*, std::vector<uint64_t>*);
   template <typename T> T getLock() { return static_cast<T>(lock_); }
   virtual double getWallTime() const;
   virtual void setLock();
   virtual void unsetLock();
   virtual bool updateStatus(uint64_t, bool);
+  virtual uint64_t reserve(uint64_t, int);
 };
 
 } // namespace primesieve
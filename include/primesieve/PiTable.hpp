@@ -0,0 +1,65 @@
+///
+/// @file   PiTable.hpp
+/// @brief  Embedded table of prime counts pi(k * 2^32), used by
+///         count_primes() and nthPrime() to sieve only the
+///         distance to the nearest checkpoint.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef PITABLE_HPP
+#define PITABLE_HPP
+
+#include <stdint.h>
+
+namespace primesieve {
+
+class PrimeSieve;
+
+/// PiTable contains the prime counts pi(k * 2^32) for
+/// k = 0 to 2^11 i.e. checkpoints up to 2^43 (about 8.8 * 10^12).
+/// pi(x) for any x is calculated by sieving the interval between
+/// x and its nearest checkpoint (at most 2^31 numbers below 2^43).
+///
+class PiTable
+{
+public:
+  enum
+  {
+    LOG2_SPACING = 32,
+    MAX_INDEX    = 1 << 11
+  };
+  /// Largest checkpoint i.e. 2^43
+  static uint64_t getMaxX();
+  /// Get the checkpoint nearest to x
+  static uint64_t getCheckpoint(uint64_t x);
+  /// Number of integers that must be sieved to
+  /// calculate pi(x) from its nearest checkpoint.
+  ///
+  static uint64_t getDistance(uint64_t x);
+  /// @return pi(checkpoint).
+  /// @pre checkpoint is a multiple of 2^32 <= getMaxX().
+  ///
+  static uint64_t pi(uint64_t checkpoint);
+  /// Count the primes <= x using the nearest checkpoint,
+  /// the remaining distance is sieved using ps.
+  ///
+  static uint64_t pi(uint64_t x, PrimeSieve& ps);
+  /// Count the primes within [start, stop] using pi(stop) -
+  /// pi(start - 1) from the nearest checkpoints.
+  ///
+  static uint64_t countPrimes(uint64_t start, uint64_t stop, PrimeSieve& ps);
+  /// Returns true if countPrimes(start, stop, ps) is faster
+  /// than both sieving [start, stop] and pi_lmo().
+  ///
+  static bool isFaster(uint64_t start, uint64_t stop);
+  /// Get the largest checkpoint with pi(checkpoint) < n.
+  static uint64_t findCheckpoint(uint64_t n);
+};
+
+} // namespace primesieve
+
+#endif
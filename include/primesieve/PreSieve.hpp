@@ -15,6 +15,8 @@
 
 namespace primesieve {
 
+class Allocator;
+
 /// @brief  Pre-sieve multiples of small primes to speed up the sieve
 ///         of Eratosthenes.
 ///
@@ -47,6 +49,7 @@ private:
   /// Pre-sieve multiples of primes <= limit_ (>= 11 && <= 23)
   uint_t limit_;
   uint_t primeProduct_;
+  Allocator& allocator_;
   byte_t* preSieved_;
   uint_t size_;
   void init();
@@ -0,0 +1,102 @@
+///
+/// @file   PrimeBitmap.hpp
+/// @brief  Succinct bitmap of the primes within [start, stop] with a
+///         rank/select index, answers is prime, prime count, next
+///         prime and nth prime queries without sieving.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef PRIMEBITMAP_HPP
+#define PRIMEBITMAP_HPP
+
+#include <stdint.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace primesieve {
+
+/// PrimeBitmap sieves [start, stop] once (in parallel) and keeps
+/// the sieve bytes i.e. 8 bits per 30 numbers, about 33 megabytes
+/// per 10^9 numbers. A rank index that holds the prime count
+/// before each block of 512 bits (12.5% extra) is built on top, so
+/// that isPrime() runs in O(1) and countPrimes(), nthPrime(),
+/// nextPrime() and prevPrime() run in O(1) resp. O(log n).
+/// A PrimeBitmap can be saved to a file, other processes can then
+/// open the file (memory-mapped, read-only) instead of sieving.
+///
+class PrimeBitmap
+{
+  friend class PrimeFinder;
+public:
+  /// Sieve the primes within [start, stop] into a new bitmap.
+  /// @pre stop <= 2^64 - 2^32 * 10
+  ///
+  PrimeBitmap(uint64_t start, uint64_t stop);
+  /// Open a bitmap file created using save().
+  explicit PrimeBitmap(const std::string& filename);
+  ~PrimeBitmap();
+  /// Save the bitmap (and its index) to a file.
+  void save(const std::string& filename) const;
+  uint64_t getStart() const;
+  uint64_t getStop() const;
+  /// @pre start <= n <= stop
+  bool isPrime(uint64_t n) const;
+  /// Count the primes within [start, n].
+  uint64_t countPrimes(uint64_t n) const;
+  /// Count the primes within [start, stop].
+  uint64_t getPrimeCount() const;
+  /// Find the nth prime >= start.
+  /// @pre 1 <= n <= getPrimeCount()
+  ///
+  uint64_t nthPrime(uint64_t n) const;
+  /// Find the smallest prime >= n.
+  /// @return 0 if there is no such prime <= stop.
+  ///
+  uint64_t nextPrime(uint64_t n) const;
+  /// Find the largest prime <= n.
+  /// @return 0 if there is no such prime >= start.
+  ///
+  uint64_t prevPrime(uint64_t n) const;
+private:
+  uint64_t start_;
+  uint64_t stop_;
+  /// Sieve byte of bits_[0], multiple of 8
+  uint64_t firstByte_;
+  /// Size of bits_ in 64-bit words
+  uint64_t words_;
+  /// Primes 2, 3 and 5 within [start, stop]
+  uint64_t smallPrimes_;
+  /// Header, bitmap and rank index, unless memory-mapped
+  std::vector<uint64_t> image_;
+  /// Memory-mapped bitmap file, NULL if none
+  void* mapped_;
+  std::size_t mappedSize_;
+  /// image_ or mapped_
+  const uint64_t* data_;
+  /// Sieve bytes of [start, stop], bit i of byte b
+  /// corresponds to (firstByte_ + b) * 30 + bitValues_[i].
+  ///
+  const uint8_t* bits_;
+  /// ranks_[i] = number of 1 bits before bits_ word i * 8
+  const uint64_t* ranks_;
+  static const uint64_t bitValues_[8];
+  static uint64_t getFirstByte(uint64_t);
+  static uint64_t getLastByte(uint64_t);
+  void init(const uint64_t*);
+  void initRanks();
+  void store(uint64_t, const uint8_t*, std::size_t);
+  uint64_t getWord(uint64_t) const;
+  uint64_t rank(uint64_t) const;
+  uint64_t select(uint64_t) const;
+  PrimeBitmap(const PrimeBitmap&);
+  void operator=(const PrimeBitmap&);
+};
+
+} // namespace primesieve
+
+#endif
@@ -14,11 +14,13 @@
 #include "SieveOfEratosthenes.hpp"
 
 #include <stdint.h>
+#include <cstddef>
 #include <vector>
 
 namespace primesieve {
 
 class PrimeSieve;
+class CountIndex;
 
 /// PrimeFinder is a SieveOfEratosthenes class that is used to
 /// callback, print and count primes and prime k-tuplets
@@ -34,10 +36,27 @@ private:
   std::vector<uint_t> kCounts_[7];
   /// Reference to the associated PrimeSieve object
   PrimeSieve& ps_;
+  /// Persistent count index, NULL if disabled
+  CountIndex* countIndex_;
+  /// Bit i set: counts_[i] is stored in countIndex_
+  int countFlags_;
+  /// Counts of the current count index block
+  uint64_t blockCounts_[7];
+  /// Primes counted so far, for COUNT_CHECKPOINTS
+  uint64_t checkpointCount_;
+  /// Next checkpoint to be counted
+  std::size_t checkpoint_;
   void init_kCounts();
   virtual void segmentFinished(const byte_t*, uint_t);
+  void reserveNextSegment();
   void count(const byte_t*, uint_t);
+  void count(const byte_t*, uint_t, uint_t, uint64_t*) const;
+  void countBlocks(const byte_t*, uint_t);
+  void countCheckpoints(const byte_t*, uint_t);
+  void countHistogram(const byte_t*, uint_t);
+  void addHistogram(uint64_t, const uint64_t*);
   void print(const byte_t*, uint_t) const;
+  void storeBitmap(const byte_t*, uint_t) const;
   template <typename T> void callbackPrimes(T, const byte_t*, uint_t) const;
   template <typename T> void callbackPrimes(T, const byte_t*, uint_t, int) const;
   void callbackPrimes(const byte_t*, uint_t) const;
@@ -13,6 +13,8 @@
 #include "config.hpp"
 #include "SieveOfEratosthenes.hpp"
 
+#include <vector>
+
 namespace primesieve {
 
 class PrimeFinder;
@@ -23,6 +25,8 @@ public:
   void doIt();
 private:
   PrimeFinder& finder_;
+  /// Sieving primes of the current segment
+  std::vector<uint_t> primes_;
   void segmentFinished(const byte_t*, uint_t);
   void generateSievingPrimes(const byte_t*, uint_t);
   void generateTinyPrimes();
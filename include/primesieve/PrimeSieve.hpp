@@ -20,6 +20,8 @@
 
 namespace primesieve {
 
+class PrimeBitmap;
+
 /// PrimeSieve is a highly optimized C++ implementation of the
 /// segmented sieve of Eratosthenes that generates primes and prime
 /// k-tuplets (twin primes, prime triplets, ...) in order up to 2^64
@@ -62,12 +64,15 @@ public:
   int getFlags() const;
   double getStatus() const;
   double getSeconds() const;
+  uint64_t getHistogramStep() const;
+  const std::vector<uint64_t>& getHistogram(int) const;
   // Setters
   void setStart(uint64_t);
   void setStop(uint64_t);
   void setSieveSize(int);
   void setFlags(int);
   void addFlags(int);
+  void setHistogramStep(uint64_t);
   // Bool is*
   bool isFlag(int) const;
   bool isCallback() const;
@@ -84,8 +89,11 @@ public:
   void callbackPrimes(uint64_t, uint64_t, void (*)(uint64_t, int));
   void callbackPrimes(uint64_t, uint64_t, Callback<uint64_t>*);
   void callbackPrimes(uint64_t, uint64_t, Callback<uint64_t, int>*);
+  void callbackPrimes(uint64_t, uint64_t, SegmentCallback*);
   void callbackPrimes_c(uint64_t, uint64_t, void (*)(uint64_t));
   void callbackPrimes_c(uint64_t, uint64_t, void (*)(uint64_t, int));
+  // Bitmap
+  void sieveBitmap(uint64_t, uint64_t, PrimeBitmap*);
   // nth prime
   uint64_t nthPrime(uint64_t);
   uint64_t nthPrime(int64_t, uint64_t);
@@ -105,6 +113,7 @@ public:
   uint64_t countQuintuplets(uint64_t, uint64_t);
   uint64_t countSextuplets(uint64_t, uint64_t);
   uint64_t countSeptuplets(uint64_t, uint64_t);
+  void countPrimes(uint64_t, uint64_t, const std::vector<uint64_t>&, std::vector<uint64_t>*);
   // Count getters
   uint64_t getPrimeCount() const;
   uint64_t getTwinCount() const;
@@ -125,10 +134,14 @@ protected:
   double seconds_;
   uint64_t getInterval() const;
   void reset();
+  bool isHistogram() const;
+  void addHistogram(const PrimeSieve&);
+  bool countIndexed();
   virtual double getWallTime() const;
   virtual void setLock();
   virtual void unsetLock();
   virtual bool updateStatus(uint64_t, bool);
+  virtual uint64_t reserve(uint64_t, int);
 private:
   struct SmallPrime
   {
@@ -157,10 +170,29 @@ private:
   void (*callback_tn_)(uint64_t, int);
   Callback<uint64_t>* cb_;
   Callback<uint64_t, int>* cb_tn_;
+  SegmentCallback* cb_segment_;
+  /// Bitmap for use with sieveBitmap()
+  PrimeBitmap* bitmap_;
+  /// Width of the histogram buckets, 0 = disabled
+  uint64_t histogramStep_;
+  /// Lower bound of bucket 0, the start number of the
+  /// (parent ParallelPrimeSieve) object
+  ///
+  uint64_t histogramStart_;
+  /// Bucket number of histogram_[i][0]
+  uint64_t histogramFirst_;
+  /// Prime number and prime k-tuplet counts per bucket
+  std::vector<uint64_t> histogram_[7];
+  /// Checkpoints and their prime counts for use
+  /// with countPrimes(start, stop, checkpoints, counts)
+  ///
+  const std::vector<uint64_t>* checkpoints_;
+  std::vector<uint64_t>* checkpointCounts_;
   static void printStatus(double, double);
   bool isFlag(int, int) const;
   bool isValidFlags(int) const;
   bool isStatus() const;
+  uint64_t getBucket(uint64_t) const;
   bool isParallelPrimeSieveChild() const;
   void doSmallPrime(const SmallPrime&);
   enum
@@ -177,7 +209,10 @@ private:
     CALLBACK_PRIMES_OBJ    = 1 << 22,
     CALLBACK_PRIMES_OBJ_TN = 1 << 23,
     CALLBACK_PRIMES_C      = 1 << 24,
-    CALLBACK_PRIMES_C_TN   = 1 << 25
+    CALLBACK_PRIMES_C_TN   = 1 << 25,
+    CALLBACK_PRIMES_SEGMENT = 1 << 26,
+    STORE_BITMAP           = 1 << 27,
+    COUNT_CHECKPOINTS      = 1 << 28
   };
 };
 
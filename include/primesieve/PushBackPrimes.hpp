@@ -21,6 +21,7 @@
 
 #include <stdint.h>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
 namespace primesieve {
@@ -62,6 +63,35 @@ private:
   std::vector<T>& primes_;
 };
 
+/// Appends the primes to the vector using multiple threads, the
+/// vector is resized to the exact number of primes beforehand and
+/// each thread writes its primes into its own slice.
+///
+template <typename T>
+class ParallelPushBackPrimes : public PrimeSlices
+{
+public:
+  ParallelPushBackPrimes(std::vector<T>& primes)
+    : primes_(primes),
+      offset_(primes.size())
+  { }
+  void resize(std::size_t size)
+  {
+    primes_.resize(offset_ + size);
+  }
+  void store(std::size_t pos, const uint64_t* primes, std::size_t size)
+  {
+    T* slice = &primes_[offset_ + pos];
+    for (std::size_t i = 0; i < size; i++)
+      slice[i] = static_cast<T>(primes[i]);
+  }
+private:
+  ParallelPushBackPrimes(const ParallelPushBackPrimes&);
+  void operator=(const ParallelPushBackPrimes&);
+  std::vector<T>& primes_;
+  std::size_t offset_;
+};
+
 template <typename T>
 class PushBack_N_Primes : public Callback<uint64_t>
 {
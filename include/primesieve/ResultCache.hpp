@@ -0,0 +1,57 @@
+///
+/// @file   ResultCache.hpp
+/// @brief  Thread-safe, size-bounded LRU cache of the results of
+///         the count and nth prime API functions.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef RESULTCACHE_HPP
+#define RESULTCACHE_HPP
+
+#include <stdint.h>
+#include <cstddef>
+
+namespace primesieve {
+
+/// ResultCache maps (query, x, y) to the result of a count or nth
+/// prime API function e.g. (COUNT_TWINS, start, stop) -> count.
+/// The results neither depend on the sieve size nor on the number
+/// of threads, so count_primes() and parallel_count_primes()
+/// share their results. Once the cache is full the least recently
+/// used result is evicted. ResultCache requires OpenMP for
+/// locking, if primesieve is built without OpenMP the cache is
+/// disabled and setSize() has no effect.
+///
+class ResultCache
+{
+public:
+  enum Query
+  {
+    COUNT_PRIMES,
+    COUNT_TWINS,
+    COUNT_TRIPLETS,
+    COUNT_QUADRUPLETS,
+    COUNT_QUINTUPLETS,
+    COUNT_SEXTUPLETS,
+    COUNT_SEPTUPLETS,
+    NTH_PRIME
+  };
+  /// @return true if the result is in the cache.
+  static bool find(Query query, uint64_t x, uint64_t y, uint64_t* result);
+  static void insert(Query query, uint64_t x, uint64_t y, uint64_t result);
+  /// Set the maximum number of cached results, 0 disables the
+  /// cache and removes all cached results.
+  ///
+  static void setSize(std::size_t size);
+  static std::size_t getSize();
+  static uint64_t getHits();
+  static uint64_t getMisses();
+};
+
+} // namespace primesieve
+
+#endif
@@ -37,6 +37,11 @@ inline uint64_t SieveOfEratosthenes::getSegmentLow() const
   return segmentLow_;
 }
 
+inline uint64_t SieveOfEratosthenes::getSegmentHigh() const
+{
+  return segmentHigh_;
+}
+
 inline uint_t SieveOfEratosthenes::getSieveSize() const
 {
   return sieveSize_;
@@ -67,11 +72,17 @@ inline void SieveOfEratosthenes::addSievingPrime(uint_t prime)
   // This loop is executed once all primes <= sqrt(segmentHigh_)
   // required to sieve the next segment have been
   // added to the erat* objects further down.
-  while (segmentHigh_ < square) {
+  // stop_ may have been reduced by setStop(uint64_t).
+  while (segmentHigh_ < square && segmentHigh_ < stop_) {
     sieveSegment();
     segmentLow_  += sieveSize_ * NUMBERS_PER_BYTE;
     segmentHigh_ += sieveSize_ * NUMBERS_PER_BYTE;
   }
+  // primes > sqrt(stop_) are not needed, stop_ may have been
+  // reduced after the sieving primes up to sqrt(old stop)
+  // have been generated
+  if (segmentHigh_ >= stop_ && square > stop_)
+    return;
        if (prime > limitEratMedium_)   eratBig_->addSievingPrime(prime, segmentLow_);
   else if (prime > limitEratSmall_) eratMedium_->addSievingPrime(prime, segmentLow_);
   else /* (prime > limitPreSieve) */ eratSmall_->addSievingPrime(prime, segmentLow_);
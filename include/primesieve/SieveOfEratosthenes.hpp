@@ -13,6 +13,7 @@
 #include "config.hpp"
 
 #include <stdint.h>
+#include <cstddef>
 #include <string>
 
 namespace primesieve {
@@ -21,6 +22,7 @@ class PreSieve;
 class EratSmall;
 class EratMedium;
 class EratBig;
+class Allocator;
 
 /// @brief  The abstract SieveOfEratosthenes class sieves primes using
 ///         the segmented sieve of Eratosthenes.
@@ -40,6 +42,7 @@ public:
   uint_t getSieveSize() const;
   uint_t getPreSieve() const;
   void addSievingPrime(uint_t);
+  void addSievingPrimes(const uint_t*, std::size_t);
   void sieve();
 protected:
   SieveOfEratosthenes(uint64_t, uint64_t, uint_t);
@@ -47,6 +50,8 @@ protected:
   virtual void segmentFinished(const byte_t*, uint_t) = 0;
   static uint64_t getNextPrime(uint64_t*, uint64_t);
   uint64_t getSegmentLow() const;
+  uint64_t getSegmentHigh() const;
+  void setStop(uint64_t);
 private:
   static const uint_t bitValues_[8];
   static const uint_t bruijnBitValues_[64];
@@ -56,8 +61,8 @@ private:
   uint64_t segmentHigh_;
   /// Sieve primes >= start_
   const uint64_t start_;
-  /// Sieve primes <= stop_
-  const uint64_t stop_;
+  /// Sieve primes <= stop_, may be reduced while sieving
+  uint64_t stop_;
   /// sqrt(stop_)
   uint_t sqrtStop_;
   /// Copy of preSieve_->getLimit()
@@ -68,6 +73,8 @@ private:
   uint_t limitEratMedium_;
   /// Size of sieve_ in bytes (power of 2)
   uint_t sieveSize_;
+  /// Allocator of sieve_
+  Allocator& allocator_;
   /// Sieve of Eratosthenes array
   byte_t* sieve_;
   /// Pre-sieve multiples of tiny sieving primes
@@ -0,0 +1,57 @@
+///
+/// @file   SmallPrimeTable.hpp
+/// @brief  Embedded bitmap of the primes <= 2^20, used to answer
+///         small count_primes(), nth_prime() and iterator queries
+///         without sieving.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef SMALLPRIMETABLE_HPP
+#define SMALLPRIMETABLE_HPP
+
+#include <stdint.h>
+#include <vector>
+
+namespace primesieve {
+
+/// SmallPrimeTable contains a bitmap of the primes <= 2^20 using
+/// the sieve's mod 30 layout (35 kilobytes) and the prefix sums of
+/// its popcounts. Queries within the table need neither a
+/// PrimeSieve object nor any memory allocation: pi(x) is O(1)
+/// and nthPrime(n) is O(log n).
+///
+class SmallPrimeTable
+{
+public:
+  enum { LIMIT = 1 << 20 };
+  /// Count the primes <= x.
+  /// @pre x <= LIMIT
+  ///
+  static uint64_t pi(uint64_t x);
+  /// Count the primes within [start, stop].
+  /// @pre stop <= LIMIT
+  ///
+  static uint64_t countPrimes(uint64_t start, uint64_t stop);
+  /// @pre 1 <= n <= pi(LIMIT)
+  static uint64_t nthPrime(uint64_t n);
+  /// Find the nth prime, same as primesieve::nth_prime(n, start).
+  /// @return 0 if the nth prime is not within the table.
+  ///
+  static uint64_t nthPrime(int64_t n, uint64_t start);
+  /// Append the primes within [start, stop] to primes.
+  /// @pre stop <= LIMIT
+  ///
+  static void generatePrimes(uint64_t start, uint64_t stop, std::vector<uint64_t>* primes);
+  /// Append the primes within [start, stop] to primes, uses
+  /// generatePrimes() if stop <= LIMIT and sieves otherwise.
+  ///
+  static void storePrimes(uint64_t start, uint64_t stop, std::vector<uint64_t>* primes);
+};
+
+} // namespace primesieve
+
+#endif
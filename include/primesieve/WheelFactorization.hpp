@@ -61,6 +61,12 @@ extern const WheelElement wheel210[48*8];
 /// of its next multiple within the SieveOfEratosthenes array
 /// (i.e. multipleIndex) and a wheelIndex.
 ///
+/// Near 2^64 a SievingPrime needs 27 bits for sievingPrime (prime /
+/// 30), 9 bits for the wheelIndex (which also encodes prime % 30)
+/// and log2(sieveSize) bits for the multipleIndex i.e. > 48 bits,
+/// hence 8 bytes is the most compact encoding that can be decoded
+/// without extra instructions in EratBig::crossOff().
+///
 class SievingPrime {
 public:
   enum {
@@ -147,12 +153,14 @@ private:
   SievingPrime sievingPrimes_[config::BUCKETSIZE];
 };
 
-/// The abstract WheelFactorization class is used skip multiples of
-/// small primes in the sieve of Eratosthenes. The EratSmall,
-/// EratMedium and EratBig classes are derived from
-/// WheelFactorization.
+/// The WheelFactorization class is used skip multiples of small
+/// primes in the sieve of Eratosthenes. The EratSmall, EratMedium
+/// and EratBig classes are derived from WheelFactorization which
+/// uses the curiously recurring template pattern: T is the derived
+/// class, its storeSievingPrime() is resolved at compile time and
+/// inlined into addSievingPrimes().
 ///
-template <uint_t MODULO, uint_t SIZE, const WheelInit* INIT, const WheelElement* WHEEL>
+template <typename T, uint_t MODULO, uint_t SIZE, const WheelInit* INIT, const WheelElement* WHEEL>
 class WheelFactorization {
 public:
   /// Get the maximum upper bound for sieving
@@ -178,25 +186,26 @@ public:
     segmentLow += 6;
     // calculate the first multiple (of prime) > segmentLow
     uint64_t quotient = segmentLow / prime + 1;
-    uint64_t multiple = prime * quotient;
-    // prime not needed for sieving
-    if (multiple > stop_)
-      return;
-    uint64_t square = isquare<uint64_t>(prime);
-    if (multiple < square) {
-      quotient = prime;
-      multiple = square;
-    }
-    // calculate the next multiple of prime that is not
-    // divisible by any of the wheel's factors
-    uint64_t nextMultipleFactor = INIT[quotient % MODULO].nextMultipleFactor;
-    multiple += prime * nextMultipleFactor;
-    if (multiple > stop_)
-      return;
-    uint64_t lowOffset = multiple - segmentLow;
-    uint_t multipleIndex = static_cast<uint_t>(lowOffset / NUMBERS_PER_BYTE);
-    uint_t wheelIndex = wheelOffsets_[prime % NUMBERS_PER_BYTE] + INIT[quotient % MODULO].wheelIndex;
-    storeSievingPrime(prime, multipleIndex, wheelIndex);
+    initSievingPrime(prime, segmentLow, quotient);
+  }
+  /// @brief Add many sieving primes at once.
+  ///
+  /// Same as addSievingPrime(uint_t, uint64_t) for each prime but
+  /// uses a double precision division instead of a 64-bit integer
+  /// division for primes >= FAST_DIVIDE_MIN. Starting a sieve at a
+  /// high offset (e.g. > 10^15) requires adding millions of sieving
+  /// primes and is otherwise bound by the 64-bit divisions.
+  /// @pre primes are sorted in ascending order.
+  ///
+  void addSievingPrimes(const uint_t* primes, std::size_t size, uint64_t segmentLow)
+  {
+    segmentLow += 6;
+    double low = static_cast<double>(segmentLow);
+    std::size_t i = 0;
+    for (; i < size && primes[i] < FAST_DIVIDE_MIN; i++)
+      initSievingPrime(primes[i], segmentLow, segmentLow / primes[i] + 1);
+    for (; i < size; i++)
+      initSievingPrime(primes[i], segmentLow, fastDivide(segmentLow, low, primes[i]) + 1);
   }
 protected:
   /// @param stop       Upper bound for sieving.
@@ -211,8 +220,7 @@ protected:
     if (stop > getMaxStop())
       throw primesieve_error("WheelFactorization: stop must be <= " + getMaxStopString());
   }
-  virtual ~WheelFactorization() { }
-  virtual void storeSievingPrime(uint_t, uint_t, uint_t) = 0;
+  ~WheelFactorization() { }
   static uint_t getMaxFactor()
   {
     return WHEEL[0].nextMultipleFactor;
@@ -230,12 +238,39 @@ protected:
 private:
   static const uint_t wheelOffsets_[30];
   const uint64_t stop_;
+  /// Calculate the position of the first multiple > segmentLow of
+  /// prime and its wheel index and store the sieving prime.
+  /// @param segmentLow  segmentLow + 6.
+  /// @param quotient    segmentLow / prime + 1.
+  ///
+  void initSievingPrime(uint_t prime, uint64_t segmentLow, uint64_t quotient)
+  {
+    uint64_t multiple = prime * quotient;
+    // prime not needed for sieving
+    if (multiple > stop_)
+      return;
+    uint64_t square = isquare<uint64_t>(prime);
+    if (multiple < square) {
+      quotient = prime;
+      multiple = square;
+    }
+    // calculate the next multiple of prime that is not
+    // divisible by any of the wheel's factors
+    uint64_t nextMultipleFactor = INIT[quotient % MODULO].nextMultipleFactor;
+    multiple += prime * nextMultipleFactor;
+    if (multiple > stop_)
+      return;
+    uint64_t lowOffset = multiple - segmentLow;
+    uint_t multipleIndex = static_cast<uint_t>(lowOffset / NUMBERS_PER_BYTE);
+    uint_t wheelIndex = wheelOffsets_[prime % NUMBERS_PER_BYTE] + INIT[quotient % MODULO].wheelIndex;
+    static_cast<T*>(this)->storeSievingPrime(prime, multipleIndex, wheelIndex);
+  }
   DISALLOW_COPY_AND_ASSIGN(WheelFactorization);
 };
 
-template <uint_t MODULO, uint_t SIZE, const WheelInit* INIT, const WheelElement* WHEEL>
+template <typename T, uint_t MODULO, uint_t SIZE, const WheelInit* INIT, const WheelElement* WHEEL>
 const uint_t
-WheelFactorization<MODULO, SIZE, INIT, WHEEL>::wheelOffsets_[30] =
+WheelFactorization<T, MODULO, SIZE, INIT, WHEEL>::wheelOffsets_[30] =
 {
   0, SIZE * 7, 0, 0, 0, 0,
   0, SIZE * 0, 0, 0, 0, SIZE * 1,
@@ -245,10 +280,24 @@ WheelFactorization<MODULO, SIZE, INIT, WHEEL>::wheelOffsets_[30] =
 };
 
 /// 3rd wheel, skips multiples of 2, 3 and 5
-typedef WheelFactorization<30, 8, wheel30Init, wheel30> Modulo30Wheel_t;
+template <typename T>
+struct Modulo30Wheel
+{
+  typedef WheelFactorization<T, 30, 8, wheel30Init, wheel30> type;
+};
 
-/// 4th wheel, skips multiples of 2, 3, 5 and 7
-typedef WheelFactorization<210, 48, wheel210Init, wheel210> Modulo210Wheel_t;
+/// 4th wheel, skips multiples of 2, 3, 5 and 7.
+/// The 5th wheel (modulo 2310) is not used by EratMedium and EratBig,
+/// it saves only 1/11 of the remaining multiples but its 8 * 480
+/// elements need a 12-bit wheelIndex (i.e. a 20-bit multipleIndex),
+/// a 16-bit next and 23 kilobytes of tables which compete with the
+/// sieve array for the L1 data cache.
+///
+template <typename T>
+struct Modulo210Wheel
+{
+  typedef WheelFactorization<T, 210, 48, wheel210Init, wheel210> type;
+};
 
 } // namespace primesieve
 
@@ -0,0 +1,46 @@
+///
+/// @file   batch.hpp
+/// @brief  Answer many count_primes() and nth_prime() queries
+///         at once using a single ascending sieve sweep.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <stdint.h>
+#include <vector>
+
+namespace primesieve {
+
+/// Count the primes within [starts[i], stops[i]] for each i.
+/// The intervals are sorted and nearby intervals are merged so
+/// that each number is sieved at most once, the merged intervals
+/// are sieved in parallel using up to threads threads.
+/// @param numa  Pin the threads to NUMA nodes.
+///
+void countPrimesBatch(const std::vector<uint64_t>& starts,
+                      const std::vector<uint64_t>& stops,
+                      std::vector<uint64_t>* counts,
+                      int threads,
+                      int sieveSize,
+                      bool numa);
+
+/// Find the n[i]th prime for each i. The ranks are sorted and
+/// nearby ranks are found by sweeping from one prime to the
+/// next instead of restarting the sieve for each rank.
+/// @param numa  Pin the threads to NUMA nodes.
+///
+void nthPrimesBatch(const std::vector<uint64_t>& n,
+                    std::vector<uint64_t>* primes,
+                    int threads,
+                    int sieveSize,
+                    bool numa);
+
+} // namespace primesieve
+
+#endif
@@ -12,6 +12,7 @@
 #define CALLBACK_t_HPP
 
 #include <stdint.h>
+#include <stddef.h>
 
 // C++ linkage
 typedef void (*callback_t)(uint64_t);
@@ -21,6 +22,7 @@ extern "C"
 {
 typedef void (*callback_c_t)(uint64_t);
 typedef void (*callback_c_tn_t)(uint64_t, int);
+typedef void (*callback_c_rank_t)(const uint64_t*, size_t, uint64_t);
 }
 
 #endif
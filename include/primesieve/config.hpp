@@ -45,6 +45,19 @@
   #define SIEVESIZE L1_DCACHE_SIZE
 #endif
 
+/// Prefetch the cache line of address into the CPU cache,
+/// this is only a hint and it does nothing if not supported
+#if !defined(PREFETCH)
+  #if defined(__GNUC__)
+    #define PREFETCH(address) __builtin_prefetch(address)
+  #elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    #include <xmmintrin.h>
+    #define PREFETCH(address) _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0)
+  #else
+    #define PREFETCH(address)
+  #endif
+#endif
+
 namespace primesieve {
 
 /// byte_t must be unsigned in primesieve
@@ -94,11 +107,45 @@ enum {
   ///
   BUCKETSIZE = 1 << 10,
 
-  /// EratBig allocates MEMORY_PER_ALLOC bytes of new memory each
-  /// time it needs more buckets. Default = 8 megabytes.
+  /// EratBig allocates new memory each time it needs more buckets,
+  /// starting with MIN_MEMORY_PER_ALLOC bytes (or the memory needed
+  /// for one bucket per bucket list) the size of the allocations
+  /// doubles up to MEMORY_PER_ALLOC bytes. Default = 64 kilobytes
+  /// and 8 megabytes.
   ///
+  MIN_MEMORY_PER_ALLOC = (1 << 10) * 64,
   MEMORY_PER_ALLOC = (1 << 20) * 8,
 
+  /// Up to ERATBIG_POOL_SIZE bytes of bucket memory of destroyed
+  /// EratBig objects are kept for reuse while a BucketPool exists
+  /// (ParallelPrimeSieve), this avoids repeated page faults if many
+  /// small intervals are sieved. Default = 32 megabytes.
+  ///
+  ERATBIG_POOL_SIZE = (1 << 20) * 32,
+
+  /// EratBig keeps an individual bucket list for each of the next
+  /// (up to) ERATBIG_NEAR_SEGMENTS segments, sieving primes whose
+  /// next multiple is further away are stored in one coarse bucket
+  /// list per block of segments. Near 2^64 this reduces EratBig's
+  /// number of bucket lists from tens of thousands to about 1000.
+  ///
+  ERATBIG_NEAR_SEGMENTS = 1 << 10,
+
+  /// EratMedium prefetches the sieve array byte of the next
+  /// multiple of the sieving prime PREFETCH_DISTANCE positions
+  /// ahead in the current bucket, speed up ~ 3% if the sieve size
+  /// is larger than the CPU's L1 data cache. No prefetching is
+  /// done if the sieve size is <= L1_DCACHE_SIZE.
+  ///
+  PREFETCH_DISTANCE = 16,
+
+  /// On x86 CPUs with AVX2 or AVX-512 EratSmall removes the
+  /// multiples of sieving primes < ERATSMALL_PATTERN_LIMIT using
+  /// precomputed sieve byte patterns instead of the modulo 30
+  /// wheel, these primes have a multiple every few bytes.
+  ///
+  ERATSMALL_PATTERN_LIMIT = 64,
+
   /// primesieve::iterator objects cache up to ITERATOR_CACHE_SMALL
   /// bytes of primes when generating primes below 10^10. Either
   /// L3_CACHE_SIZE or L3_CACHE_SIZE / 2 are good values.
@@ -108,7 +155,13 @@ enum {
   /// primesieve::iterator maximum cache size (in bytes), used if
   /// pi(sqrt(n)) * 8 bytes > ITERATOR_CACHE_MAX.
   ///
-  ITERATOR_CACHE_MAX = (1 << 20) * 512
+  ITERATOR_CACHE_MAX = (1 << 20) * 512,
+
+  /// Default number of results of the count and nth prime API
+  /// functions kept in the LRU result cache (about 100 bytes
+  /// per result), primesieve::set_cache_size(0) disables it.
+  ///
+  RESULT_CACHE_SIZE = 1024
 };
 
   /// Sieving primes <= (sieveSize in bytes * FACTOR_ERATSMALL)
@@ -133,10 +186,11 @@ enum {
   ///
   const uint64_t MIN_THREAD_INTERVAL = static_cast<uint64_t>(1e7);
 
-  /// Each thread sieves at most an interval of size
-  /// MAX_THREAD_INTERVAL to prevent load imbalance near 99%.
+  /// count_primes(start, stop) uses the Lagarias-Miller-Odlyzko
+  /// algorithm instead of sieving if stop - start >
+  /// PI_LMO_THRESHOLD * (stop^(2/3) + start^(2/3)).
   ///
-  const uint64_t MAX_THREAD_INTERVAL = static_cast<uint64_t>(2e10);
+  const double PI_LMO_THRESHOLD = 10;
 
 } // namespace config
 } // namespace primesieve
@@ -0,0 +1,27 @@
+///
+/// @file   cpu_count.hpp
+/// @brief  Detect the number of CPU cores available to the current
+///         process, taking into account the CPU affinity mask and
+///         Linux cgroup CPU quotas.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef CPU_COUNT_HPP
+#define CPU_COUNT_HPP
+
+namespace primesieve {
+
+/// Get the number of CPU cores the current process is allowed to
+/// run on, this is the minimum of the online CPU cores, the CPU
+/// cores in the process' affinity mask and the cgroup (v1 or v2)
+/// CPU quota rounded up. Returns 0 if unknown.
+///
+int getAvailableCpus();
+
+} // namespace primesieve
+
+#endif
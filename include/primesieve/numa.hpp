@@ -0,0 +1,56 @@
+///
+/// @file   numa.hpp
+/// @brief  NUMA-aware thread placement for ParallelPrimeSieve.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef NUMA_PRIMESIEVE_HPP
+#define NUMA_PRIMESIEVE_HPP
+
+#include "config.hpp"
+
+namespace primesieve {
+
+/// Get the number of NUMA nodes with CPU cores available to
+/// the current process, returns 1 if the system is not a
+/// NUMA system or if the topology is unknown.
+///
+int getNumaNodes();
+
+/// Get the NUMA node of the CPU core the calling thread is
+/// currently running on, in [0, getNumaNodes()[.
+///
+int getNumaNode();
+
+/// Get the OpenMP thread number of the calling thread,
+/// returns 0 if primesieve is built without OpenMP.
+///
+int getThreadNum();
+
+/// RAII-style wrapper that pins the calling thread to the CPU
+/// cores of NUMA node (threadNum % getNumaNodes()) and restores
+/// the thread's previous CPU affinity when it goes out of scope.
+/// Memory which is first written to by a pinned thread (sieve
+/// array, pre-sieved buffer, EratBig buckets) is allocated from
+/// the thread's local NUMA node by the operating system. The
+/// huge page arena and EratBig's bucket pool are kept per NUMA
+/// node so that recycled memory also stays node-local.
+///
+class NumaAffinity
+{
+public:
+  NumaAffinity(int threadNum, bool enabled);
+  ~NumaAffinity();
+private:
+  /// Thread's CPU affinity mask before pinning, NULL if not pinned
+  void* oldMask_;
+  DISALLOW_COPY_AND_ASSIGN(NumaAffinity);
+};
+
+} // namespace primesieve
+
+#endif
@@ -0,0 +1,64 @@
+///
+/// @file   parallel_for.hpp
+/// @brief  Chunked parallel loop used by ParallelPrimeSieve's
+///         count-then-fill functions and the batch functions.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef PARALLEL_FOR_HPP
+#define PARALLEL_FOR_HPP
+
+#include <stdint.h>
+
+namespace primesieve {
+
+/// Loop body interface of parallel_for(), process() is called
+/// concurrently by multiple threads.
+///
+class ChunkWork
+{
+public:
+  /// Process the ith chunk.
+  virtual void process(int i) = 0;
+  virtual ~ChunkWork() { }
+};
+
+/// Get the chunk size for splitting [start, stop] among threads
+/// threads. Each chunk initializes its own sieving primes up to
+/// sqrt(stop), more chunks than threads are used for load
+/// balancing.
+/// @pre start <= stop <= 2^64 - 2^32 * 10
+///
+uint64_t getChunkSize(uint64_t start, uint64_t stop, int threads);
+
+/// Get the number of chunks of [start, stop].
+/// @pre start <= stop
+///
+int getNumChunks(uint64_t start, uint64_t stop, uint64_t chunkSize);
+
+/// Get the interval [chunkStart, chunkStop] of the ith chunk
+/// of [start, stop].
+///
+void getChunk(uint64_t start,
+              uint64_t stop,
+              uint64_t chunkSize,
+              int i,
+              uint64_t* chunkStart,
+              uint64_t* chunkStop);
+
+/// Call work.process(i) for i in [0, size[ using up to threads
+/// threads (dynamic scheduling). If numa is true each thread is
+/// pinned to its NUMA node, the bucket memory of EratBig is
+/// reused among the chunks. If process() throws the remaining
+/// chunks are still processed, the error is rethrown as a
+/// primesieve_error once all threads have finished.
+///
+void parallel_for(int size, int threads, bool numa, ChunkWork& work);
+
+} // namespace primesieve
+
+#endif
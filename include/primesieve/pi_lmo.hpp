@@ -0,0 +1,39 @@
+///
+/// @file   pi_lmo.hpp
+/// @brief  Count the primes <= x using the combinatorial
+///         Lagarias-Miller-Odlyzko algorithm.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef PI_LMO_HPP
+#define PI_LMO_HPP
+
+#include <stdint.h>
+
+namespace primesieve {
+
+/// Count the primes <= x using the Lagarias-Miller-Odlyzko
+/// algorithm, runs in O(x^(2/3) / log x) operations using
+/// O(x^(1/3) * log^3 x) space.
+/// @param threads  Number of threads for the special leaves
+///                 and P2 computations.
+///
+uint64_t pi_lmo(uint64_t x, int threads);
+
+/// Estimated cost of pi_lmo(stop) - pi_lmo(start - 1)
+/// in numbers that could be sieved in the same time.
+///
+double getPiLmoCost(uint64_t start, uint64_t stop);
+
+/// Returns true if counting the primes within [start, stop] using
+/// pi_lmo(stop) - pi_lmo(start - 1) is faster than sieving.
+///
+bool isPiLmoFaster(uint64_t start, uint64_t stop);
+
+} // namespace primesieve
+
+#endif
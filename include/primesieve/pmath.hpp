@@ -11,6 +11,11 @@
 #ifndef PMATH_HPP
 #define PMATH_HPP
 
+#if !defined(__STDC_CONSTANT_MACROS)
+  #define __STDC_CONSTANT_MACROS
+#endif
+
+#include <stdint.h>
 #include <cmath>
 
 namespace primesieve {
@@ -95,6 +100,59 @@ inline T isqrt(T x)
   return g0;
 }
 
+/// @brief  Count the 1 bits of a 64-bit word.
+/// @see    http://en.wikipedia.org/wiki/Hamming_weight
+///
+inline uint64_t popcount64(uint64_t x)
+{
+  const uint64_t m1  = UINT64_C(0x5555555555555555);
+  const uint64_t m2  = UINT64_C(0x3333333333333333);
+  const uint64_t m4  = UINT64_C(0x0F0F0F0F0F0F0F0F);
+  const uint64_t h01 = UINT64_C(0x0101010101010101);
+  x -= (x >> 1) & m1;
+  x = (x & m2) + ((x >> 2) & m2);
+  x = (x + (x >> 4)) & m4;
+  return (x * h01) >> 56;
+}
+
+/// @brief  Count the 1 bits of an array, see popcount.cpp.
+uint64_t popcount(const uint64_t* array, uint64_t size);
+
+/// @brief  Integer cube root, floor(x^(1/3)).
+inline uint64_t icbrt(uint64_t x)
+{
+  // floor((2^64 - 1)^(1/3)), r^3 must not overflow
+  const uint64_t maxCbrt = 2642245;
+  uint64_t r = static_cast<uint64_t>(std::pow(static_cast<double>(x), 1.0 / 3.0));
+  if (r > maxCbrt)
+    r = maxCbrt;
+  while (r > 0 && r * r * r > x)
+    r--;
+  while (r < maxCbrt && (r + 1) * (r + 1) * (r + 1) <= x)
+    r++;
+  return r;
+}
+
+/// @brief  Calculate n / d using a double precision division which
+///         is pipelined and much faster than a 64-bit integer
+///         division on most CPUs.
+/// @param  nd  n converted to double.
+/// @pre    d >= FAST_DIVIDE_MIN && d < 2^32, this ensures that the
+///         double precision quotient is off by at most 1.
+///
+enum { FAST_DIVIDE_MIN = 1 << 13 };
+
+inline uint64_t fastDivide(uint64_t n, double nd, uint32_t d)
+{
+  // n / d < 2^51, convert via int64_t (faster than uint64_t)
+  uint64_t q = static_cast<uint64_t>(static_cast<int64_t>(nd / d));
+  // remainder in ]-d, 2d[
+  int64_t r = static_cast<int64_t>(n - q * d);
+  if (r < 0) q--;
+  else if (r >= static_cast<int64_t>(d)) q++;
+  return q;
+}
+
 template <typename T>
 inline T getInBetween(T min, T value, T max)
 {
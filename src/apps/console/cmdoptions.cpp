@@ -44,7 +44,10 @@ enum OptionValues
 {
   OPTION_COUNT,
   OPTION_HELP,
+  OPTION_HISTOGRAM,
+  OPTION_HUGEPAGES,
   OPTION_NTHPRIME,
+  OPTION_NUMA,
   OPTION_NUMBER,
   OPTION_OFFSET,
   OPTION_PRINT,
@@ -64,8 +67,11 @@ void initOptionMap()
   optionMap["--count"]    = OPTION_COUNT;
   optionMap["-h"]         = OPTION_HELP;
   optionMap["--help"]     = OPTION_HELP;
+  optionMap["--histogram"] = OPTION_HISTOGRAM;
+  optionMap["--huge-pages"] = OPTION_HUGEPAGES;
   optionMap["-n"]         = OPTION_NTHPRIME;
   optionMap["--nthprime"] = OPTION_NTHPRIME;
+  optionMap["--numa"]     = OPTION_NUMA;
   optionMap["--number"]   = OPTION_NUMBER;
   optionMap["-o"]         = OPTION_OFFSET;
   optionMap["--offset"]   = OPTION_OFFSET;
@@ -156,6 +162,9 @@ PrimeSieveOptions parseOptions(int argc, char** argv)
         case OPTION_THREADS:  pso.threads = option.getValue<int>(); break;
         case OPTION_QUIET:    pso.quiet = true; break;
         case OPTION_NTHPRIME: pso.nthPrime = true; break;
+        case OPTION_NUMA:     pso.numa = true; break;
+        case OPTION_HUGEPAGES: pso.hugePages = true; break;
+        case OPTION_HISTOGRAM: pso.histogramStep = option.getValue<uint64_t>(); break;
         case OPTION_NUMBER:   pso.n.push_back(option.getValue<uint64_t>()); break;
         case OPTION_OFFSET:   pso.n.push_back(option.getValue<uint64_t>() + pso.n.front()); break;
         case OPTION_TEST:     test(); break;
@@ -16,17 +16,23 @@
 struct PrimeSieveOptions
 {
   std::deque<uint64_t> n;
+  uint64_t histogramStep;
   int flags;
   int sieveSize;
   int threads;
   bool quiet;
   bool nthPrime;
+  bool numa;
+  bool hugePages;
   PrimeSieveOptions() :
+    histogramStep(0),
     flags(0),
     sieveSize(0),
     threads(0),
     quiet(false),
-    nthPrime(false)
+    nthPrime(false),
+    numa(false),
+    hugePages(false)
   { }
 };
 
@@ -28,8 +28,12 @@ const string helpMenu(
   "  -c<N+>, --count=<N+>     Count primes and prime k-tuplets, 1 <= N <= 7\n"
   "                           <N> 1=primes, 2=twins, 3=triplets, ...\n"
   "  -h,     --help           Print this help menu\n"
+  "          --histogram=<N>  Print the counts per interval of N numbers\n"
+  "                           e.g. 10^9 -c12 --histogram=10^8\n"
+  "          --huge-pages     Use 2 megabyte huge pages (Linux only)\n"
   "  -n,     --nthprime       Calculate the nth prime\n"
   "                           e.g. 1 100 -n finds the first prime >= 100\n"
+  "          --numa           Pin threads to NUMA nodes (node-local memory)\n"
   "  -o<N>,  --offset=<N>     Sieve the interval [START, START + N]\n"
   "  -p<N>,  --print=<N>      Print primes or prime k-tuplets, 1 <= N <= 7\n"
   "                           <N> 1=primes, 2=twins, 3=triplets, ...\n"
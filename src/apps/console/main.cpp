@@ -9,6 +9,7 @@
 /// file in the top level directory.
 ///
 
+#include <primesieve.hpp>
 #include <primesieve/ParallelPrimeSieve.hpp>
 #include "cmdoptions.hpp"
 
@@ -17,23 +18,59 @@
 #include <iomanip>
 #include <algorithm>
 #include <string>
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
 
 using namespace std;
 using primesieve::ParallelPrimeSieve;
 
-void printResults(const ParallelPrimeSieve& pps)
+const string primeLabels[7] =
 {
-  const string primeLabels[7] =
-  {
-    "Prime numbers",
-    "Twin primes",
-    "Prime triplets",
-    "Prime quadruplets",
-    "Prime quintuplets",
-    "Prime sextuplets",
-    "Prime septuplets"
-  };
+  "Prime numbers",
+  "Twin primes",
+  "Prime triplets",
+  "Prime quadruplets",
+  "Prime quintuplets",
+  "Prime sextuplets",
+  "Prime septuplets"
+};
+
+/// Print one line per histogram bucket: the bucket's
+/// interval followed by its counts.
+///
+void printHistogram(const ParallelPrimeSieve& pps)
+{
+  // the histogram has buckets only for the counted indexes
+  int first = 0;
+  while (first < 7 && !pps.isCount(first))
+    first++;
+  if (first == 7)
+    return;
 
+  uint64_t step = pps.getHistogramStep();
+  cout << "Histogram  : interval";
+  for (int i = 0; i < 7; i++) {
+    if (pps.isCount(i))
+      cout << ", " << primeLabels[i];
+  }
+  cout << endl;
+
+  const vector<uint64_t>& histogram = pps.getHistogram(first);
+  for (size_t j = 0; j < histogram.size(); j++) {
+    uint64_t low = pps.getStart() + j * step;
+    uint64_t high = (pps.getStop() - low < step) ? pps.getStop() : low + step - 1;
+    cout << "[" << low << ", " << high << "]";
+    for (int i = 0; i < 7; i++) {
+      if (pps.isCount(i))
+        cout << " " << pps.getHistogram(i)[j];
+    }
+    cout << endl;
+  }
+}
+
+void printResults(const ParallelPrimeSieve& pps)
+{
   int size = 0;
   for (int i = 0; i < 7; i++) {
     if (pps.isCount(i))
@@ -73,6 +110,9 @@ int main(int argc, char** argv)
     if (options.sieveSize != 0) pps.setSieveSize(options.sieveSize);
     if (options.threads   != 0) pps.setNumThreads(options.threads);
     else if (pps.isPrint())     pps.setNumThreads(1);
+    if (options.numa)           pps.setNuma(true);
+    if (options.hugePages)      primesieve::set_huge_pages(true);
+    if (options.histogramStep)  pps.setHistogramStep(options.histogramStep);
 
     if (!options.quiet && !options.nthPrime)
     {
@@ -92,6 +132,8 @@ int main(int argc, char** argv)
     else
     {
       pps.sieve();
+      if (pps.getHistogramStep() != 0)
+        printHistogram(pps);
       printResults(pps);
     }
   }
@@ -40,16 +40,31 @@ HEADERS += \
 INCLUDEPATH += ../../../include
 
 SOURCES += \
+  ../../primesieve/Allocator.cpp \
+  ../../primesieve/batch.cpp \
   ../../primesieve/EratBig.cpp \
   ../../primesieve/EratMedium.cpp \
   ../../primesieve/EratSmall.cpp \
+  ../../primesieve/cpu_count.cpp \
+  ../../primesieve/CountIndex.cpp \
+  ../../primesieve/iterator.cpp \
+  ../../primesieve/numa.cpp \
+  ../../primesieve/pi_lmo.cpp \
+  ../../primesieve/PiTable.cpp \
   ../../primesieve/ParallelPrimeSieve.cpp \
+  ../../primesieve/ParallelPrimeSieve-storePrimes.cpp \
+  ../../primesieve/parallel_for.cpp \
   ../../primesieve/popcount.cpp \
   ../../primesieve/PreSieve.cpp \
+  ../../primesieve/PrimeBitmap.cpp \
   ../../primesieve/PrimeFinder.cpp \
   ../../primesieve/PrimeGenerator.cpp \
+  ../../primesieve/PrimeSieve-nthPrime.cpp \
   ../../primesieve/PrimeSieve.cpp \
+  ../../primesieve/primesieve-api.cpp \
+  ../../primesieve/ResultCache.cpp \
   ../../primesieve/SieveOfEratosthenes.cpp \
+  ../../primesieve/SmallPrimeTable.cpp \
   ../../primesieve/WheelFactorization.cpp
 
 # ---------------------------------------------------------
@@ -0,0 +1,269 @@
+///
+/// @file   Allocator.cpp
+/// @brief  The default allocator uses operator new, the huge page
+///         allocator maps 2 megabyte huge pages (Linux only):
+///         explicit huge pages (MAP_HUGETLB) if available, else
+///         transparent huge pages (madvise MADV_HUGEPAGE). Small
+///         allocations are carved out of shared 2 megabyte
+///         chunks (arena), one chunk per NUMA node so that threads
+///         pinned to different nodes do not share huge pages. A
+///         chunk is unmapped once all of its allocations have been
+///         deallocated.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/config.hpp>
+#include <primesieve/Allocator.hpp>
+#include <primesieve/numa.hpp>
+
+#include <cstddef>
+#include <list>
+#include <new>
+#include <vector>
+
+#if defined(__linux__)
+  #include <sys/mman.h>
+  #include <stdint.h>
+#endif
+
+namespace {
+
+using primesieve::Allocator;
+using primesieve::getNumaNode;
+
+class NewAllocator : public Allocator
+{
+public:
+  void* allocate(std::size_t size)
+  {
+    return ::operator new(size);
+  }
+  void deallocate(void* ptr, std::size_t)
+  {
+    ::operator delete(ptr);
+  }
+};
+
+/// Forwards to the user's allocation functions
+class FunctionAllocator : public Allocator
+{
+public:
+  FunctionAllocator(void* (*allocate)(std::size_t), void (*deallocate)(void*)) :
+    allocate_(allocate),
+    deallocate_(deallocate)
+  { }
+  void* allocate(std::size_t size)
+  {
+    void* ptr = allocate_(size);
+    if (!ptr)
+      throw std::bad_alloc();
+    return ptr;
+  }
+  void deallocate(void* ptr, std::size_t)
+  {
+    deallocate_(ptr);
+  }
+private:
+  void* (*allocate_)(std::size_t);
+  void (*deallocate_)(void*);
+};
+
+#if defined(__linux__) && defined(MAP_ANONYMOUS)
+
+const std::size_t HUGE_PAGE_SIZE = 1 << 21;
+
+/// Allocations >= LARGE_SIZE get their own huge pages
+const std::size_t LARGE_SIZE = HUGE_PAGE_SIZE / 2;
+
+/// Arena allocations are cache line aligned
+const std::size_t ALIGNMENT = 64;
+
+std::size_t roundUp(std::size_t size, std::size_t multiple)
+{
+  return ((size + multiple - 1) / multiple) * multiple;
+}
+
+/// Map huge page aligned memory, size must be a
+/// multiple of HUGE_PAGE_SIZE. @return NULL if failed.
+///
+void* mapHugePages(std::size_t size)
+{
+#if defined(MAP_HUGETLB)
+  void* ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (ptr != MAP_FAILED)
+    return ptr;
+#endif
+
+  // no explicit huge pages available, use transparent
+  // huge pages which require huge page aligned memory
+  std::size_t mapSize = size + HUGE_PAGE_SIZE;
+  void* map = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (map == MAP_FAILED)
+    return NULL;
+
+  char* first = static_cast<char*>(map);
+  char* aligned = reinterpret_cast<char*>(roundUp(reinterpret_cast<uintptr_t>(first), HUGE_PAGE_SIZE));
+  std::size_t head = aligned - first;
+  std::size_t tail = mapSize - head - size;
+  if (head > 0)
+    munmap(first, head);
+  if (tail > 0)
+    munmap(aligned + size, tail);
+
+#if defined(MADV_HUGEPAGE)
+  madvise(aligned, size, MADV_HUGEPAGE);
+#endif
+  return aligned;
+}
+
+class HugePageAllocator : public Allocator
+{
+public:
+  void* allocate(std::size_t size)
+  {
+    void* ptr = NULL;
+
+    if (size >= LARGE_SIZE)
+      ptr = mapHugePages(roundUp(size, HUGE_PAGE_SIZE));
+    else
+    {
+      size = roundUp(size, ALIGNMENT);
+      // the huge page of a new chunk is first touched here
+      // by the allocating thread and hence allocated from
+      // that thread's NUMA node
+      int node = getNumaNode();
+
+      #pragma omp critical (primesieve_allocator)
+      {
+        if (chunks_.size() <= static_cast<std::size_t>(node))
+          chunks_.resize(node + 1, NULL);
+        Chunk*& chunk = chunks_[node];
+        if (!chunk || chunk->used + size > HUGE_PAGE_SIZE)
+          newChunk(node);
+        if (chunk)
+        {
+          ptr = reinterpret_cast<char*>(chunk) + chunk->used;
+          chunk->used += size;
+          chunk->live++;
+        }
+      }
+    }
+
+    if (!ptr)
+      throw std::bad_alloc();
+    return ptr;
+  }
+  void deallocate(void* ptr, std::size_t size)
+  {
+    if (size >= LARGE_SIZE)
+    {
+      munmap(ptr, roundUp(size, HUGE_PAGE_SIZE));
+      return;
+    }
+
+    // chunks are huge page aligned
+    uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+    Chunk* chunk = reinterpret_cast<Chunk*>(address & ~(HUGE_PAGE_SIZE - 1));
+    bool unmap = false;
+
+    #pragma omp critical (primesieve_allocator)
+    {
+      if (--chunk->live == 0)
+      {
+        if (chunk == chunks_[chunk->node])
+          chunk->used = HEADER_SIZE;
+        else
+          unmap = true;
+      }
+    }
+
+    if (unmap)
+      munmap(chunk, HUGE_PAGE_SIZE);
+  }
+private:
+  /// Header at the start of each chunk
+  struct Chunk
+  {
+    /// Bytes used including the header
+    std::size_t used;
+    /// Number of allocations not yet deallocated
+    std::size_t live;
+    /// NUMA node of the chunk
+    std::size_t node;
+  };
+  enum { HEADER_SIZE = ALIGNMENT };
+  /// Chunks for new arena allocations, one per NUMA node
+  std::vector<Chunk*> chunks_;
+  /// The current chunk of node is replaced by a new one, it
+  /// is unmapped once its last allocation is deallocated.
+  ///
+  void newChunk(int node)
+  {
+    Chunk*& chunk = chunks_[node];
+    if (chunk && chunk->live == 0)
+      munmap(chunk, HUGE_PAGE_SIZE);
+    chunk = static_cast<Chunk*>(mapHugePages(HUGE_PAGE_SIZE));
+    if (chunk)
+    {
+      chunk->used = HEADER_SIZE;
+      chunk->live = 0;
+      chunk->node = node;
+    }
+  }
+};
+
+#else
+
+/// Huge pages are not supported on this platform
+typedef NewAllocator HugePageAllocator;
+
+#endif
+
+NewAllocator newAllocator;
+HugePageAllocator hugePageAllocator;
+bool hugePages = false;
+
+/// All user allocators ever set, memory may still be owned by
+/// objects (or recycled) that use a previous user allocator
+///
+std::list<FunctionAllocator> functionAllocators;
+FunctionAllocator* functionAllocator = NULL;
+
+} // namespace
+
+namespace primesieve {
+
+Allocator& Allocator::get()
+{
+  if (functionAllocator)
+    return *functionAllocator;
+  if (hugePages)
+    return hugePageAllocator;
+  return newAllocator;
+}
+
+void Allocator::setFunctions(void* (*allocate)(std::size_t), void (*deallocate)(void*))
+{
+  functionAllocator = NULL;
+  if (allocate && deallocate)
+  {
+    functionAllocators.push_back(FunctionAllocator(allocate, deallocate));
+    functionAllocator = &functionAllocators.back();
+  }
+}
+
+void Allocator::setHugePages(bool enable)
+{
+  hugePages = enable;
+}
+
+bool Allocator::isHugePages()
+{
+  return hugePages;
+}
+
+} // namespace primesieve
@@ -0,0 +1,300 @@
+///
+/// @file   CountIndex.cpp
+/// @brief  Persistent, memory-mapped index of the prime and prime
+///         k-tuplet counts of aligned blocks. The index file
+///         consists of 32 bytes entries, the first entry is the
+///         file header, entry b + 1 holds the counts of block b.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/config.hpp>
+#include <primesieve/CountIndex.hpp>
+#include <primesieve/primesieve_error.hpp>
+
+#include <stdint.h>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/file.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+  #define HAVE_MMAP
+#endif
+
+namespace {
+
+const char INDEX_MAGIC[16] = "primesieve-cidx";
+
+const uint32_t INDEX_VERSION = 1;
+
+/// Blocks >= MAX_BLOCKS (numbers > 4 * 10^15) are not indexed,
+/// this limits the size of the (sparse) index file to 8 gigabytes.
+///
+const uint64_t MAX_BLOCKS = static_cast<uint64_t>(1) << 28;
+
+/// The index file grows in steps of 1 megabyte
+const std::size_t GROW_SIZE = 1 << 20;
+
+struct Header
+{
+  char magic[16];
+  uint32_t version;
+  uint32_t log2BlockBytes;
+  uint32_t unused[2];
+};
+
+primesieve::CountIndex* countIndex = NULL;
+
+#if defined(HAVE_MMAP)
+
+/// RAII-style exclusive lock of the index file, used to
+/// synchronize processes that create or enlarge the file.
+///
+class FileLock
+{
+public:
+  FileLock(int fd) :
+    fd_(fd),
+    isLocked_(flock(fd, LOCK_EX) == 0)
+  { }
+  ~FileLock()
+  {
+    if (isLocked_)
+      flock(fd_, LOCK_UN);
+  }
+  bool isLocked() const
+  {
+    return isLocked_;
+  }
+private:
+  FileLock(const FileLock&);
+  void operator=(const FileLock&);
+  int fd_;
+  bool isLocked_;
+};
+
+#endif
+
+} // namespace
+
+namespace primesieve {
+
+CountIndex* CountIndex::get()
+{
+  return countIndex;
+}
+
+void CountIndex::open(const char* filename)
+{
+  delete countIndex;
+  countIndex = NULL;
+  if (filename != NULL)
+    countIndex = new CountIndex(filename);
+}
+
+uint64_t CountIndex::getBlockLow(uint64_t block)
+{
+  return (block << LOG2_BLOCK_BYTES) * NUMBERS_PER_BYTE + 7;
+}
+
+uint64_t CountIndex::getBlockHigh(uint64_t block)
+{
+  return getBlockLow(block + 1) - 1;
+}
+
+uint64_t CountIndex::getBlocks()
+{
+  uint64_t blocks = 0;
+
+  #pragma omp critical (primesieve_count_index)
+  {
+    map(0, false);
+    if (size_ > 0)
+      blocks = size_ / sizeof(Entry) - 1;
+  }
+
+  return blocks;
+}
+
+bool CountIndex::find(uint64_t block, int countFlags, uint64_t* counts)
+{
+  bool found = true;
+
+  #pragma omp critical (primesieve_count_index)
+  {
+    if ((block + 2) * sizeof(Entry) > size_)
+      found = false;
+    else
+    {
+      const Entry& entry = entries_[block + 1];
+      for (int i = 0; i < COUNTS && found; i++)
+      {
+        if (countFlags & (1 << i))
+        {
+          found = (entry.counts[i] != 0);
+          counts[i] = entry.counts[i] - 1;
+        }
+      }
+    }
+  }
+
+  return found;
+}
+
+void CountIndex::store(uint64_t block, int countFlags, const uint64_t* counts)
+{
+  #pragma omp critical (primesieve_count_index)
+  {
+    if (map(block, true))
+    {
+      Entry& entry = entries_[block + 1];
+      for (int i = 0; i < COUNTS; i++)
+        if (countFlags & (1 << i))
+          entry.counts[i] = static_cast<uint32_t>(counts[i] + 1);
+    }
+  }
+}
+
+#if defined(HAVE_MMAP)
+
+bool CountIndex::isSupported()
+{
+  return true;
+}
+
+CountIndex::CountIndex(const char* filename) :
+  filename_(filename),
+  fd_(-1),
+  entries_(NULL),
+  size_(0)
+{
+  fd_ = ::open(filename, O_RDWR | O_CREAT, 0644);
+  if (fd_ == -1)
+    throw primesieve_error("cannot open count index " + filename_);
+
+  Header header;
+  std::memset(&header, 0, sizeof(header));
+  FileLock lock(fd_);
+  struct stat st;
+
+  if (fstat(fd_, &st) == 0 && st.st_size == 0)
+  {
+    std::memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    header.version = INDEX_VERSION;
+    header.log2BlockBytes = LOG2_BLOCK_BYTES;
+    if (pwrite(fd_, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)))
+    {
+      ::close(fd_);
+      throw primesieve_error("cannot write count index " + filename_);
+    }
+  }
+  else if (pread(fd_, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)) ||
+           std::memcmp(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 ||
+           header.version != INDEX_VERSION ||
+           header.log2BlockBytes != LOG2_BLOCK_BYTES)
+  {
+    ::close(fd_);
+    throw primesieve_error(filename_ + " is not a primesieve count index");
+  }
+}
+
+CountIndex::~CountIndex()
+{
+  unmap();
+  ::close(fd_);
+}
+
+/// Map the index file if block is not yet mapped or if the
+/// file has been enlarged by another process.
+/// @param grow  Enlarge the index file if it is too small.
+///
+bool CountIndex::map(uint64_t block, bool grow)
+{
+  uint64_t bytes = (block + 2) * sizeof(Entry);
+  if (block >= MAX_BLOCKS ||
+      bytes > std::numeric_limits<std::size_t>::max() / 2)
+    return false;
+  std::size_t required = static_cast<std::size_t>(bytes);
+  if (required <= size_ && grow)
+    return true;
+
+  struct stat st;
+  if (fstat(fd_, &st) != 0)
+    return false;
+  std::size_t fileSize = static_cast<std::size_t>(st.st_size);
+  if (fileSize == size_ && required <= size_)
+    return true;
+
+  if (fileSize < required)
+  {
+    if (!grow)
+      return false;
+    // other processes may enlarge the file concurrently, the
+    // file size is checked again while holding the lock so
+    // that the file is never shrunk
+    FileLock lock(fd_);
+    if (!lock.isLocked() || fstat(fd_, &st) != 0)
+      return false;
+    fileSize = static_cast<std::size_t>(st.st_size);
+    if (fileSize < required)
+    {
+      fileSize = (required + GROW_SIZE - 1) / GROW_SIZE * GROW_SIZE;
+      if (ftruncate(fd_, static_cast<off_t>(fileSize)) != 0)
+        return false;
+    }
+  }
+
+  unmap();
+  void* addr = mmap(NULL, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (addr == MAP_FAILED)
+    return false;
+  entries_ = static_cast<Entry*>(addr);
+  size_ = fileSize;
+  return true;
+}
+
+void CountIndex::unmap()
+{
+  if (entries_ != NULL)
+    munmap(entries_, size_);
+  entries_ = NULL;
+  size_ = 0;
+}
+
+#else
+
+bool CountIndex::isSupported()
+{
+  return false;
+}
+
+CountIndex::CountIndex(const char* filename) :
+  filename_(filename),
+  fd_(-1),
+  entries_(NULL),
+  size_(0)
+{
+  throw primesieve_error("count index: memory-mapped files are not supported on this system");
+}
+
+CountIndex::~CountIndex() { }
+
+bool CountIndex::map(uint64_t, bool)
+{
+  return false;
+}
+
+void CountIndex::unmap() { }
+
+#endif
+
+} // namespace primesieve
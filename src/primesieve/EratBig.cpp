@@ -14,6 +14,8 @@
 #include <primesieve/config.hpp>
 #include <primesieve/EratBig.hpp>
 #include <primesieve/WheelFactorization.hpp>
+#include <primesieve/Allocator.hpp>
+#include <primesieve/numa.hpp>
 #include <primesieve/primesieve_error.hpp>
 #include <primesieve/pmath.hpp>
 
@@ -21,78 +23,237 @@
 #include <cstdlib>
 #include <cassert>
 #include <algorithm>
+#include <new>
 #include <vector>
 
 namespace primesieve {
 
-/// @param stop       Upper bound for sieving.
-/// @param sieveSize  Sieve size in bytes.
-/// @param limit      Sieving primes in EratBig must be <= limit,
-///                   usually limit = sqrt(stop).
+std::vector<EratBig::Memory> EratBig::pool_;
+std::size_t EratBig::poolSize_ = 0;
+int EratBig::poolUsers_ = 0;
+
+/// @param segmentLow  Low bound of the first segment.
+/// @param stop        Upper bound for sieving.
+/// @param sieveSize   Sieve size in bytes.
+/// @param limit       Sieving primes in EratBig must be <= limit,
+///                    usually limit = sqrt(stop).
 ///
-EratBig::EratBig(uint64_t stop, uint_t sieveSize, uint_t limit) :
-  Modulo210Wheel_t(stop, sieveSize),
+EratBig::EratBig(uint64_t segmentLow, uint64_t stop, uint_t sieveSize, uint_t limit) :
+  Modulo210Wheel<EratBig>::type(stop, sieveSize),
   limit_(limit),
   log2SieveSize_(ilog2(sieveSize)),
   moduloSieveSize_(sieveSize - 1),
-  stock_(NULL)
+  segment_(0),
+  block_(0),
+  stock_(NULL),
+  allocator_(Allocator::get())
 {
   // '>> log2SieveSize' requires a power of 2 sieveSize
   if (!isPowerOf2(sieveSize))
     throw primesieve_error("EratBig: sieveSize must be a power of 2");
-  init(sieveSize);
+  try {
+    init(segmentLow, stop, sieveSize);
+  }
+  catch (const std::exception&) {
+    release();
+    throw;
+  }
 }
 
 EratBig::~EratBig()
 {
-  for (std::size_t i = 0; i < pointers_.size(); i++)
-    delete[] pointers_[i];
+  release();
+}
+
+/// Give the bucket memory to the pool for reuse by the next
+/// EratBig objects, deallocate it if there is no BucketPool
+/// or if the pool is full.
+///
+void EratBig::release()
+{
+  for (std::size_t i = 0; i < memory_.size(); i++)
+    if (!recycle(memory_[i]))
+      memory_[i].allocator->deallocate(memory_[i].buckets, memory_[i].size);
+  memory_.clear();
 }
 
-void EratBig::init(uint_t sieveSize)
+bool EratBig::recycle(Memory& memory)
+{
+  bool recycled = false;
+
+  #pragma omp critical (primesieve_eratbig_pool)
+  {
+    if (poolUsers_ > 0 &&
+        poolSize_ + memory.size <= config::ERATBIG_POOL_SIZE)
+    {
+      pool_.push_back(memory);
+      poolSize_ += memory.size;
+      recycled = true;
+    }
+  }
+
+  return recycled;
+}
+
+void EratBig::openPool()
+{
+  #pragma omp critical (primesieve_eratbig_pool)
+  poolUsers_++;
+}
+
+/// Deallocate the pooled memory once the last
+/// BucketPool object is destroyed.
+///
+void EratBig::closePool()
+{
+  std::vector<Memory> pool;
+
+  #pragma omp critical (primesieve_eratbig_pool)
+  {
+    if (--poolUsers_ == 0)
+    {
+      pool.swap(pool_);
+      poolSize_ = 0;
+    }
+  }
+
+  for (std::size_t i = 0; i < pool.size(); i++)
+    pool[i].allocator->deallocate(pool[i].buckets, pool[i].size);
+}
+
+/// Near 2^64 the sieving primes have their next multiple up to
+/// tens of thousands of segments ahead. Instead of one bucket list
+/// per future segment (each pinning a bucket) EratBig uses a 2 level
+/// hierarchy: lists_ holds one bucket list for each of the next
+/// nearSegments_ segments, farLists_ is a ring buffer of one bucket
+/// list per future block of blockSize segments. Each time a new
+/// block is reached lists_ is shifted by blockSize and the
+/// block's far list is redistributed into lists_.
+/// If the sieving interval is shorter than the distance to the
+/// next multiples only the lists of the interval's segments are
+/// needed, sieving primes whose next multiple is beyond the
+/// interval are dropped.
+///
+void EratBig::init(uint64_t segmentLow, uint64_t stop, uint_t sieveSize)
 {
   uint_t maxSievingPrime  = limit_ / NUMBERS_PER_BYTE;
   uint_t maxNextMultiple  = maxSievingPrime * getMaxFactor() + getMaxFactor();
   uint_t maxMultipleIndex = sieveSize - 1 + maxNextMultiple;
   uint_t maxSegmentCount  = maxMultipleIndex >> log2SieveSize_;
-  uint_t size = maxSegmentCount + 1;
+  uint64_t lastSegment    = ((stop - segmentLow) / NUMBERS_PER_BYTE) >> log2SieveSize_;
 
-  // EratBig uses up to 1.6 gigabytes of memory near 2^64
-  pointers_.reserve(((1u << 30) * 2) / config::MEMORY_PER_ALLOC);
+  nearSegments_ = std::min<uint_t>(maxSegmentCount + 1, config::ERATBIG_NEAR_SEGMENTS);
+  if (lastSegment < nearSegments_)
+    nearSegments_ = static_cast<uint_t>(lastSegment + 1);
+  farStore_ = maxSegmentCount >= nearSegments_;
 
-  lists_.resize(size, NULL);
-  for (uint_t i = 0; i < size; i++)
-    pushBucket(i);
+  // far sieving primes store their multipleIndex relative
+  // to the start of their block, it must fit into 23 bits
+  uint_t maxBlockSize = (SievingPrime::MAX_MULTIPLEINDEX + 1) >> log2SieveSize_;
+  uint_t blockSize = floorPowerOf2(std::max<uint_t>(nearSegments_ / 4, 1));
+  blockSize = std::min(blockSize, maxBlockSize);
+  log2BlockSize_ = ilog2(blockSize);
+  moduloBlockSize_ = blockSize - 1;
+
+  uint_t farSize = 0;
+  if (maxSegmentCount >= nearSegments_ && lastSegment >= nearSegments_)
+  {
+    uint_t maxBlocks = ((moduloBlockSize_ + maxSegmentCount) >> log2BlockSize_) + 1;
+    farSize = floorPowerOf2(maxBlocks);
+    if (farSize < maxBlocks)
+      farSize *= 2;
+  }
+
+  lists_.resize(nearSegments_ + blockSize, NULL);
+  farLists_.resize(farSize, NULL);
+
+  // the first allocation provides a bucket for each list
+  std::size_t size = (lists_.size() + farLists_.size()) * sizeof(Bucket);
+  allocSize_ = std::max<std::size_t>(size, config::MIN_MEMORY_PER_ALLOC);
+  for (std::size_t i = 0; i < lists_.size(); i++)
+    pushBucket(lists_[i]);
+  for (std::size_t i = 0; i < farLists_.size(); i++)
+    pushBucket(farLists_[i]);
 }
 
-/// Add a new sieving prime to EratBig
-void EratBig::storeSievingPrime(uint_t prime, uint_t multipleIndex, uint_t wheelIndex)
+/// Move a sieving prime whose next multiple is nearSegments_ or
+/// more segments ahead to the far list of its block. Without far
+/// lists the sieving interval ends before the next multiple.
+///
+void EratBig::storeFar(uint_t sievingPrime, uint_t multipleIndex, uint_t wheelIndex)
 {
-  assert(prime <= limit_);
-  uint_t sievingPrime = prime / NUMBERS_PER_BYTE;
-  uint_t segment = multipleIndex >> log2SieveSize_;
+  // next multiple > stop
+  if (farLists_.empty())
+    return;
+
+  uint_t segment = segment_ + (multipleIndex >> log2SieveSize_);
+  uint_t block = (block_ + (segment >> log2BlockSize_)) & (farLists_.size() - 1);
   multipleIndex &= moduloSieveSize_;
-  if (!lists_[segment]->store(sievingPrime, multipleIndex, wheelIndex))
-    pushBucket(segment);
+  multipleIndex |= (segment & moduloBlockSize_) << log2SieveSize_;
+  if (!farLists_[block]->store(sievingPrime, multipleIndex, wheelIndex))
+    pushBucket(farLists_[block]);
 }
 
-/// Add an empty bucket to the front of lists_[segment].
-void EratBig::pushBucket(uint_t segment)
+/// Add an empty bucket to the front of list.
+void EratBig::pushBucket(Bucket*& list)
 {
   // if the stock_ is empty allocate new buckets
   if (!stock_)
-  {
-    const int N = config::MEMORY_PER_ALLOC / sizeof(Bucket);
-    Bucket* buckets = new Bucket[N];
-    for(int i = 0; i < N-1; i++)
-      buckets[i].setNext(&buckets[i + 1]);
-    buckets[N-1].setNext(NULL);
-    pointers_.push_back(buckets);
-    stock_ = buckets;
-  }
+    allocateBuckets();
   Bucket* emptyBucket = stock_;
   stock_ = stock_->next();
-  moveBucket(*emptyBucket, lists_[segment]);
+  moveBucket(*emptyBucket, list);
+}
+
+/// Fill the stock_ with new buckets, memory of destroyed EratBig
+/// objects is reused if available. Only memory allocated on the
+/// current thread's NUMA node is reused, the buckets of pinned
+/// threads stay node-local. Short-lived EratBig objects
+/// (small intervals) need few buckets, hence the allocation size
+/// grows geometrically from MIN_MEMORY_PER_ALLOC (or more) to
+/// MEMORY_PER_ALLOC bytes.
+///
+void EratBig::allocateBuckets()
+{
+  Memory memory;
+  memory.buckets = NULL;
+  int node = getNumaNode();
+
+  #pragma omp critical (primesieve_eratbig_pool)
+  {
+    for (std::size_t i = pool_.size(); i > 0; i--)
+    {
+      if (pool_[i - 1].allocator == &allocator_ &&
+          pool_[i - 1].node == node)
+      {
+        memory = pool_[i - 1];
+        pool_.erase(pool_.begin() + (i - 1));
+        poolSize_ -= memory.size;
+        break;
+      }
+    }
+  }
+
+  if (!memory.buckets)
+  {
+    memory.size = allocSize_;
+    memory.allocator = &allocator_;
+    memory.node = node;
+    memory.buckets = static_cast<Bucket*>(allocator_.allocate(memory.size));
+  }
+
+  memory_.push_back(memory);
+  allocSize_ = std::max(allocSize_, memory.size);
+  allocSize_ = std::min<std::size_t>(allocSize_ * 2, config::MEMORY_PER_ALLOC);
+
+  std::size_t n = memory.size / sizeof(Bucket);
+  Bucket* buckets = memory.buckets;
+  for (std::size_t i = 0; i < n; i++)
+    new (&buckets[i]) Bucket();
+  for (std::size_t i = 0; i < n - 1; i++)
+    buckets[i].setNext(&buckets[i + 1]);
+  buckets[n - 1].setNext(NULL);
+  stock_ = buckets;
 }
 
 void EratBig::moveBucket(Bucket& src, Bucket*& dest)
@@ -106,15 +267,20 @@ void EratBig::moveBucket(Bucket& src, Bucket*& dest)
 ///
 void EratBig::crossOff(byte_t* sieve)
 {
-  // process the buckets in lists_[0] which hold the sieving primes
-  // that have multiple(s) in the current segment
-  while (lists_[0]->hasNext() || !lists_[0]->empty())
+  // process the buckets in lists_[segment_] which hold the
+  // sieving primes that have multiple(s) in the current segment
+  Bucket*& list = lists_[segment_];
+
+  while (list->hasNext() || !list->empty())
   {
-    Bucket* bucket = lists_[0];
-    lists_[0] = NULL;
-    pushBucket(0);
+    Bucket* bucket = list;
+    list = NULL;
+    pushBucket(list);
     do {
-      crossOff(sieve, bucket->begin(), bucket->end());
+      if (!farStore_)
+        crossOff<false>(sieve, bucket->begin(), bucket->end());
+      else
+        crossOff<true>(sieve, bucket->begin(), bucket->end());
       Bucket* processed = bucket;
       bucket = bucket->next();
       processed->reset();
@@ -122,9 +288,42 @@ void EratBig::crossOff(byte_t* sieve)
     } while (bucket);
   }
 
-  // move the list corresponding to the next segment
-  // i.e. lists_[1] to lists_[0] ...
-  std::rotate(lists_.begin(), lists_.begin() + 1, lists_.end());
+  if (++segment_ > moduloBlockSize_)
+    nextBlock();
+}
+
+/// Move on to the next block, lists_ is shifted by blockSize
+/// (the lists of the finished block are empty) and the sieving
+/// primes of the new block's far list are distributed to the
+/// bucket lists of their next multiple's segment.
+///
+void EratBig::nextBlock()
+{
+  std::rotate(lists_.begin(), lists_.begin() + segment_, lists_.end());
+  segment_ = 0;
+
+  if (farLists_.empty())
+    return;
+
+  block_ = (block_ + 1) & (farLists_.size() - 1);
+  Bucket* bucket = farLists_[block_];
+  farLists_[block_] = NULL;
+  pushBucket(farLists_[block_]);
+
+  do {
+    for (SievingPrime* sPrime = bucket->begin(); sPrime != bucket->end(); sPrime++)
+    {
+      uint_t multipleIndex = sPrime->getMultipleIndex();
+      uint_t segment = multipleIndex >> log2SieveSize_;
+      multipleIndex &= moduloSieveSize_;
+      if (!lists_[segment]->store(sPrime->getSievingPrime(), multipleIndex, sPrime->getWheelIndex()))
+        pushBucket(lists_[segment]);
+    }
+    Bucket* processed = bucket;
+    bucket = bucket->next();
+    processed->reset();
+    moveBucket(*processed, stock_);
+  } while (bucket);
 }
 
 /// Cross-off the next multiple of each sieving prime within the
@@ -132,10 +331,15 @@ void EratBig::crossOff(byte_t* sieve)
 /// of Eratosthenes with wheel factorization optimized for big sieving
 /// primes that have very few multiples per segment. This algorithm
 /// uses a modulo 210 wheel that skips multiples of 2, 3, 5 and 7.
+/// @tparam FAR_LISTS  false if all sieving primes have their next
+///                    multiple less than nearSegments_ segments
+///                    ahead, this keeps the far lists check out of
+///                    the innermost loop.
 ///
+template <bool FAR_LISTS>
 void EratBig::crossOff(byte_t* sieve, SievingPrime* sPrime, SievingPrime* sEnd)
 {
-  Bucket** lists = &lists_.front();
+  Bucket** lists = &lists_[segment_];
   uint_t moduloSieveSize = moduloSieveSize_;
   uint_t log2SieveSize = log2SieveSize_;
 
@@ -155,6 +359,13 @@ void EratBig::crossOff(byte_t* sieve, SievingPrime* sPrime, SievingPrime* sEnd)
     unsetBit(sieve, sievingPrime0, &multipleIndex0, &wheelIndex0);
     unsetBit(sieve, sievingPrime1, &multipleIndex1, &wheelIndex1);
 
+    if (FAR_LISTS)
+    {
+      store(sievingPrime0, multipleIndex0, wheelIndex0);
+      store(sievingPrime1, multipleIndex1, wheelIndex1);
+      continue;
+    }
+
     uint_t segment0 = multipleIndex0 >> log2SieveSize;
     uint_t segment1 = multipleIndex1 >> log2SieveSize;
     multipleIndex0 &= moduloSieveSize;
@@ -163,9 +374,9 @@ void EratBig::crossOff(byte_t* sieve, SievingPrime* sPrime, SievingPrime* sEnd)
     // move the 2 sieving primes to the list related
     // to their next multiple
     if (!lists[segment0]->store(sievingPrime0, multipleIndex0, wheelIndex0))
-      pushBucket(segment0);
+      pushBucket(lists[segment0]);
     if (!lists[segment1]->store(sievingPrime1, multipleIndex1, wheelIndex1))
-      pushBucket(segment1);
+      pushBucket(lists[segment1]);
   }
 
   if (sPrime != sEnd)
@@ -175,11 +386,7 @@ void EratBig::crossOff(byte_t* sieve, SievingPrime* sPrime, SievingPrime* sEnd)
     uint_t sievingPrime  = sPrime->getSievingPrime();
 
     unsetBit(sieve, sievingPrime, &multipleIndex, &wheelIndex);
-    uint_t segment = multipleIndex >> log2SieveSize;
-    multipleIndex &= moduloSieveSize;
-
-    if (!lists[segment]->store(sievingPrime, multipleIndex, wheelIndex))
-      pushBucket(segment);
+    store(sievingPrime, multipleIndex, wheelIndex);
   }
 }
 
@@ -16,7 +16,7 @@
 
 #include <stdint.h>
 #include <cassert>
-#include <list>
+#include <vector>
 
 namespace primesieve {
 
@@ -25,7 +25,7 @@ namespace primesieve {
 /// @param limit      Sieving primes in EratMedium must be <= limit.
 ///
 EratMedium::EratMedium(uint64_t stop, uint_t sieveSize, uint_t limit) :
-  Modulo210Wheel_t(stop, sieveSize),
+  Modulo210Wheel<EratMedium>::type(stop, sieveSize),
   limit_(limit)
 {
   // ensure multipleIndex < 2^23 in crossOff()
@@ -33,16 +33,6 @@ EratMedium::EratMedium(uint64_t stop, uint_t sieveSize, uint_t limit) :
     throw primesieve_error("EratMedium: sieveSize must be <= 2^21, 2048 kilobytes");
   if (limit > sieveSize * 9)
     throw primesieve_error("EratMedium: limit must be <= sieveSize * 9");
-  buckets_.push_back(Bucket());
-}
-
-/// Add a new sieving prime to EratMedium
-void EratMedium::storeSievingPrime(uint_t prime, uint_t multipleIndex, uint_t wheelIndex)
-{
-  assert(prime <= limit_);
-  uint_t sievingPrime = prime / NUMBERS_PER_BYTE;
-  if (!buckets_.back().store(sievingPrime, multipleIndex, wheelIndex))
-    buckets_.push_back(Bucket());
 }
 
 /// Cross-off the multiples of medium sieving
@@ -50,25 +40,33 @@ void EratMedium::storeSievingPrime(uint_t prime, uint_t multipleIndex, uint_t wh
 ///
 void EratMedium::crossOff(byte_t* sieve, uint_t sieveSize)
 {
-  for (BucketIterator_t iter = buckets_.begin(); iter != buckets_.end(); ++iter)
-    crossOff(sieve, sieveSize, *iter);
+  if (!sievingPrimes_.empty())
+    crossOff(sieve, sieveSize, &sievingPrimes_[0], &sievingPrimes_[0] + sievingPrimes_.size());
 }
 
-/// Cross-off the multiples of the sieving primes within the current
-/// bucket. This is an implementation of the segmented sieve of
+/// Cross-off the multiples of the sieving primes in [sPrime, sEnd[.
+/// This is an implementation of the segmented sieve of
 /// Eratosthenes with wheel factorization optimized for medium sieving
 /// primes that have a few multiples per segment. This algorithm uses
 /// a modulo 210 wheel that skips multiples of 2, 3, 5 and 7.
 ///
-void EratMedium::crossOff(byte_t* sieve, uint_t sieveSize, Bucket& bucket)
+void EratMedium::crossOff(byte_t* sieve, uint_t sieveSize, SievingPrime* sPrime, SievingPrime* sEnd)
 {
-  SievingPrime* sPrime = bucket.begin();
-  SievingPrime* sEnd = bucket.end();
+  // prefetching only pays off if the sieve array
+  // does not fit into the CPU's L1 data cache
+  bool prefetch = (sieveSize > L1_DCACHE_SIZE * 1024u);
 
   // process 2 sieving primes per loop iteration to
   // increase instruction level parallelism
   for (; sPrime + 2 <= sEnd; sPrime += 2)
   {
+    if (prefetch && sPrime + config::PREFETCH_DISTANCE + 2 <= sEnd)
+    {
+      SievingPrime* ahead = sPrime + config::PREFETCH_DISTANCE;
+      PREFETCH(&sieve[ahead[0].getMultipleIndex()]);
+      PREFETCH(&sieve[ahead[1].getMultipleIndex()]);
+    }
+
     uint_t multipleIndex0 = sPrime[0].getMultipleIndex();
     uint_t wheelIndex0    = sPrime[0].getWheelIndex();
     uint_t sievingPrime0  = sPrime[0].getSievingPrime();
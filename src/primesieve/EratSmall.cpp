@@ -17,7 +17,86 @@
 
 #include <stdint.h>
 #include <cassert>
-#include <list>
+#include <vector>
+
+#if defined(__GNUC__) && defined(__x86_64__) && \
+   (defined(__clang__) || __GNUC__ >= 5)
+  #include <immintrin.h>
+  #define ERATSMALL_X86_DISPATCH
+#endif
+
+namespace {
+
+using primesieve::byte_t;
+using primesieve::uint_t;
+
+#if defined(ERATSMALL_X86_DISPATCH)
+
+/// Remove the multiples of a small sieving prime from
+/// [sieve, sieveEnd[ using a precomputed pattern, the pattern repeats
+/// every prime bytes: sieve[i] &= pattern[(index + i) % prime].
+/// @pre index < prime and pattern has prime + 64 bytes.
+///
+__attribute__ ((target ("avx2")))
+void andPatternAvx2(byte_t* sieve, byte_t* sieveEnd, const byte_t* pattern, uint_t prime, uint_t index)
+{
+  uint_t step = 64 % prime;
+
+  for (; sieve + 64 <= sieveEnd; sieve += 64)
+  {
+    __m256i* s = reinterpret_cast<__m256i*>(sieve);
+    const __m256i* p = reinterpret_cast<const __m256i*>(&pattern[index]);
+    _mm256_storeu_si256(&s[0], _mm256_and_si256(_mm256_loadu_si256(&s[0]), _mm256_loadu_si256(&p[0])));
+    _mm256_storeu_si256(&s[1], _mm256_and_si256(_mm256_loadu_si256(&s[1]), _mm256_loadu_si256(&p[1])));
+    index += step;
+    if (index >= prime)
+      index -= prime;
+  }
+
+  for (; sieve < sieveEnd; sieve++)
+    *sieve &= pattern[index++];
+}
+
+__attribute__ ((target ("avx512f")))
+void andPatternAvx512(byte_t* sieve, byte_t* sieveEnd, const byte_t* pattern, uint_t prime, uint_t index)
+{
+  uint_t step = 64 % prime;
+
+  for (; sieve + 64 <= sieveEnd; sieve += 64)
+  {
+    __m512i bytes = _mm512_loadu_si512(sieve);
+    __m512i mask = _mm512_loadu_si512(&pattern[index]);
+    _mm512_storeu_si512(sieve, _mm512_and_si512(bytes, mask));
+    index += step;
+    if (index >= prime)
+      index -= prime;
+  }
+
+  for (; sieve < sieveEnd; sieve++)
+    *sieve &= pattern[index++];
+}
+
+#endif
+
+typedef void (*AndPattern_t)(byte_t*, byte_t*, const byte_t*, uint_t, uint_t);
+
+/// Select the pattern kernel at runtime, NULL if the CPU
+/// supports neither AVX-512 nor AVX2. Without SIMD the
+/// patterns are not faster than the modulo 30 wheel.
+///
+AndPattern_t getAndPattern()
+{
+#if defined(ERATSMALL_X86_DISPATCH)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    return andPatternAvx512;
+  if (__builtin_cpu_supports("avx2"))
+    return andPatternAvx2;
+#endif
+  return NULL;
+}
+
+} // namespace
 
 namespace primesieve {
 
@@ -26,21 +105,59 @@ namespace primesieve {
 /// @param limit      Sieving primes in EratSmall must be <= limit.
 ///
 EratSmall::EratSmall(uint64_t stop, uint_t sieveSize, uint_t limit) :
-  Modulo30Wheel_t(stop, sieveSize),
-  limit_(limit)
+  Modulo30Wheel<EratSmall>::type(stop, sieveSize),
+  limit_(limit),
+  andPattern_(getAndPattern())
 {
   if (limit > sieveSize * 3)
     throw primesieve_error("EratSmall: limit must be <= sieveSize * 3");
-  buckets_.push_back(Bucket());
 }
 
-/// Add a new sieving prime to EratSmall
-void EratSmall::storeSievingPrime(uint_t prime, uint_t multipleIndex, uint_t wheelIndex)
+/// The multiples of prime within the sieve array repeat every
+/// prime bytes (30 * prime numbers). Create the pattern by
+/// crossing-off the multiples of prime in a buffer of
+/// 2 * prime + PATTERN_PADDING bytes, starting from the first
+/// multiple's position modulo prime, the bytes from index prime
+/// onwards are the pattern.
+///
+void EratSmall::addPattern(uint_t prime, uint_t multipleIndex, uint_t wheelIndex)
 {
-  assert(prime <= limit_);
-  uint_t sievingPrime = prime / NUMBERS_PER_BYTE;
-  if (!buckets_.back().store(sievingPrime, multipleIndex, wheelIndex))
-    buckets_.push_back(Bucket());
+  std::vector<byte_t> buffer(prime * 2 + PATTERN_PADDING, 0xff);
+  SievingPrime sPrime;
+  sPrime.set(prime / NUMBERS_PER_BYTE, multipleIndex % prime, wheelIndex);
+  crossOff(&buffer[0], &buffer[0] + buffer.size(), &sPrime, &sPrime + 1);
+
+  Pattern pattern;
+  pattern.prime = prime;
+  pattern.offset = static_cast<uint_t>(patternBytes_.size());
+  pattern.index = 0;
+  pattern.start = multipleIndex;
+  patterns_.push_back(pattern);
+  patternBytes_.insert(patternBytes_.end(), buffer.begin() + prime, buffer.end());
+}
+
+/// Remove the multiples of the sieving primes < ERATSMALL_PATTERN_LIMIT,
+/// the patterns are ANDed 32 or 64 bytes at a time (AVX2, AVX-512)
+/// whereas crossOff() unsets 1 bit at a time.
+///
+void EratSmall::crossOffPatterns(byte_t* sieve, byte_t* sieveLimit)
+{
+  uint_t size = static_cast<uint_t>(sieveLimit - sieve);
+
+  for (std::size_t i = 0; i < patterns_.size(); i++)
+  {
+    Pattern& pattern = patterns_[i];
+    uint_t prime = pattern.prime;
+    if (pattern.start < size)
+    {
+      uint_t index = (pattern.index + pattern.start) % prime;
+      andPattern_(&sieve[pattern.start], sieveLimit, &patternBytes_[pattern.offset], prime, index);
+      pattern.start = 0;
+    }
+    else
+      pattern.start -= size;
+    pattern.index = (pattern.index + size) % prime;
+  }
 }
 
 /// Cross-off the multiples of small sieving
@@ -48,21 +165,19 @@ void EratSmall::storeSievingPrime(uint_t prime, uint_t multipleIndex, uint_t whe
 ///
 void EratSmall::crossOff(byte_t* sieve, byte_t* sieveLimit)
 {
-  for (BucketIterator_t iter = buckets_.begin(); iter != buckets_.end(); ++iter)
-    crossOff(sieve, sieveLimit, *iter);
+  crossOffPatterns(sieve, sieveLimit);
+  if (!sievingPrimes_.empty())
+    crossOff(sieve, sieveLimit, &sievingPrimes_[0], &sievingPrimes_[0] + sievingPrimes_.size());
 }
 
-/// Cross-off the multiples of the sieving primes within the current
-/// bucket. This is an implementation of the segmented sieve of
+/// Cross-off the multiples of the sieving primes in [sPrime, sEnd[.
+/// This is an implementation of the segmented sieve of
 /// Eratosthenes with wheel factorization optimized for small sieving
 /// primes that have many multiples per segment. This algorithm uses a
 /// hardcoded modulo 30 wheel that skips multiples of 2, 3 and 5.
 ///
-void EratSmall::crossOff(byte_t* sieve, byte_t* sieveLimit, Bucket& bucket)
+void EratSmall::crossOff(byte_t* sieve, byte_t* sieveLimit, SievingPrime* sPrime, SievingPrime* sEnd)
 {
-  SievingPrime* sPrime = bucket.begin();
-  SievingPrime* sEnd   = bucket.end();
-
   for (; sPrime != sEnd; sPrime++)
   {
     uint_t sievingPrime  = sPrime->getSievingPrime();
@@ -0,0 +1,253 @@
+///
+/// @file   ParallelPrimeSieve-storePrimes.cpp
+/// @brief  Generate the primes within [start, stop] in parallel
+///         using two passes: first the primes of each chunk are
+///         counted (popcount), the prefix sums of the counts are the
+///         positions (ranks) of the first primes of the chunks. Then
+///         the threads generate the primes of their chunks and store
+///         them into disjoint slices of the output or call them back
+///         together with their ranks.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/config.hpp>
+#include <primesieve/ParallelPrimeSieve.hpp>
+#include <primesieve/PrimeSieve.hpp>
+#include <primesieve/Callback.hpp>
+#include <primesieve/EratBig.hpp>
+#include <primesieve/parallel_for.hpp>
+#include <primesieve/primesieve_error.hpp>
+
+#include <stdint.h>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+using namespace primesieve;
+
+namespace {
+
+/// Stores the primes of a chunk into its slice,
+/// starting at position pos.
+///
+class StoreSlice : public SegmentCallback
+{
+public:
+  StoreSlice(PrimeSlices& slices, std::size_t pos) :
+    slices_(slices),
+    pos_(pos)
+  { }
+  void callback(const uint64_t* primes, std::size_t size)
+  {
+    slices_.store(pos_, primes, size);
+    pos_ += size;
+  }
+private:
+  StoreSlice(const StoreSlice&);
+  void operator=(const StoreSlice&);
+  PrimeSlices& slices_;
+  std::size_t pos_;
+};
+
+/// Calls back the primes of a chunk together
+/// with the rank of their first prime.
+///
+class RankChunk : public SegmentCallback
+{
+public:
+  RankChunk(RankCallback& cb, uint64_t rank) :
+    cb_(cb),
+    rank_(rank)
+  { }
+  void callback(const uint64_t* primes, std::size_t size)
+  {
+    cb_.callback(primes, size, rank_);
+    rank_ += size;
+  }
+private:
+  RankChunk(const RankChunk&);
+  void operator=(const RankChunk&);
+  RankCallback& cb_;
+  uint64_t rank_;
+};
+
+/// Sieves the chunks of [start, stop], subclasses
+/// process the primes of the ith chunk.
+///
+class Chunks : public ChunkWork
+{
+public:
+  Chunks(uint64_t start, uint64_t stop, uint64_t chunkSize, int sieveSize) :
+    start_(start),
+    stop_(stop),
+    chunkSize_(chunkSize),
+    sieveSize_(sieveSize)
+  { }
+  void process(int i)
+  {
+    uint64_t chunkStart, chunkStop;
+    getChunk(start_, stop_, chunkSize_, i, &chunkStart, &chunkStop);
+    PrimeSieve ps;
+    ps.setSieveSize(sieveSize_);
+    sieve(ps, i, chunkStart, chunkStop);
+  }
+protected:
+  virtual void sieve(PrimeSieve& ps, int i, uint64_t chunkStart, uint64_t chunkStop) = 0;
+private:
+  uint64_t start_;
+  uint64_t stop_;
+  uint64_t chunkSize_;
+  int sieveSize_;
+};
+
+class CountChunks : public Chunks
+{
+public:
+  CountChunks(uint64_t start, uint64_t stop, uint64_t chunkSize, int sieveSize, std::vector<uint64_t>& counts) :
+    Chunks(start, stop, chunkSize, sieveSize),
+    counts_(counts)
+  { }
+protected:
+  void sieve(PrimeSieve& ps, int i, uint64_t chunkStart, uint64_t chunkStop)
+  {
+    counts_[i + 1] = ps.countPrimes(chunkStart, chunkStop);
+  }
+private:
+  std::vector<uint64_t>& counts_;
+};
+
+/// Store the primes of the ith chunk
+/// into the slice [offsets[i], offsets[i + 1])
+///
+class StoreChunks : public Chunks
+{
+public:
+  StoreChunks(uint64_t start, uint64_t stop, uint64_t chunkSize, int sieveSize, const std::vector<uint64_t>& offsets, PrimeSlices& slices) :
+    Chunks(start, stop, chunkSize, sieveSize),
+    offsets_(offsets),
+    slices_(slices)
+  { }
+protected:
+  void sieve(PrimeSieve& ps, int i, uint64_t chunkStart, uint64_t chunkStop)
+  {
+    StoreSlice slice(slices_, static_cast<std::size_t>(offsets_[i]));
+    ps.callbackPrimes(chunkStart, chunkStop, &slice);
+  }
+private:
+  const std::vector<uint64_t>& offsets_;
+  PrimeSlices& slices_;
+};
+
+class RankChunks : public Chunks
+{
+public:
+  RankChunks(uint64_t start, uint64_t stop, uint64_t chunkSize, int sieveSize, const std::vector<uint64_t>& offsets, uint64_t rank, RankCallback& cb) :
+    Chunks(start, stop, chunkSize, sieveSize),
+    offsets_(offsets),
+    rank_(rank),
+    cb_(cb)
+  { }
+protected:
+  void sieve(PrimeSieve& ps, int i, uint64_t chunkStart, uint64_t chunkStop)
+  {
+    RankChunk chunk(cb_, rank_ + offsets_[i] + 1);
+    ps.callbackPrimes(chunkStart, chunkStop, &chunk);
+  }
+private:
+  const std::vector<uint64_t>& offsets_;
+  uint64_t rank_;
+  RankCallback& cb_;
+};
+
+} // namespace
+
+namespace primesieve {
+
+/// Split [start_, stop_] into chunks and count the primes of
+/// each chunk in parallel.
+/// @param offsets  offsets[i] = number of primes within
+///                 [start_, start of the ith chunk),
+///                 offsets.back() = number of primes within
+///                 [start_, stop_].
+/// @return         The number of threads.
+/// @pre            start_ <= stop_
+///
+int ParallelPrimeSieve::countChunks(uint64_t* chunkSize, std::vector<uint64_t>* offsets)
+{
+  int threads = getNumThreads();
+  if (tooMany(threads))
+    threads = idealNumThreads();
+
+  *chunkSize = getChunkSize(start_, stop_, threads);
+  int size = getNumChunks(start_, stop_, *chunkSize);
+  std::vector<uint64_t>& counts = *offsets;
+  counts.assign(size + 1, 0);
+
+  CountChunks chunks(start_, stop_, *chunkSize, getSieveSize(), counts);
+  parallel_for(size, threads, isNuma(), chunks);
+
+  for (int i = 0; i < size; i++)
+    counts[i + 1] += counts[i];
+
+  return threads;
+}
+
+/// Store the primes within [start, stop] into slices. Unlike
+/// callbackPrimes() the threads are not synchronized, each
+/// thread stores the primes of its chunks without locking.
+/// @pre stop <= 2^64 - 2^32 * 10
+///
+void ParallelPrimeSieve::storePrimes(uint64_t start, uint64_t stop, PrimeSlices* slices)
+{
+  setStart(start);
+  setStop(stop);
+  if (start > stop)
+  {
+    slices->resize(0);
+    return;
+  }
+
+  // reuse the bucket memory of the count pass
+  BucketPool pool;
+  uint64_t chunkSize;
+  std::vector<uint64_t> offsets;
+  int threads = countChunks(&chunkSize, &offsets);
+  int size = static_cast<int>(offsets.size() - 1);
+
+  if (offsets.back() > std::numeric_limits<std::size_t>::max())
+    throw primesieve_error("too many primes to store");
+  slices->resize(static_cast<std::size_t>(offsets.back()));
+
+  StoreChunks chunks(start, stop, chunkSize, getSieveSize(), offsets, *slices);
+  parallel_for(size, threads, isNuma(), chunks);
+}
+
+/// Call back the primes within [start, stop] in chunks together
+/// with the rank of the first prime of each chunk. The threads
+/// are not synchronized, cb is called back concurrently.
+/// @param rank  Number of primes < start.
+/// @pre   stop  <= 2^64 - 2^32 * 10
+///
+void ParallelPrimeSieve::callbackPrimes(uint64_t start, uint64_t stop, uint64_t rank, RankCallback* cb)
+{
+  setStart(start);
+  setStop(stop);
+  if (start > stop)
+    return;
+
+  // reuse the bucket memory of the count pass
+  BucketPool pool;
+  uint64_t chunkSize;
+  std::vector<uint64_t> offsets;
+  int threads = countChunks(&chunkSize, &offsets);
+  int size = static_cast<int>(offsets.size() - 1);
+
+  RankChunks chunks(start, stop, chunkSize, getSieveSize(), offsets, rank, *cb);
+  parallel_for(size, threads, isNuma(), chunks);
+}
+
+} // namespace primesieve
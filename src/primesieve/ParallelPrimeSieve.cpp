@@ -13,8 +13,12 @@
 #include <primesieve/ParallelPrimeSieve.hpp>
 #include <primesieve/PrimeSieve.hpp>
 #include <primesieve/pmath.hpp>
+#include <primesieve/cpu_count.hpp>
+#include <primesieve/numa.hpp>
+#include <primesieve/EratBig.hpp>
 
 #include <stdint.h>
+#include <cstddef>
 #include <cstdlib>
 #include <cassert>
 #include <algorithm>
@@ -29,7 +33,10 @@ namespace primesieve {
 ParallelPrimeSieve::ParallelPrimeSieve() :
   lock_(NULL),
   shm_(NULL),
-  numThreads_(IDEAL_NUM_THREADS)
+  numThreads_(IDEAL_NUM_THREADS),
+  numa_(false),
+  minSteal_(0),
+  startTime_(0)
 { }
 
 void ParallelPrimeSieve::init(SharedMemory& shm)
@@ -56,6 +63,22 @@ void ParallelPrimeSieve::setNumThreads(int threads)
     numThreads_ = getInBetween(1, numThreads_, getMaxThreads());
 }
 
+bool ParallelPrimeSieve::isNuma() const
+{
+  return numa_;
+}
+
+/// Enable NUMA-aware thread placement: the threads are spread
+/// round-robin across the NUMA nodes and pinned to their node.
+/// As each thread allocates its sieve array and buckets itself,
+/// the memory is allocated from the thread's local NUMA node.
+/// Has no effect on non-NUMA systems.
+///
+void ParallelPrimeSieve::setNuma(bool numa)
+{
+  numa_ = numa;
+}
+
 /// Get an ideal number of threads for the current
 /// set start_ and stop_ numbers.
 ///
@@ -65,25 +88,22 @@ int ParallelPrimeSieve::idealNumThreads() const
     return 1;
   uint64_t threshold = std::max(config::MIN_THREAD_INTERVAL, isqrt(stop_) / 5);
   uint64_t threads = getInterval() / threshold;
-  threads = getInBetween<uint64_t>(1, threads, getMaxThreads());
+  threads = getInBetween<uint64_t>(1, threads, getAvailableThreads());
   return static_cast<int>(threads);
 }
 
-/// Get an interval size that ensures a good load balance
-/// when multiple threads are used.
+/// Get the number of threads used by default, this is
+/// getMaxThreads() limited by the CPU cores the process is
+/// allowed to use (CPU affinity mask, cgroup CPU quota).
+/// setNumThreads() may still be used to run more threads.
 ///
-uint64_t ParallelPrimeSieve::getThreadInterval(int threads) const
+int ParallelPrimeSieve::getAvailableThreads()
 {
-  assert(threads > 0);
-  uint64_t unbalanced = getInterval() / threads;
-  uint64_t balanced = isqrt(stop_) * 1000;
-  uint64_t fastest = std::min(balanced, unbalanced);
-  uint64_t threadInterval = getInBetween(config::MIN_THREAD_INTERVAL, fastest, config::MAX_THREAD_INTERVAL);
-  uint64_t chunks = getInterval() / threadInterval;
-  if (chunks < threads * 5u)
-    threadInterval = std::max(config::MIN_THREAD_INTERVAL, unbalanced);
-  threadInterval += 30 - threadInterval % 30;
-  return threadInterval;
+  int threads = getMaxThreads();
+  int cpus = getAvailableCpus();
+  if (cpus > 0)
+    threads = std::min(threads, cpus);
+  return threads;
 }
 
 /// Align n to modulo 30 + 2 to prevent prime k-tuplet
@@ -114,6 +134,156 @@ double ParallelPrimeSieve::getWallTime() const
   return omp_get_wtime();
 }
 
+/// Split [start_, stop_] into one contiguous stripe per thread.
+/// Each thread sieves its stripe using a single PrimeSieve object
+/// so that the sieving primes <= sqrt(stop) are initialized only
+/// once per stripe. Threads that run out of work steal the end of
+/// another thread's stripe, see steal(int).
+///
+void ParallelPrimeSieve::initStripes(int threads)
+{
+  assert(threads > 0);
+  uint64_t interval = getInterval() / threads;
+  minSteal_ = std::max(config::MIN_THREAD_INTERVAL, isqrt(stop_) * 100);
+  startTime_ = getWallTime();
+  stripes_.resize(threads);
+
+  for (int i = 0; i < threads; i++) {
+    uint64_t threadStart = align(start_ + interval * i);
+    uint64_t threadStop = align(start_ + interval * (i + 1));
+    if (i == threads - 1)
+      threadStop = stop_;
+    newStripe(i, threadStart, threadStop);
+    stripes_[i].processed = 0;
+  }
+}
+
+void ParallelPrimeSieve::newStripe(int threadNum, uint64_t threadStart, uint64_t threadStop)
+{
+  Stripe& stripe = stripes_[threadNum];
+  stripe.start = threadStart;
+  stripe.stop = threadStop;
+  // the first segment is sieved before it is reserved
+  stripe.reserved = threadStart + getSieveSize() * 1024 * NUMBERS_PER_BYTE;
+  stripe.isNew = true;
+}
+
+/// Get the sieving speed (numbers per second) of threadNum.
+double ParallelPrimeSieve::getThroughput(int threadNum, double time) const
+{
+  const Stripe& stripe = stripes_[threadNum];
+  double seconds = time - startTime_;
+  uint64_t sieved = std::min(stripe.reserved, stripe.stop) - stripe.start;
+  if (stripe.isNew || stripe.reserved < stripe.start)
+    sieved = 0;
+  if (seconds <= 0)
+    return 0;
+  return (stripe.processed + sieved) / seconds;
+}
+
+/// Steal the end of the stripe of the thread that is expected to
+/// finish last. The remaining work is split in proportion to the
+/// measured throughput of both threads so that they finish at about
+/// the same time, stripes that have not been started are taken
+/// entirely.
+/// @return false if there is no more work.
+///
+bool ParallelPrimeSieve::steal(int threadNum)
+{
+  double time = getWallTime();
+  double speed = getThroughput(threadNum, time);
+  double maxSeconds = 0;
+  int victim = -1;
+  uint64_t victimStop = 0;
+
+  for (int i = 0; i < static_cast<int>(stripes_.size()); i++) {
+    Stripe& stripe = stripes_[i];
+    if (i == threadNum || stripe.stop <= stripe.start)
+      continue;
+    if (stripe.isNew) {
+      victim = i;
+      victimStop = stripe.start;
+      break;
+    }
+    if (stripe.reserved >= stripe.stop)
+      continue;
+    uint64_t remaining = stripe.stop - stripe.reserved;
+    double victimSpeed = getThroughput(i, time);
+    if (victimSpeed <= 0) victimSpeed = std::max(speed, 1.0);
+    double thiefSpeed = (speed > 0) ? speed : victimSpeed;
+    double seconds = remaining / victimSpeed;
+    uint64_t keep = static_cast<uint64_t>(remaining * (victimSpeed / (victimSpeed + thiefSpeed)));
+    uint64_t newStop = align(stripe.reserved + keep);
+    if (newStop < stripe.stop &&
+        stripe.stop - newStop >= minSteal_ &&
+        seconds > maxSeconds) {
+      maxSeconds = seconds;
+      victim = i;
+      victimStop = newStop;
+    }
+  }
+
+  if (victim < 0)
+    return false;
+
+  Stripe& stripe = stripes_[victim];
+  newStripe(threadNum, victimStop, stripe.stop);
+  stripe.stop = victimStop;
+  return true;
+}
+
+/// Get the next stripe [threadStart, threadStop] of threadNum,
+/// this is either its initial stripe or the end of
+/// another thread's stripe.
+/// @return false if there is no more work.
+///
+bool ParallelPrimeSieve::nextStripe(int threadNum, uint64_t* threadStart, uint64_t* threadStop)
+{
+  bool isStripe = false;
+
+  #pragma omp critical (primesieve_schedule)
+  {
+    Stripe& stripe = stripes_[threadNum];
+    // previous stripe finished or initial
+    // stripe taken by another thread
+    if (!stripe.isNew || stripe.stop <= stripe.start) {
+      if (!stripe.isNew)
+        stripe.processed += stripe.stop - stripe.start;
+      stripe.start = stripe.stop;
+      stripe.reserved = stripe.stop;
+      stripe.isNew = false;
+      steal(threadNum);
+    }
+    if (stripe.isNew && stripe.stop > stripe.start) {
+      stripe.isNew = false;
+      *threadStart = stripe.start;
+      *threadStop = stripe.stop;
+      isStripe = true;
+    }
+  }
+
+  return isStripe;
+}
+
+/// Called by the child PrimeSieve of threadNum before sieving its
+/// next segment, see PrimeFinder::reserveNextSegment().
+/// @return  The stop number of the child, the end of its
+///          stripe may have been stolen in the meantime.
+///
+uint64_t ParallelPrimeSieve::reserve(uint64_t segmentHigh, int threadNum)
+{
+  uint64_t stop;
+
+  #pragma omp critical (primesieve_schedule)
+  {
+    Stripe& stripe = stripes_[threadNum];
+    stripe.reserved = std::max(stripe.reserved, segmentHigh);
+    stop = stripe.stop;
+  }
+
+  return stop;
+}
+
 /// Sieve the primes and prime k-tuplets within [start_, stop_]
 /// in parallel using OpenMP multi-threading.
 ///
@@ -122,6 +292,8 @@ void ParallelPrimeSieve::sieve()
   reset();
   if (start_ > stop_)
     return;
+  if (countIndexed())
+    return;
   OmpInitLock ompInit(&lock_);
 
   int threads = getNumThreads();
@@ -131,51 +303,40 @@ void ParallelPrimeSieve::sieve()
   if (threads == 1)
     PrimeSieve::sieve();
   else {
-    uint64_t threadInterval = getThreadInterval(threads);
     uint64_t count0 = 0, count1 = 0, count2 = 0, count3 = 0, count4 = 0, count5 = 0, count6 = 0;
+    // read the NUMA topology before pinning any thread
+    bool numa = isNuma() && getNumaNodes() > 1;
+    // reuse the bucket memory of the stripes
+    BucketPool pool;
     double t1 = getWallTime();
+    initStripes(threads);
 
-#if _OPENMP >= 200800 /* OpenMP >= 3.0 (2008) */
-
-    #pragma omp parallel for schedule(dynamic) num_threads(threads) \
-      reduction(+: count0, count1, count2, count3, count4, count5, count6)
-    for (uint64_t n = start_; n < stop_; n += threadInterval) {
-      PrimeSieve ps(*this, omp_get_thread_num());
-      uint64_t threadStart = align(n);
-      uint64_t threadStop  = align(n + threadInterval);
-      ps.sieve(threadStart, threadStop);
-      count0 += ps.getCount(0);
-      count1 += ps.getCount(1);
-      count2 += ps.getCount(2);
-      count3 += ps.getCount(3);
-      count4 += ps.getCount(4);
-      count5 += ps.getCount(5);
-      count6 += ps.getCount(6);
-    }
-
-#else /* OpenMP 2.x */
-
-    int64_t iters = 1 + (getInterval() - 1) / threadInterval;
-
-    #pragma omp parallel for schedule(dynamic) num_threads(threads) \
+    #pragma omp parallel num_threads(threads) \
       reduction(+: count0, count1, count2, count3, count4, count5, count6)
-    for (int64_t i = 0; i < iters; i++) {
-      PrimeSieve ps(*this, omp_get_thread_num());
-      uint64_t n = start_ + i * threadInterval;
-      uint64_t threadStart = align(n);
-      uint64_t threadStop  = align(n + threadInterval);
-      ps.sieve(threadStart, threadStop);
-      count0 += ps.getCount(0);
-      count1 += ps.getCount(1);
-      count2 += ps.getCount(2);
-      count3 += ps.getCount(3);
-      count4 += ps.getCount(4);
-      count5 += ps.getCount(5);
-      count6 += ps.getCount(6);
+    {
+      int threadNum = omp_get_thread_num();
+      NumaAffinity affinity(threadNum, numa);
+      uint64_t threadStart;
+      uint64_t threadStop;
+
+      while (nextStripe(threadNum, &threadStart, &threadStop)) {
+        PrimeSieve ps(*this, threadNum);
+        ps.sieve(threadStart, threadStop);
+        count0 += ps.getCount(0);
+        count1 += ps.getCount(1);
+        count2 += ps.getCount(2);
+        count3 += ps.getCount(3);
+        count4 += ps.getCount(4);
+        count5 += ps.getCount(5);
+        count6 += ps.getCount(6);
+        if (isHistogram())
+        {
+          #pragma omp critical (primesieve_histogram)
+          addHistogram(ps);
+        }
+      }
     }
 
-#endif
-
     seconds_ = getWallTime() - t1;
     counts_[0] = count0;
     counts_[1] = count1;
@@ -253,6 +414,11 @@ void ParallelPrimeSieve::setLock() { }
 
 void ParallelPrimeSieve::unsetLock() { }
 
+uint64_t ParallelPrimeSieve::reserve(uint64_t segmentHigh, int threadNum)
+{
+  return PrimeSieve::reserve(segmentHigh, threadNum);
+}
+
 #endif
 
 } // namespace primesieve
@@ -0,0 +1,453 @@
+///
+/// @file   PiTable.cpp
+/// @brief  Embedded prime counts of the intervals
+///         ]k * 2^32, (k + 1) * 2^32] for k = 0 to 2^11 - 1,
+///         calculated using pi_lmo().
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/PiTable.hpp>
+#include <primesieve/PrimeSieve.hpp>
+#include <primesieve/pi_lmo.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+using namespace primesieve;
+
+namespace {
+
+/// primeCounts[k] = pi((k + 1) * 2^32) - pi(k * 2^32)
+const uint32_t primeCounts[PiTable::MAX_INDEX] =
+{
+  203280221, 190335585, 186011076, 183312229, 181354450, 179823053,
+  178574138, 177515527, 176604424, 175793592, 175076945, 174431558,
+  173844324, 173300945, 172802161, 172338287, 171909681, 171509186,
+  171120893, 170769615, 170424690, 170109908, 169802385, 169511048,
+  169221723, 168963832, 168713889, 168458965, 168236691, 167998224,
+  167785289, 167567814, 167367054, 167171834, 166980521, 166785589,
+  166618356, 166436292, 166266041, 166109812, 165940937, 165792568,
+  165633085, 165486196, 165341624, 165202558, 165072535, 164920761,
+  164798935, 164662147, 164544420, 164415690, 164297603, 164169491,
+  164072993, 163953341, 163830915, 163723491, 163616590, 163513129,
+  163411306, 163306813, 163209429, 163111768, 163012428, 162917505,
+  162824025, 162730542, 162640669, 162555491, 162464856, 162377998,
+  162290437, 162213057, 162129033, 162046564, 161972453, 161881500,
+  161801007, 161727041, 161655763, 161582338, 161498677, 161430442,
+  161354866, 161289736, 161218432, 161145872, 161084356, 161000490,
+  160946928, 160880139, 160804701, 160743773, 160690255, 160618324,
+  160559983, 160496310, 160437652, 160371406, 160325842, 160256864,
+  160194867, 160134859, 160084728, 160019918, 159967362, 159915558,
+  159855697, 159803790, 159746809, 159694608, 159638520, 159589620,
+  159542815, 159481800, 159434369, 159385738, 159336126, 159286539,
+  159238906, 159180948, 159146055, 159092095, 159050314, 158992202,
+  158949878, 158899902, 158857316, 158812835, 158771128, 158717885,
+  158678199, 158632383, 158588179, 158549646, 158491417, 158462958,
+  158419324, 158380167, 158331681, 158287446, 158250517, 158212382,
+  158168011, 158131089, 158087160, 158058274, 158006866, 157980775,
+  157928849, 157900294, 157854088, 157814144, 157787847, 157742631,
+  157710190, 157675431, 157626565, 157592315, 157565522, 157526896,
+  157485515, 157461403, 157415855, 157371726, 157346923, 157317470,
+  157284496, 157250993, 157213716, 157181521, 157151206, 157114698,
+  157086640, 157040926, 157016085, 156979097, 156954328, 156920089,
+  156881745, 156858602, 156809833, 156788442, 156766130, 156723745,
+  156698151, 156673399, 156640732, 156606501, 156582533, 156544020,
+  156516109, 156484710, 156459167, 156427148, 156398991, 156374765,
+  156336388, 156320980, 156275841, 156254619, 156239809, 156197126,
+  156174989, 156142645, 156119093, 156089246, 156056466, 156040012,
+  156002670, 155986527, 155957083, 155934225, 155900707, 155874609,
+  155846419, 155823929, 155805943, 155775740, 155750093, 155720644,
+  155696464, 155663978, 155650102, 155614477, 155595038, 155570511,
+  155541406, 155525237, 155493420, 155475038, 155450746, 155417624,
+  155398311, 155379108, 155350796, 155324592, 155301724, 155277649,
+  155252198, 155237545, 155213221, 155192428, 155165465, 155144489,
+  155122799, 155099878, 155076162, 155053587, 155027296, 155006466,
+  154991089, 154956314, 154947036, 154915029, 154896242, 154867078,
+  154858615, 154829675, 154807819, 154790364, 154773307, 154743223,
+  154725985, 154704526, 154691287, 154664166, 154647196, 154630495,
+  154601924, 154581908, 154556681, 154533198, 154518011, 154488892,
+  154483450, 154462117, 154431677, 154425177, 154408805, 154368838,
+  154366988, 154340362, 154319611, 154302491, 154280253, 154262707,
+  154238496, 154230859, 154208933, 154180178, 154168589, 154147978,
+  154126680, 154110731, 154090079, 154075159, 154054581, 154037888,
+  154006608, 154003330, 153976722, 153961649, 153943590, 153922456,
+  153906782, 153893400, 153876567, 153854123, 153836880, 153827385,
+  153799491, 153784665, 153759972, 153743528, 153738469, 153722252,
+  153695855, 153681482, 153672897, 153645487, 153626952, 153602125,
+  153597181, 153574248, 153562912, 153540061, 153527296, 153511616,
+  153489107, 153488929, 153463802, 153443330, 153429480, 153409901,
+  153397556, 153386518, 153363508, 153338101, 153334570, 153310858,
+  153292642, 153282958, 153266508, 153246465, 153242087, 153224329,
+  153203678, 153179498, 153177100, 153154738, 153144506, 153124379,
+  153108244, 153102935, 153073474, 153064066, 153045418, 153038181,
+  153018495, 153005277, 152985984, 152979870, 152960245, 152947799,
+  152916736, 152915226, 152898909, 152881627, 152874087, 152845194,
+  152841595, 152826917, 152796990, 152805835, 152781406, 152769454,
+  152747084, 152737106, 152716518, 152723542, 152705171, 152683441,
+  152654131, 152665416, 152631226, 152621454, 152623141, 152601947,
+  152567147, 152579085, 152558899, 152543281, 152530418, 152523595,
+  152492966, 152496433, 152471401, 152462491, 152444665, 152431805,
+  152425622, 152405430, 152384583, 152371667, 152375242, 152349331,
+  152342292, 152335432, 152323923, 152299464, 152288238, 152269727,
+  152261205, 152247730, 152244170, 152229537, 152211359, 152194178,
+  152191619, 152168193, 152160098, 152145657, 152136772, 152124661,
+  152113052, 152084114, 152090657, 152064216, 152060140, 152047244,
+  152033057, 152018024, 152003601, 151989280, 151991947, 151961855,
+  151958420, 151944257, 151935182, 151916391, 151917853, 151890287,
+  151887289, 151863868, 151858223, 151850898, 151837091, 151830204,
+  151818500, 151808106, 151782155, 151767797, 151771199, 151759485,
+  151740001, 151735607, 151714382, 151707179, 151692791, 151697763,
+  151669850, 151654789, 151648653, 151646052, 151623389, 151629398,
+  151599471, 151598639, 151577367, 151566961, 151557307, 151545940,
+  151543415, 151530890, 151516267, 151494377, 151495164, 151479218,
+  151461084, 151462804, 151450692, 151427076, 151421326, 151419240,
+  151396728, 151396650, 151378388, 151360919, 151357046, 151350372,
+  151327185, 151323327, 151317978, 151309558, 151288705, 151292636,
+  151274483, 151256555, 151243934, 151233854, 151233758, 151219709,
+  151203893, 151197478, 151188002, 151180502, 151158800, 151151421,
+  151144942, 151128128, 151118963, 151121004, 151103539, 151093288,
+  151087138, 151064936, 151057194, 151056366, 151042990, 151032490,
+  151032594, 150999297, 151003162, 151003812, 150975754, 150974294,
+  150966968, 150950083, 150941658, 150930349, 150927041, 150907709,
+  150898280, 150891742, 150880283, 150871156, 150859428, 150844790,
+  150842798, 150829784, 150830232, 150806769, 150804619, 150783569,
+  150792693, 150778905, 150766948, 150750550, 150742505, 150739217,
+  150726313, 150719280, 150704674, 150693746, 150700975, 150682804,
+  150669983, 150656440, 150650189, 150643723, 150632481, 150625091,
+  150611836, 150602600, 150591599, 150578159, 150578422, 150566240,
+  150554431, 150547478, 150542391, 150527725, 150513931, 150511611,
+  150502497, 150495327, 150485745, 150477324, 150460608, 150458759,
+  150445882, 150440216, 150431663, 150416852, 150417847, 150403760,
+  150391011, 150378260, 150385049, 150367583, 150357621, 150344389,
+  150337515, 150326014, 150326777, 150307808, 150306388, 150292133,
+  150286063, 150278542, 150268831, 150261548, 150246193, 150247606,
+  150238552, 150219242, 150218496, 150204641, 150200159, 150193182,
+  150183970, 150171373, 150161183, 150159829, 150143373, 150137514,
+  150145774, 150117786, 150115047, 150107163, 150090889, 150094330,
+  150089547, 150073773, 150062438, 150057332, 150047513, 150037489,
+  150026913, 150021050, 150015067, 150005915, 149998277, 149982932,
+  149986319, 149978704, 149965596, 149962636, 149955321, 149937858,
+  149933293, 149926920, 149910254, 149913192, 149900203, 149890450,
+  149881997, 149873895, 149864482, 149847149, 149855327, 149849499,
+  149833884, 149826595, 149824084, 149806982, 149796127, 149794926,
+  149788415, 149778607, 149761535, 149767355, 149756205, 149743098,
+  149747895, 149734784, 149727899, 149721183, 149716171, 149700689,
+  149691108, 149677184, 149675295, 149676019, 149659979, 149659317,
+  149645822, 149640090, 149634372, 149623575, 149615737, 149611889,
+  149598470, 149594565, 149590082, 149583165, 149570336, 149562808,
+  149548358, 149547843, 149530324, 149532724, 149526244, 149518273,
+  149513344, 149500613, 149492660, 149491785, 149477257, 149476279,
+  149462384, 149458013, 149455826, 149455605, 149440738, 149426866,
+  149417422, 149407501, 149410098, 149396557, 149390306, 149389367,
+  149386565, 149361245, 149370655, 149356263, 149352348, 149343635,
+  149334158, 149332273, 149323608, 149316583, 149291463, 149301596,
+  149287123, 149290694, 149263680, 149272409, 149260499, 149256663,
+  149254029, 149249026, 149233244, 149230231, 149220569, 149223332,
+  149203093, 149200602, 149200739, 149189655, 149190405, 149162099,
+  149160183, 149157349, 149144141, 149145559, 149142489, 149125067,
+  149119144, 149122838, 149106226, 149104062, 149095203, 149085764,
+  149084739, 149077070, 149069785, 149062620, 149058397, 149048762,
+  149036334, 149030992, 149022148, 149020591, 149011759, 149010623,
+  149001011, 148992998, 148990148, 148976941, 148975400, 148975692,
+  148954345, 148955554, 148947586, 148944335, 148930667, 148914679,
+  148923903, 148923319, 148909321, 148898927, 148890533, 148890366,
+  148886754, 148873978, 148864832, 148857594, 148848602, 148849215,
+  148850129, 148823393, 148827761, 148821848, 148817895, 148810412,
+  148809326, 148801368, 148790621, 148792693, 148774226, 148765449,
+  148765218, 148752927, 148750023, 148738908, 148744158, 148730495,
+  148730820, 148724326, 148711037, 148708783, 148704839, 148691937,
+  148691618, 148685705, 148668375, 148666734, 148664221, 148653128,
+  148647957, 148644998, 148641217, 148629808, 148628295, 148613003,
+  148615525, 148610646, 148600397, 148597973, 148583038, 148585050,
+  148581500, 148562767, 148563152, 148548501, 148548302, 148544823,
+  148536202, 148534974, 148525191, 148529597, 148504070, 148509498,
+  148503054, 148503824, 148483233, 148488623, 148472151, 148472659,
+  148475697, 148455252, 148450130, 148447765, 148446063, 148428558,
+  148426126, 148419757, 148422188, 148402577, 148405078, 148410237,
+  148399380, 148382000, 148388740, 148378491, 148375578, 148366338,
+  148355247, 148350983, 148346434, 148335292, 148338898, 148333934,
+  148313492, 148321360, 148307969, 148302203, 148295398, 148290158,
+  148291166, 148296972, 148279294, 148276887, 148270098, 148258367,
+  148261124, 148246887, 148245510, 148234867, 148233797, 148220181,
+  148225771, 148209770, 148205316, 148209096, 148191107, 148193782,
+  148185428, 148176430, 148173942, 148166829, 148161731, 148159316,
+  148152443, 148146385, 148138343, 148129266, 148140518, 148122060,
+  148126494, 148115182, 148102820, 148106786, 148095884, 148096969,
+  148085267, 148077214, 148075785, 148075601, 148063647, 148049226,
+  148049872, 148043441, 148043991, 148041071, 148026935, 148030283,
+  148016853, 148011737, 148004718, 147992533, 147992431, 147995455,
+  147973673, 147977993, 147971219, 147969389, 147974420, 147952475,
+  147944200, 147959282, 147944208, 147934001, 147921951, 147925063,
+  147922103, 147907593, 147905903, 147907569, 147892253, 147891231,
+  147893749, 147880659, 147888604, 147877176, 147872827, 147861155,
+  147854813, 147864337, 147844177, 147835180, 147835058, 147831574,
+  147831992, 147832091, 147810899, 147810204, 147799373, 147787991,
+  147795187, 147786081, 147778357, 147773671, 147774929, 147762511,
+  147764771, 147752895, 147746645, 147754202, 147741061, 147744359,
+  147732464, 147729587, 147726987, 147718066, 147711165, 147704178,
+  147699288, 147701516, 147681492, 147685455, 147679108, 147682663,
+  147663548, 147660068, 147659290, 147649381, 147648807, 147644969,
+  147639466, 147635887, 147627967, 147622497, 147623003, 147615808,
+  147606251, 147606471, 147591049, 147587063, 147591662, 147585768,
+  147583516, 147571478, 147576408, 147566507, 147561373, 147555409,
+  147553468, 147545915, 147549179, 147538627, 147540310, 147528210,
+  147509458, 147514416, 147499777, 147511650, 147497521, 147493224,
+  147492922, 147488053, 147477624, 147478556, 147466735, 147467275,
+  147463733, 147455944, 147451959, 147450291, 147443871, 147435466,
+  147435300, 147419838, 147409825, 147417468, 147411651, 147396060,
+  147393926, 147393716, 147389447, 147389121, 147384018, 147389546,
+  147367551, 147365341, 147360410, 147358098, 147348853, 147348852,
+  147351174, 147337884, 147337199, 147328920, 147317627, 147317349,
+  147320960, 147311210, 147301526, 147314190, 147295542, 147291979,
+  147279108, 147293096, 147270880, 147281203, 147266885, 147258692,
+  147266171, 147260262, 147253003, 147246932, 147247321, 147233859,
+  147236026, 147226152, 147225063, 147211618, 147217543, 147212268,
+  147203837, 147205830, 147196512, 147191102, 147183741, 147178566,
+  147175160, 147178424, 147165021, 147162320, 147155447, 147147897,
+  147150162, 147145125, 147144240, 147136381, 147130764, 147129224,
+  147117924, 147105929, 147105147, 147115012, 147095311, 147109842,
+  147090354, 147084106, 147085334, 147082742, 147084642, 147067950,
+  147062274, 147063097, 147058393, 147046905, 147047598, 147034524,
+  147042441, 147046497, 147039266, 147032322, 147030142, 147024545,
+  147009871, 147013914, 147013895, 147010013, 146996574, 146986331,
+  146983605, 146980382, 146979477, 146979985, 146969946, 146967259,
+  146950954, 146952039, 146944737, 146949508, 146940174, 146939303,
+  146934698, 146935748, 146923474, 146923009, 146917731, 146913639,
+  146911988, 146898876, 146896746, 146905010, 146895210, 146888362,
+  146879159, 146878063, 146875790, 146873226, 146862853, 146870465,
+  146857008, 146855638, 146836783, 146836611, 146845878, 146845836,
+  146826559, 146834563, 146824999, 146808984, 146814618, 146810433,
+  146807896, 146799950, 146805538, 146791520, 146790225, 146788013,
+  146781191, 146779710, 146775911, 146764125, 146760142, 146755655,
+  146752895, 146754305, 146742422, 146748542, 146734036, 146732044,
+  146739546, 146720274, 146720105, 146719532, 146720868, 146709356,
+  146701374, 146698508, 146698285, 146692347, 146693658, 146679427,
+  146682814, 146674200, 146671935, 146669692, 146664886, 146656610,
+  146648436, 146654456, 146658696, 146641414, 146635907, 146631647,
+  146632270, 146628692, 146624156, 146616825, 146612230, 146603806,
+  146604939, 146610347, 146589614, 146601530, 146584960, 146587643,
+  146586233, 146576827, 146574647, 146569994, 146566782, 146561384,
+  146555316, 146553381, 146546538, 146544329, 146541587, 146534981,
+  146530649, 146525230, 146530092, 146521325, 146520580, 146512724,
+  146509542, 146504626, 146499221, 146489393, 146486595, 146489139,
+  146484717, 146478604, 146479207, 146468238, 146473571, 146463465,
+  146462712, 146459949, 146446298, 146454843, 146456749, 146438163,
+  146433329, 146442820, 146424239, 146422992, 146429298, 146426606,
+  146416140, 146421102, 146401474, 146407156, 146395111, 146402684,
+  146388772, 146394915, 146376787, 146376017, 146376436, 146378432,
+  146356951, 146364114, 146361314, 146350093, 146350929, 146355774,
+  146337754, 146350046, 146337172, 146338613, 146334561, 146329805,
+  146317738, 146320105, 146313851, 146304890, 146310007, 146294341,
+  146293568, 146301514, 146294269, 146293307, 146288371, 146267634,
+  146274422, 146287957, 146272099, 146268338, 146262565, 146254157,
+  146254212, 146258374, 146243396, 146243111, 146231732, 146238726,
+  146228747, 146228090, 146231600, 146222777, 146212150, 146213675,
+  146202843, 146197310, 146202259, 146203912, 146190757, 146192558,
+  146189075, 146183021, 146179769, 146180499, 146171188, 146166971,
+  146158839, 146158777, 146151725, 146145150, 146148875, 146151140,
+  146139596, 146141976, 146129235, 146133564, 146127711, 146114495,
+  146127267, 146117777, 146114199, 146121393, 146096664, 146106535,
+  146101380, 146096689, 146082980, 146087004, 146092733, 146075052,
+  146078758, 146075838, 146072477, 146059439, 146065467, 146059012,
+  146054100, 146063979, 146048219, 146044494, 146022061, 146042048,
+  146031876, 146029011, 146026451, 146028684, 146013663, 146016697,
+  146004787, 146009419, 146006388, 145997497, 145990504, 146003493,
+  145981757, 145987325, 145983283, 145978638, 145981999, 145968161,
+  145962033, 145962744, 145964353, 145959250, 145950748, 145952395,
+  145947004, 145930342, 145939061, 145949849, 145932146, 145930271,
+  145928279, 145927307, 145919153, 145912473, 145909622, 145909120,
+  145901739, 145905820, 145895307, 145885099, 145894849, 145880112,
+  145883277, 145879690, 145873899, 145882291, 145867630, 145873669,
+  145867126, 145869462, 145860371, 145852811, 145855478, 145845567,
+  145836172, 145839818, 145835122, 145830863, 145827174, 145824928,
+  145817233, 145814671, 145820897, 145825256, 145807557, 145808435,
+  145801503, 145786276, 145800493, 145784587, 145772282, 145794270,
+  145784928, 145784269, 145771942, 145770929, 145774628, 145767664,
+  145758001, 145760083, 145749144, 145743278, 145745988, 145748420,
+  145745744, 145750675, 145740546, 145727993, 145728852, 145726605,
+  145715268, 145713777, 145707838, 145708575, 145703549, 145698154,
+  145702441, 145695072, 145684727, 145689049, 145686643, 145672822,
+  145675313, 145688605, 145675937, 145677500, 145676130, 145662992,
+  145657174, 145657414, 145646862, 145652074, 145650428, 145645574,
+  145638085, 145633320, 145639008, 145626942, 145630962, 145627762,
+  145624376, 145619641, 145621254, 145606461, 145607920, 145608879,
+  145600736, 145597392, 145595905, 145583126, 145589105, 145588477,
+  145587893, 145578491, 145568112, 145577475, 145565266, 145571661,
+  145559402, 145557494, 145554583, 145550130, 145555254, 145546747,
+  145546846, 145528946, 145526565, 145530353, 145531559, 145530565,
+  145517216, 145522410, 145517470, 145515748, 145509614, 145511586,
+  145507009, 145504088, 145502424, 145483904, 145492676, 145480440,
+  145486202, 145480278, 145465147, 145484423, 145479824, 145472047,
+  145471549, 145461585, 145460382, 145446612, 145449153, 145454034,
+  145438481, 145428568, 145450512, 145438165, 145439497, 145430154,
+  145427793, 145429056, 145422714, 145415980, 145416259, 145412291,
+  145397033, 145410116, 145402354, 145391356, 145397146, 145391790,
+  145388066, 145385154, 145383544, 145383065, 145381017, 145374056,
+  145368200, 145373067, 145361557, 145365032, 145358882, 145351774,
+  145341154, 145347437, 145346963, 145343837, 145337069, 145327991,
+  145338387, 145325532, 145328312, 145308949, 145333176, 145323473,
+  145311426, 145313230, 145317853, 145300933, 145294748, 145292297,
+  145302154, 145284336, 145282297, 145286547, 145287417, 145285398,
+  145270923, 145276602, 145274600, 145267979, 145264619, 145257814,
+  145257795, 145264607, 145253270, 145258466, 145246671, 145247366,
+  145244162, 145234507, 145231656, 145222233, 145231399, 145225183,
+  145226521, 145212862, 145218064, 145219103, 145214413, 145212376,
+  145202839, 145198928, 145205174, 145195326, 145195066, 145185710,
+  145191055, 145190712, 145179915, 145175885, 145174481, 145176437,
+  145172892, 145169062, 145165166, 145157487, 145152348, 145163920,
+  145142458, 145158952, 145150030, 145135018, 145141513, 145144191,
+  145125601, 145129780, 145125568, 145124341, 145130348, 145122314,
+  145120729, 145104902, 145113621, 145111012, 145110187, 145101557,
+  145100936, 145090459, 145092342, 145082303, 145091925, 145079598,
+  145083191, 145073549, 145080165, 145071155, 145072831, 145066806,
+  145061163, 145059962, 145061958, 145057335, 145041622, 145049600,
+  145046495, 145049470, 145040426, 145028588, 145033860, 145041595,
+  145020419, 145020611, 145013825, 145019407, 145019967, 145014132,
+  145007376, 145004593, 145008253, 145006378, 144996184, 144993700,
+  144987370, 144996722, 144983965, 144985360, 144972020, 144981889,
+  144976556, 144971765, 144972858, 144956118, 144962558, 144955002,
+  144961722, 144953511, 144949619, 144955175, 144946346, 144951617,
+  144945722, 144944018, 144934330, 144938603, 144936671, 144925063,
+  144923772, 144923709, 144925130, 144916118, 144906990, 144913096,
+  144899793, 144905557, 144900999, 144902068, 144891997, 144900367,
+  144898548, 144889442, 144883243, 144885797, 144874822, 144883558,
+  144869478, 144875397, 144872476, 144863374, 144863769, 144856938,
+  144868220, 144849558, 144844469, 144852232, 144845455, 144852081,
+  144842047, 144849490, 144828826, 144831816, 144837428, 144824548,
+  144826298, 144814695, 144818799, 144825534, 144812234, 144810625,
+  144799937, 144803073, 144801466, 144801677, 144792313, 144793684,
+  144779756, 144789842, 144799322, 144773036, 144777935, 144782950,
+  144781613, 144777935, 144769687, 144762136, 144767224, 144766981,
+  144760257, 144760064, 144752418, 144759660, 144748727, 144751140,
+  144743286, 144730864, 144730022, 144733730, 144730701, 144726887,
+  144730761, 144726598, 144722834, 144715027, 144714941, 144713073,
+  144709705, 144706515, 144702413, 144697907, 144701958, 144695981,
+  144687238, 144694215, 144685139, 144690597, 144684406, 144687020,
+  144684442, 144675145, 144666830, 144681905, 144663067, 144655469,
+  144663746, 144651999, 144664985, 144646240, 144647298, 144663288,
+  144652251, 144637375, 144639202, 144633320, 144639976, 144628553,
+  144631920, 144623600, 144629149, 144619698, 144617164, 144614049,
+  144618587, 144617967, 144603438, 144604360, 144596476, 144604397,
+  144596225, 144586100, 144592635, 144592707, 144583168, 144595154,
+  144582716, 144583937, 144576180, 144580276, 144563763, 144568781,
+  144564662, 144564879, 144567353, 144548578, 144561942, 144549186,
+  144561554, 144550625, 144547314, 144535878, 144537434, 144535137,
+  144538407, 144537084, 144527156, 144521745, 144529864, 144522436,
+  144508918, 144519473, 144512123, 144518553, 144509376, 144507201,
+  144505797, 144487393, 144500824, 144498335, 144497125, 144488132,
+  144494544, 144481617, 144479263, 144483826, 144487294, 144477023,
+  144471540, 144467115, 144467481, 144465346, 144461374, 144457463,
+  144451435, 144449276, 144453542, 144446185, 144450679, 144451636,
+  144440581, 144444033, 144427080, 144437359, 144416983, 144433563,
+  144426771, 144421134, 144427757, 144416086, 144413923, 144413534,
+  144414787, 144411061, 144408865, 144401463, 144393356, 144401835,
+  144385756, 144397935, 144400513, 144390033, 144391673, 144387007,
+  144385561, 144384787, 144376924, 144375758, 144373616, 144360579,
+  144367996, 144364687, 144364665, 144354540, 144356491, 144355056,
+  144349720, 144350084, 144346077, 144347206, 144336347, 144336577,
+  144346505, 144338602, 144330131, 144329047, 144332783, 144333590,
+  144320989, 144306980, 144315636, 144305207, 144315284, 144310503,
+  144317686, 144296498, 144299262, 144300999, 144290187, 144289387,
+  144294796, 144287038, 144286768, 144289656, 144285946, 144282045,
+  144274918, 144277038, 144268148, 144276024, 144272604, 144258252,
+  144256859, 144262324, 144262070, 144251896, 144259974, 144251562,
+  144240393, 144249530, 144241051, 144251299, 144244121, 144242431,
+  144223468, 144232681, 144231567, 144222199, 144219040, 144217743,
+  144216345, 144217129, 144221760, 144204960, 144212908, 144205138,
+  144196679, 144206955, 144206424, 144194839, 144189994, 144198819,
+  144193005, 144179199, 144174840, 144181746, 144190117, 144179144,
+  144175459, 144182829, 144169510, 144167052, 144169638, 144166048,
+  144161865, 144159821, 144155373, 144149831, 144155662, 144147403,
+  144139929, 144142165, 144146478, 144143854, 144132582, 144138455,
+  144135045, 144127450, 144134455, 144127580, 144116648, 144117539,
+  144110600, 144114191, 144111315, 144114132, 144105440, 144111069,
+  144107501, 144097458
+};
+
+} // namespace
+
+namespace primesieve {
+
+uint64_t PiTable::getMaxX()
+{
+  return static_cast<uint64_t>(MAX_INDEX) << LOG2_SPACING;
+}
+
+uint64_t PiTable::getCheckpoint(uint64_t x)
+{
+  uint64_t index = x >> LOG2_SPACING;
+  // round to nearest
+  if ((x >> (LOG2_SPACING - 1)) & 1)
+    index++;
+  index = min<uint64_t>(index, MAX_INDEX);
+  return index << LOG2_SPACING;
+}
+
+uint64_t PiTable::getDistance(uint64_t x)
+{
+  uint64_t checkpoint = getCheckpoint(x);
+  return (x > checkpoint) ? x - checkpoint : checkpoint - x;
+}
+
+uint64_t PiTable::pi(uint64_t checkpoint)
+{
+  assert(checkpoint <= getMaxX());
+  uint64_t index = checkpoint >> LOG2_SPACING;
+  uint64_t pix = 0;
+  for (uint64_t i = 0; i < index; i++)
+    pix += primeCounts[i];
+  return pix;
+}
+
+uint64_t PiTable::pi(uint64_t x, PrimeSieve& ps)
+{
+  uint64_t checkpoint = getCheckpoint(x);
+  uint64_t pix = pi(checkpoint);
+
+  if (x > checkpoint)
+    pix += ps.countPrimes(checkpoint + 1, x);
+  if (x < checkpoint)
+    pix -= ps.countPrimes(x + 1, checkpoint);
+
+  return pix;
+}
+
+uint64_t PiTable::countPrimes(uint64_t start, uint64_t stop, PrimeSieve& ps)
+{
+  uint64_t count = pi(stop, ps);
+  if (start > 0)
+    count -= pi(start - 1, ps);
+  return count;
+}
+
+bool PiTable::isFaster(uint64_t start, uint64_t stop)
+{
+  if (start > stop)
+    return false;
+  uint64_t distance = getDistance(stop);
+  if (start > 0)
+    distance += getDistance(start - 1);
+  return distance < stop - start &&
+         static_cast<double>(distance) < getPiLmoCost(start, stop);
+}
+
+uint64_t PiTable::findCheckpoint(uint64_t n)
+{
+  uint64_t index = 0;
+  uint64_t pix = 0;
+  for (; index < MAX_INDEX; index++)
+  {
+    if (pix + primeCounts[index] >= n)
+      break;
+    pix += primeCounts[index];
+  }
+  return index << LOG2_SPACING;
+}
+
+} // namespace primesieve
@@ -11,6 +11,7 @@
 
 #include <primesieve/config.hpp>
 #include <primesieve/PreSieve.hpp>
+#include <primesieve/Allocator.hpp>
 #include <primesieve/EratSmall.hpp>
 #include <primesieve/primesieve_error.hpp>
 
@@ -27,6 +28,7 @@ const uint_t PreSieve::primes_[10] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29 };
 ///
 PreSieve::PreSieve(int limit) :
   limit_(limit),
+  allocator_(Allocator::get()),
   preSieved_(NULL)
 {
   // limit_ <= 23 prevents 32-bit overflows
@@ -37,7 +39,8 @@ PreSieve::PreSieve(int limit) :
 
 PreSieve::~PreSieve()
 {
-  delete[] preSieved_;
+  if (preSieved_)
+    allocator_.deallocate(preSieved_, size_);
 }
 
 /// Cross-off the multiples of small primes <= limit_
@@ -50,7 +53,7 @@ void PreSieve::init()
     primeProduct_ *= primes_[i];
 
   size_ = primeProduct_ / NUMBERS_PER_BYTE;
-  preSieved_ = new byte_t[size_];
+  preSieved_ = static_cast<byte_t*>(allocator_.allocate(size_));
   std::memset(preSieved_, 0xff, size_);
 
   uint_t stop = primeProduct_ * 2;
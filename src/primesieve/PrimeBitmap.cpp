@@ -0,0 +1,396 @@
+///
+/// @file   PrimeBitmap.cpp
+/// @brief  Succinct bitmap of the primes within [start, stop] with a
+///         rank/select index. A bitmap file consists of a 64 bytes
+///         header followed by the sieve bytes and the rank index.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#if !defined(__STDC_CONSTANT_MACROS)
+  #define __STDC_CONSTANT_MACROS
+#endif
+
+#include <primesieve/config.hpp>
+#include <primesieve/PrimeBitmap.hpp>
+#include <primesieve/ParallelPrimeSieve.hpp>
+#include <primesieve/primesieve_error.hpp>
+#include <primesieve/littleendian_cast.hpp>
+#include <primesieve/pmath.hpp>
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+  #define HAVE_MMAP
+#endif
+
+namespace primesieve {
+
+namespace {
+
+const char BITMAP_MAGIC[16] = "primesieve-bmap";
+
+const uint64_t BITMAP_VERSION = 1;
+
+/// Size of the file header in 64-bit words
+const uint64_t HEADER_WORDS = 8;
+
+/// Bitmap words per rank index entry
+const uint64_t BLOCK_WORDS = 8;
+
+struct Header
+{
+  char magic[16];
+  uint64_t version;
+  uint64_t start;
+  uint64_t stop;
+  uint64_t firstByte;
+  uint64_t words;
+  uint64_t unused;
+};
+
+const uint64_t smallPrimes[3] = { 2, 3, 5 };
+
+uint64_t getBlocks(uint64_t words)
+{
+  return (words + BLOCK_WORDS - 1) / BLOCK_WORDS;
+}
+
+/// Header + bitmap + rank index
+uint64_t getImageWords(uint64_t words)
+{
+  return HEADER_WORDS + words + getBlocks(words) + 1;
+}
+
+bool isBitmap(const uint64_t* image, uint64_t bytes)
+{
+  if (bytes < HEADER_WORDS * 8)
+    return false;
+  const Header* header = reinterpret_cast<const Header*>(image);
+  return std::memcmp(header->magic, BITMAP_MAGIC, sizeof(BITMAP_MAGIC)) == 0 &&
+         header->version == BITMAP_VERSION &&
+         header->start <= header->stop &&
+         header->words < bytes / 8 &&
+         bytes == getImageWords(header->words) * 8;
+}
+
+} // namespace
+
+const uint64_t PrimeBitmap::bitValues_[8] = { 7, 11, 13, 17, 19, 23, 29, 31 };
+
+PrimeBitmap::PrimeBitmap(uint64_t start, uint64_t stop) :
+  mapped_(NULL),
+  mappedSize_(0)
+{
+  if (start > stop)
+    throw primesieve_error("start must be <= stop");
+  ParallelPrimeSieve pps;
+  pps.setStop(stop);
+  pps.setSieveSize(get_sieve_size());
+  pps.setNumThreads(get_num_threads());
+  pps.setNuma(is_numa());
+
+  uint64_t firstByte = 0;
+  uint64_t words = 0;
+  if (stop >= 7)
+  {
+    uint64_t first = getFirstByte(std::max<uint64_t>(start, 7));
+    uint64_t last = getLastByte(stop);
+    if (first <= last)
+    {
+      firstByte = first - first % 8;
+      words = (last - firstByte) / 8 + 1;
+    }
+  }
+
+  image_.resize(static_cast<std::size_t>(getImageWords(words)), 0);
+  Header* header = reinterpret_cast<Header*>(&image_[0]);
+  std::memcpy(header->magic, BITMAP_MAGIC, sizeof(BITMAP_MAGIC));
+  header->version = BITMAP_VERSION;
+  header->start = start;
+  header->stop = stop;
+  header->firstByte = firstByte;
+  header->words = words;
+  init(&image_[0]);
+
+  if (words > 0)
+    pps.sieveBitmap(start, stop, this);
+  initRanks();
+}
+
+PrimeBitmap::PrimeBitmap(const std::string& filename) :
+  mapped_(NULL),
+  mappedSize_(0)
+{
+  const uint64_t* image = NULL;
+  uint64_t bytes = 0;
+
+#if defined(HAVE_MMAP)
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1)
+    throw primesieve_error("cannot open " + filename);
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+  {
+    void* addr = mmap(NULL, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    if (addr != MAP_FAILED)
+    {
+      mapped_ = addr;
+      mappedSize_ = static_cast<std::size_t>(st.st_size);
+    }
+  }
+  close(fd);
+  if (mapped_ == NULL)
+    throw primesieve_error("cannot map " + filename);
+  image = static_cast<const uint64_t*>(mapped_);
+  bytes = mappedSize_;
+#else
+  std::ifstream file(filename.c_str(), std::ios::binary);
+  if (!file)
+    throw primesieve_error("cannot open " + filename);
+  file.seekg(0, std::ios::end);
+  bytes = static_cast<uint64_t>(file.tellg());
+  file.seekg(0, std::ios::beg);
+  image_.resize(static_cast<std::size_t>((bytes + 7) / 8), 0);
+  if (bytes > 0)
+    file.read(reinterpret_cast<char*>(&image_[0]), static_cast<std::streamsize>(bytes));
+  if (!file)
+    throw primesieve_error("cannot read " + filename);
+  image = image_.empty() ? NULL : &image_[0];
+#endif
+
+  if (!isBitmap(image, bytes))
+  {
+#if defined(HAVE_MMAP)
+    munmap(mapped_, mappedSize_);
+#endif
+    throw primesieve_error(filename + " is not a primesieve bitmap");
+  }
+  init(image);
+}
+
+PrimeBitmap::~PrimeBitmap()
+{
+#if defined(HAVE_MMAP)
+  if (mapped_ != NULL)
+    munmap(mapped_, mappedSize_);
+#endif
+}
+
+void PrimeBitmap::init(const uint64_t* image)
+{
+  const Header* header = reinterpret_cast<const Header*>(image);
+  start_ = header->start;
+  stop_ = header->stop;
+  firstByte_ = header->firstByte;
+  words_ = header->words;
+  data_ = image;
+  bits_ = reinterpret_cast<const uint8_t*>(image + HEADER_WORDS);
+  ranks_ = image + HEADER_WORDS + words_;
+  smallPrimes_ = 0;
+  for (int i = 0; i < 3; i++)
+    if (smallPrimes[i] >= start_ && smallPrimes[i] <= stop_)
+      smallPrimes_++;
+}
+
+/// ranks_[i] = number of primes within bits_ words [0, i * 8[
+void PrimeBitmap::initRanks()
+{
+  uint64_t* ranks = &image_[static_cast<std::size_t>(HEADER_WORDS + words_)];
+  const uint64_t* words = &image_[HEADER_WORDS];
+  uint64_t blocks = getBlocks(words_);
+  uint64_t count = 0;
+
+  for (uint64_t i = 0; i < blocks; i++)
+  {
+    ranks[i] = count;
+    uint64_t size = std::min(BLOCK_WORDS, words_ - i * BLOCK_WORDS);
+    count += popcount(&words[i * BLOCK_WORDS], size);
+  }
+  ranks[blocks] = count;
+}
+
+/// Index of the first sieve byte that contains
+/// numbers >= n, n % 30 == 2 is in between two bytes.
+///
+uint64_t PrimeBitmap::getFirstByte(uint64_t n)
+{
+  return (n < 31) ? 0 : (n - 2) / NUMBERS_PER_BYTE;
+}
+
+/// Index of the last sieve byte that
+/// contains numbers <= n, @pre n >= 7.
+///
+uint64_t PrimeBitmap::getLastByte(uint64_t n)
+{
+  return (n - 7) / NUMBERS_PER_BYTE;
+}
+
+/// Called by PrimeFinder::storeBitmap() for each segment
+void PrimeBitmap::store(uint64_t byte, const uint8_t* sieve, std::size_t size)
+{
+  uint8_t* bits = reinterpret_cast<uint8_t*>(&image_[HEADER_WORDS]);
+  std::memcpy(&bits[byte - firstByte_], sieve, size);
+}
+
+void PrimeBitmap::save(const std::string& filename) const
+{
+  std::ofstream file(filename.c_str(), std::ios::binary);
+  uint64_t bytes = getImageWords(words_) * 8;
+  file.write(reinterpret_cast<const char*>(data_), static_cast<std::streamsize>(bytes));
+  if (!file)
+    throw primesieve_error("cannot write " + filename);
+}
+
+uint64_t PrimeBitmap::getStart() const
+{
+  return start_;
+}
+
+uint64_t PrimeBitmap::getStop() const
+{
+  return stop_;
+}
+
+uint64_t PrimeBitmap::getWord(uint64_t i) const
+{
+  return littleendian_cast<uint64_t>(&bits_[i * 8]);
+}
+
+/// Number of 1 bits within bits_[0, pos[
+uint64_t PrimeBitmap::rank(uint64_t pos) const
+{
+  uint64_t word = pos / 64;
+  uint64_t block = word / BLOCK_WORDS;
+  uint64_t count = ranks_[block];
+
+  for (uint64_t i = block * BLOCK_WORDS; i < word; i++)
+    count += popcount64(getWord(i));
+  if (pos % 64 != 0)
+    count += popcount64(getWord(word) & ((UINT64_C(1) << (pos % 64)) - 1));
+
+  return count;
+}
+
+/// Position of the nth 1 bit, binary search the rank
+/// index then scan at most 8 words and 16 bits.
+/// @pre 1 <= n <= total number of 1 bits
+///
+uint64_t PrimeBitmap::select(uint64_t n) const
+{
+  const uint64_t* end = ranks_ + getBlocks(words_) + 1;
+  uint64_t block = (std::upper_bound(ranks_, end, n - 1) - ranks_) - 1;
+  n -= ranks_[block];
+
+  uint64_t word = block * BLOCK_WORDS;
+  uint64_t bits = getWord(word);
+  for (uint64_t count; (count = popcount64(bits)) < n; bits = getWord(++word))
+    n -= count;
+
+  uint64_t pos = word * 64;
+  for (uint64_t count; (count = popcount64(bits & 0xff)) < n; bits >>= 8, pos += 8)
+    n -= count;
+  for (; (bits & 1) == 0 || --n > 0; bits >>= 1)
+    pos++;
+
+  return pos;
+}
+
+bool PrimeBitmap::isPrime(uint64_t n) const
+{
+  if (n < start_ || n > stop_)
+    throw primesieve_error("n must be within [start, stop]");
+  if (n < 7)
+    return n == 2 || n == 3 || n == 5;
+
+  uint64_t value = (n - 7) % NUMBERS_PER_BYTE + 7;
+  for (int i = 0; i < 8; i++)
+    if (bitValues_[i] == value)
+      return ((bits_[getLastByte(n) - firstByte_] >> i) & 1) != 0;
+
+  return false;
+}
+
+uint64_t PrimeBitmap::countPrimes(uint64_t n) const
+{
+  if (n < start_)
+    return 0;
+  n = std::min(n, stop_);
+
+  uint64_t count = 0;
+  for (int i = 0; i < 3; i++)
+    if (smallPrimes[i] >= start_ && smallPrimes[i] <= n)
+      count++;
+
+  if (n >= 7 && words_ > 0)
+  {
+    uint64_t byte = getLastByte(n);
+    if (byte >= firstByte_)
+    {
+      // number of bits (numbers) <= n within byte
+      uint64_t value = (n - 7) % NUMBERS_PER_BYTE + 7;
+      uint64_t bit = 0;
+      while (bit < 8 && bitValues_[bit] <= value)
+        bit++;
+      count += rank((byte - firstByte_) * 8 + bit);
+    }
+  }
+
+  return count;
+}
+
+uint64_t PrimeBitmap::getPrimeCount() const
+{
+  return smallPrimes_ + ranks_[getBlocks(words_)];
+}
+
+uint64_t PrimeBitmap::nthPrime(uint64_t n) const
+{
+  if (n == 0 || n > getPrimeCount())
+    throw primesieve_error("nth prime is not within [start, stop]");
+
+  if (n <= smallPrimes_)
+  {
+    int i = 0;
+    while (smallPrimes[i] < start_)
+      i++;
+    return smallPrimes[i + n - 1];
+  }
+
+  uint64_t pos = select(n - smallPrimes_);
+  return (firstByte_ + pos / 8) * NUMBERS_PER_BYTE + bitValues_[pos % 8];
+}
+
+uint64_t PrimeBitmap::nextPrime(uint64_t n) const
+{
+  if (n > stop_)
+    return 0;
+  uint64_t count = (n > start_) ? countPrimes(n - 1) : 0;
+  if (count >= getPrimeCount())
+    return 0;
+  return nthPrime(count + 1);
+}
+
+uint64_t PrimeBitmap::prevPrime(uint64_t n) const
+{
+  uint64_t count = countPrimes(n);
+  if (count == 0)
+    return 0;
+  return nthPrime(count);
+}
+
+} // namespace primesieve
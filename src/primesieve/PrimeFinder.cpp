@@ -18,6 +18,9 @@
 #include <primesieve/SieveOfEratosthenes.hpp>
 #include <primesieve/SieveOfEratosthenes-inline.hpp>
 #include <primesieve/littleendian_cast.hpp>
+#include <primesieve/CountIndex.hpp>
+#include <primesieve/PrimeBitmap.hpp>
+#include <primesieve/pmath.hpp>
 
 #include <stdint.h>
 #include <algorithm>
@@ -27,9 +30,6 @@
 
 namespace primesieve {
 
-/// forward declaration
-uint64_t popcount(const uint64_t* array, uint64_t size);
-
 const uint_t PrimeFinder::kBitmasks_[7][5] =
 {
   { END },
@@ -45,10 +45,24 @@ PrimeFinder::PrimeFinder(PrimeSieve& ps) :
   SieveOfEratosthenes(std::max<uint64_t>(7, ps.getStart()),
                       ps.getStop(),
                       ps.getSieveSize()),
-  ps_(ps)
+  ps_(ps),
+  countIndex_(NULL),
+  countFlags_(0),
+  checkpointCount_(0),
+  checkpoint_(0)
 {
   if (ps_.isFlag(ps_.COUNT_TWINS, ps_.COUNT_SEPTUPLETS))
     init_kCounts();
+  if (ps_.isCount() &&
+      !ps_.isFlag(ps_.COUNT_CHECKPOINTS) &&
+      !ps_.isHistogram())
+    countIndex_ = CountIndex::get();
+  for (int i = 0; i < 7; i++)
+  {
+    if (ps_.isCount(i))
+      countFlags_ |= 1 << i;
+    blockCounts_[i] = 0;
+  }
 }
 
 /// Calculate the number of twins, triplets, ... (bitmask matches)
@@ -86,8 +100,22 @@ void PrimeFinder::segmentFinished(const byte_t* sieve, uint_t sieveSize)
     count(sieve, sieveSize);
   if (ps_.isPrint())
     print(sieve, sieveSize);
+  if (ps_.isFlag(ps_.STORE_BITMAP))
+    storeBitmap(sieve, sieveSize);
   if (ps_.isStatus())
     ps_.updateStatus(sieveSize * NUMBERS_PER_BYTE, /* waitForLock = */ false);
+  if (ps_.isParallelPrimeSieveChild())
+    reserveNextSegment();
+}
+
+/// ParallelPrimeSieve threads may steal the end of each other's
+/// intervals. Reserve the next segment so that it will not be
+/// stolen and reduce stop if the end has been stolen.
+///
+void PrimeFinder::reserveNextSegment()
+{
+  uint64_t segmentHigh = getSegmentHigh() + getSieveSize() * NUMBERS_PER_BYTE;
+  setStop(ps_.reserve(segmentHigh, ps_.threadNum_));
 }
 
 /// Reconstruct prime numbers from 1 bits of the sieve array and
@@ -153,6 +181,31 @@ inline void PrimeFinder::callbackPrimes(Callback<uint64_t, int>* cb, const byte_
   }
 }
 
+/// Reconstruct the primes of the current segment into a small
+/// buffer and pass them in chunks to the segment callback object.
+///
+template <>
+inline void PrimeFinder::callbackPrimes(SegmentCallback* cb, const byte_t* sieve, uint_t sieveSize) const
+{
+  enum { BUFFER_SIZE = 1024 };
+  uint64_t primes[BUFFER_SIZE + 64];
+  std::size_t size = 0;
+  uint64_t base = getSegmentLow();
+  for (uint_t i = 0; i < sieveSize; i += 8, base += NUMBERS_PER_BYTE * 8)
+  {
+    uint64_t bits = littleendian_cast<uint64_t>(&sieve[i]);
+    while (bits != 0)
+      primes[size++] = getNextPrime(&bits, base);
+    if (size >= BUFFER_SIZE)
+    {
+      cb->callback(primes, size);
+      size = 0;
+    }
+  }
+  if (size > 0)
+    cb->callback(primes, size);
+}
+
 /// Callback the primes within the current segment.
 /// @note primes < 7 are handled in PrimeSieve::doSmallPrime()
 ///
@@ -164,6 +217,7 @@ void PrimeFinder::callbackPrimes(const byte_t* sieve, uint_t sieveSize) const
   if (ps_.isFlag(ps_.CALLBACK_PRIMES_TN))     { /* No Locking */     callbackPrimes(ps_.callback_tn_, sieve, sieveSize, ps_.threadNum_); }
   if (ps_.isFlag(ps_.CALLBACK_PRIMES_C))      { LockGuard lock(ps_); callbackPrimes(reinterpret_cast<callback_c_t>(ps_.callback_), sieve, sieveSize); }
   if (ps_.isFlag(ps_.CALLBACK_PRIMES_C_TN))   { /* No Locking */     callbackPrimes(reinterpret_cast<callback_c_tn_t>(ps_.callback_tn_), sieve, sieveSize, ps_.threadNum_); }
+  if (ps_.isFlag(ps_.CALLBACK_PRIMES_SEGMENT)) { LockGuard lock(ps_); callbackPrimes(ps_.cb_segment_, sieve, sieveSize); }
 }
 
 /// Count the primes and prime k-tuplets within
@@ -171,6 +225,22 @@ void PrimeFinder::callbackPrimes(const byte_t* sieve, uint_t sieveSize) const
 ///
 void PrimeFinder::count(const byte_t* sieve, uint_t sieveSize)
 {
+  if (ps_.isFlag(ps_.COUNT_CHECKPOINTS))
+  {
+    countCheckpoints(sieve, sieveSize);
+    return;
+  }
+  if (ps_.isHistogram())
+  {
+    countHistogram(sieve, sieveSize);
+    return;
+  }
+  if (countIndex_)
+  {
+    countBlocks(sieve, sieveSize);
+    return;
+  }
+
   // count prime numbers (1 bits), see popcount.cpp
   if (ps_.isFlag(ps_.COUNT_PRIMES))
     ps_.counts_[0] += popcount(reinterpret_cast<const uint64_t*>(sieve), (sieveSize + 7) / 8);
@@ -196,6 +266,203 @@ void PrimeFinder::count(const byte_t* sieve, uint_t sieveSize)
   }
 }
 
+/// Count the primes and prime k-tuplets within
+/// sieve[first, last) and add them to counts.
+///
+void PrimeFinder::count(const byte_t* sieve, uint_t first, uint_t last, uint64_t* counts) const
+{
+  if (ps_.isFlag(ps_.COUNT_PRIMES))
+  {
+    uint_t i = first;
+    for (; i < last && i % 8 != 0; i++)
+      counts[0] += popcount64(sieve[i]);
+    uint_t words = (last - i) / 8;
+    counts[0] += popcount(reinterpret_cast<const uint64_t*>(&sieve[i]), words);
+    for (i += words * 8; i < last; i++)
+      counts[0] += popcount64(sieve[i]);
+  }
+
+  for (uint_t i = 1; i < ps_.counts_.size(); i++)
+  {
+    if (ps_.isCount(i))
+    {
+      uint_t sum = 0;
+      for (uint_t j = first; j < last; j++)
+        sum += kCounts_[i][sieve[j]];
+      counts[i] += sum;
+    }
+  }
+}
+
+/// Count the current segment block by block and store the
+/// counts of the blocks that have been sieved completely
+/// (not cut by start or stop) in the count index.
+///
+void PrimeFinder::countBlocks(const byte_t* sieve, uint_t sieveSize)
+{
+  uint64_t segmentByte = getSegmentLow() / NUMBERS_PER_BYTE;
+  uint_t i = 0;
+
+  while (i < sieveSize)
+  {
+    uint64_t block = (segmentByte + i) >> CountIndex::LOG2_BLOCK_BYTES;
+    uint64_t blockEnd = (block + 1) << CountIndex::LOG2_BLOCK_BYTES;
+    uint_t last = static_cast<uint_t>(std::min<uint64_t>(sieveSize, blockEnd - segmentByte));
+    uint64_t counts[7] = { 0, 0, 0, 0, 0, 0, 0 };
+    count(sieve, i, last, counts);
+
+    for (int j = 0; j < 7; j++)
+    {
+      ps_.counts_[j] += counts[j];
+      blockCounts_[j] += counts[j];
+    }
+
+    i = last;
+    if (segmentByte + i == blockEnd)
+    {
+      // block 0 is not indexed, it contains
+      // prime k-tuplets that start with 2, 3 or 5
+      if (block > 0 &&
+          CountIndex::getBlockLow(block) >= getStart() &&
+          CountIndex::getBlockHigh(block) <= getStop())
+        countIndex_->store(block, countFlags_, blockCounts_);
+      for (int j = 0; j < 7; j++)
+        blockCounts_[j] = 0;
+    }
+  }
+}
+
+/// Count the primes of the current segment and store the count
+/// of the primes within [start, checkpoint] for each checkpoint
+/// inside the segment. Only the sieve byte that contains the
+/// checkpoint needs to be masked, all other bytes are counted
+/// using popcount.
+///
+void PrimeFinder::countCheckpoints(const byte_t* sieve, uint_t sieveSize)
+{
+  const std::vector<uint64_t>& checkpoints = *ps_.checkpoints_;
+  std::vector<uint64_t>& counts = *ps_.checkpointCounts_;
+  uint64_t segmentLow = getSegmentLow();
+  uint64_t segmentCount[7] = { 0, 0, 0, 0, 0, 0, 0 };
+  uint_t i = 0;
+
+  for (; checkpoint_ < checkpoints.size(); checkpoint_++)
+  {
+    uint64_t x = checkpoints[checkpoint_];
+    if (x < segmentLow + 7)
+    {
+      counts[checkpoint_] = checkpointCount_ + segmentCount[0];
+      continue;
+    }
+    uint64_t byte = (x - segmentLow - 7) / NUMBERS_PER_BYTE;
+    if (byte >= sieveSize)
+      break;
+    uint_t last = static_cast<uint_t>(byte);
+    count(sieve, i, last, segmentCount);
+    i = last;
+    // count the primes <= x of the sieve byte that contains x
+    uint64_t primes = 0;
+    uint64_t base = segmentLow + byte * NUMBERS_PER_BYTE;
+    uint64_t bits = sieve[last];
+    while (bits != 0 && getNextPrime(&bits, base) <= x)
+      primes++;
+    counts[checkpoint_] = checkpointCount_ + segmentCount[0] + primes;
+  }
+
+  count(sieve, i, sieveSize, segmentCount);
+  checkpointCount_ += segmentCount[0];
+  ps_.counts_[0] += segmentCount[0];
+}
+
+/// Count the primes and prime k-tuplets of the current segment
+/// per histogram bucket. The sieve bytes that are entirely within
+/// a bucket are counted using count(), a byte that contains the
+/// upper bound of a bucket is split using bitmasks, prime
+/// k-tuplets are assigned to the bucket of their first prime.
+///
+void PrimeFinder::countHistogram(const byte_t* sieve, uint_t sieveSize)
+{
+  uint64_t segmentLow = getSegmentLow();
+  uint64_t step = ps_.histogramStep_;
+  uint64_t maxHigh = ~static_cast<uint64_t>(0);
+  uint_t i = 0;
+
+  while (i < sieveSize)
+  {
+    // numbers < start and > stop are not within the histogram
+    // but their sieve bits are 0
+    uint64_t low = segmentLow + i * NUMBERS_PER_BYTE + 7;
+    if (low > getStop())
+      break;
+    uint64_t bucket = ps_.getBucket(std::max(low, getStart()));
+    uint64_t bucketLow = ps_.histogramStart_ + bucket * step;
+    uint64_t bucketHigh = maxHigh;
+    uint64_t last = sieveSize;
+    if (getStop() - bucketLow >= step)
+    {
+      bucketHigh = bucketLow + step - 1;
+      last = std::min<uint64_t>(sieveSize, (bucketHigh - segmentLow - 7) / NUMBERS_PER_BYTE);
+    }
+
+    uint64_t counts[7] = { 0, 0, 0, 0, 0, 0, 0 };
+    count(sieve, i, static_cast<uint_t>(last), counts);
+    addHistogram(bucket, counts);
+    i = static_cast<uint_t>(last);
+    if (i == sieveSize)
+      break;
+
+    // split the sieve byte that contains bucketHigh, its
+    // numbers belong to multiple buckets if step < 30
+    byte_t byte = sieve[i];
+    uint64_t base = segmentLow + i * NUMBERS_PER_BYTE;
+    while (byte != 0)
+    {
+      byte_t high = 0;
+      for (uint64_t bits = byte; bits != 0; )
+      {
+        byte_t bit = static_cast<byte_t>(bits & (~bits + 1));
+        if (getNextPrime(&bits, base) > bucketHigh)
+          high |= bit;
+      }
+      uint64_t lowCounts[7] = { 0, 0, 0, 0, 0, 0, 0 };
+      uint64_t highCounts[7] = { 0, 0, 0, 0, 0, 0, 0 };
+      count(&byte, 0, 1, lowCounts);
+      count(&high, 0, 1, highCounts);
+      for (int j = 0; j < 7; j++)
+        lowCounts[j] -= highCounts[j];
+      addHistogram(bucket, lowCounts);
+      byte = high;
+      bucket++;
+      bucketHigh = (maxHigh - bucketHigh < step) ? maxHigh : bucketHigh + step;
+    }
+    i++;
+  }
+}
+
+void PrimeFinder::addHistogram(uint64_t bucket, const uint64_t* counts)
+{
+  for (int j = 0; j < 7; j++)
+  {
+    ps_.counts_[j] += counts[j];
+    if (ps_.isCount(j))
+      ps_.histogram_[j][bucket - ps_.histogramFirst_] += counts[j];
+  }
+}
+
+/// Copy the sieve bytes of the current segment that are within
+/// [start, stop] to the bitmap. ParallelPrimeSieve threads start
+/// and stop at numbers n % 30 == 2 i.e. in between two sieve
+/// bytes, hence threads never write the same byte.
+///
+void PrimeFinder::storeBitmap(const byte_t* sieve, uint_t sieveSize) const
+{
+  uint64_t segmentByte = getSegmentLow() / NUMBERS_PER_BYTE;
+  uint64_t first = std::max(segmentByte, PrimeBitmap::getFirstByte(getStart()));
+  uint64_t last = std::min(segmentByte + sieveSize, PrimeBitmap::getLastByte(getStop()) + 1);
+  if (first < last)
+    ps_.bitmap_->store(first, &sieve[first - segmentByte], static_cast<std::size_t>(last - first));
+}
+
 void PrimeFinder::printPrime(uint64_t prime)
 {
   std::cout << prime << '\n';
@@ -11,6 +11,8 @@
 #include <primesieve/PrimeSieve.hpp>
 #include <primesieve/SieveOfEratosthenes.hpp>
 #include <primesieve/pmath.hpp>
+#include <primesieve/PiTable.hpp>
+#include <primesieve/SmallPrimeTable.hpp>
 #include <primesieve.hpp>
 
 #include <stdint.h>
@@ -90,6 +92,17 @@ uint64_t nthPrimeDistance(int64_t n, int64_t count, uint64_t start, bool bruteFo
   return static_cast<uint64_t>(dist);
 }
 
+/// Returns true if the nth prime is so far away from start that
+/// calculating pi(start) from the nearest checkpoint and jumping
+/// to the checkpoint preceding the nth prime is faster.
+///
+bool isPiTableFaster(uint64_t start, uint64_t dist)
+{
+  uint64_t halfSpacing = static_cast<uint64_t>(1) << (PiTable::LOG2_SPACING - 1);
+  return start <= PiTable::getMaxX() &&
+         dist > PiTable::getDistance(start) + halfSpacing;
+}
+
 /// This class is used to generate n primes and
 /// then stop by throwing an exception.
 ///
@@ -142,6 +155,9 @@ uint64_t PrimeSieve::nthPrime(uint64_t n)
 uint64_t PrimeSieve::nthPrime(int64_t n, uint64_t start)
 {
   setStart(start);
+  uint64_t prime = SmallPrimeTable::nthPrime(n, start);
+  if (prime != 0)
+    return prime;
   double t1 = getWallTime();
 
   if (n != 0)
@@ -153,6 +169,34 @@ uint64_t PrimeSieve::nthPrime(int64_t n, uint64_t start)
 
   uint64_t stop = start;
   uint64_t dist = nthPrimeDistance(n, 0, start);
+
+  if (isPiTableFaster(start, dist))
+  {
+    // rank of the nth prime i.e. nthPrime = p_rank
+    int64_t rank = (n > 0) ? static_cast<int64_t>(PiTable::pi(start - 1, *this)) + n
+                           : static_cast<int64_t>(PiTable::pi(start, *this)) + n + 1;
+    if (rank > 0)
+    {
+      // continue from the nearer checkpoint of the two
+      // checkpoints surrounding the nth prime
+      uint64_t low = PiTable::findCheckpoint(rank);
+      uint64_t high = low + (static_cast<uint64_t>(1) << PiTable::LOG2_SPACING);
+      int64_t pixLow = PiTable::pi(low);
+      int64_t pixHigh = (low < PiTable::getMaxX()) ? PiTable::pi(high) : 0;
+      if (pixHigh > 0 && pixHigh - rank < rank - pixLow)
+      {
+        start = stop = high;
+        n = rank - pixHigh - 1;
+      }
+      else
+      {
+        start = stop = low + 1;
+        n = rank - pixLow;
+      }
+      dist = nthPrimeDistance(n, 0, start);
+    }
+  }
+
   uint64_t nthPrimeGuess = start + dist;
 
   int64_t pixSqrtNthPrime = pix(isqrt(nthPrimeGuess));
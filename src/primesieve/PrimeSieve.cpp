@@ -17,11 +17,14 @@
 #include <primesieve/PrimeSieve-lock.hpp>
 #include <primesieve/PrimeFinder.hpp>
 #include <primesieve/PrimeGenerator.hpp>
+#include <primesieve/CountIndex.hpp>
 #include <primesieve/pmath.hpp>
 
 #include <stdint.h>
+#include <cstddef>
 #include <iostream>
 #include <string>
+#include <vector>
 #include <cstdlib>
 #include <ctime>
 #include <algorithm>
@@ -46,7 +49,12 @@ PrimeSieve::PrimeSieve() :
   counts_(7),
   flags_(COUNT_PRIMES),
   threadNum_(0),
-  parent_(NULL)
+  parent_(NULL),
+  histogramStep_(0),
+  histogramStart_(0),
+  histogramFirst_(0),
+  checkpoints_(NULL),
+  checkpointCounts_(NULL)
 {
   setSieveSize(config::PRIMESIEVE_SIEVESIZE);
   reset();
@@ -64,7 +72,14 @@ PrimeSieve::PrimeSieve(PrimeSieve& parent, int threadNum) :
   callback_(parent.callback_),
   callback_tn_(parent.callback_tn_),
   cb_(parent.cb_),
-  cb_tn_(parent.cb_tn_)
+  cb_tn_(parent.cb_tn_),
+  cb_segment_(parent.cb_segment_),
+  bitmap_(parent.bitmap_),
+  histogramStep_(parent.histogramStep_),
+  histogramStart_(parent.histogramStart_),
+  histogramFirst_(0),
+  checkpoints_(parent.checkpoints_),
+  checkpointCounts_(parent.checkpointCounts_)
 { }
 
 PrimeSieve::~PrimeSieve()
@@ -81,6 +96,7 @@ uint64_t PrimeSieve::getQuintupletCount()        const { return counts_[4]; }
 uint64_t PrimeSieve::getSextupletCount()         const { return counts_[5]; }
 uint64_t PrimeSieve::getSeptupletCount()         const { return counts_[6]; }
 uint64_t PrimeSieve::getCount(int index)         const { return counts_.at(index); }
+uint64_t PrimeSieve::getHistogramStep()          const { return histogramStep_; }
 double   PrimeSieve::getStatus()                 const { return percent_; }
 double   PrimeSieve::getSeconds()                const { return seconds_; }
 int      PrimeSieve::getSieveSize()              const { return sieveSize_; }
@@ -90,11 +106,34 @@ bool     PrimeSieve::isFlag(int flag)            const { return (flags_ & flag)
 bool     PrimeSieve::isFlag(int first, int last) const { return (flags_ & (last * 2 - first)) != 0; }
 bool     PrimeSieve::isCount(int index)          const { return isFlag(COUNT_PRIMES << index); }
 bool     PrimeSieve::isPrint(int index)          const { return isFlag(PRINT_PRIMES << index); }
-bool     PrimeSieve::isCallback()                const { return isFlag(CALLBACK_PRIMES, CALLBACK_PRIMES_C_TN); }
+bool     PrimeSieve::isCallback()                const { return isFlag(CALLBACK_PRIMES, CALLBACK_PRIMES_SEGMENT); }
 bool     PrimeSieve::isCount()                   const { return isFlag(COUNT_PRIMES, COUNT_SEPTUPLETS); }
 bool     PrimeSieve::isPrint()                   const { return isFlag(PRINT_PRIMES, PRINT_SEPTUPLETS); }
 bool     PrimeSieve::isStatus()                  const { return isFlag(PRINT_STATUS, CALCULATE_STATUS); }
 bool     PrimeSieve::isParallelPrimeSieveChild() const { return parent_ != NULL; }
+bool     PrimeSieve::isHistogram()               const { return histogramStep_ != 0 && isCount(); }
+
+/// Get the prime number or prime k-tuplet counts of the histogram
+/// buckets, bucket i contains the counts within
+/// [start + i * step, start + (i + 1) * step - 1] and [start, stop].
+/// @param index  0 = primes, 1 = twins, 2 = triplets, ...
+///
+const std::vector<uint64_t>& PrimeSieve::getHistogram(int index) const
+{
+  if (index < 0 || index >= 7)
+    throw primesieve_error("histogram index must be >= 0 and < 7");
+  return histogram_[index];
+}
+
+/// Get the histogram bucket of n, numbers < start
+/// belong to bucket 0.
+///
+uint64_t PrimeSieve::getBucket(uint64_t n) const
+{
+  if (n <= histogramStart_)
+    return 0;
+  return (n - histogramStart_) / histogramStep_;
+}
 
 /// Set a start number (lower bound) for sieving.
 /// @pre start <= 2^64 - 2^32 * 10
@@ -140,9 +179,32 @@ void PrimeSieve::addFlags(int flags)
     flags_ |= flags;
 }
 
+/// Count the primes and prime k-tuplets (the count flags) per
+/// interval of step numbers instead of only for [start, stop].
+/// The histogram is filled while sieving i.e. it requires no
+/// additional sieving, use getHistogram(int) to get the counts.
+/// @param step  Histogram bucket width, 0 disables the histogram.
+///
+void PrimeSieve::setHistogramStep(uint64_t step)
+{
+  histogramStep_ = step;
+}
+
 void PrimeSieve::reset()
 {
   std::fill(counts_.begin(), counts_.end(), 0);
+  for (int i = 0; i < 7; i++)
+    histogram_[i].clear();
+  if (isHistogram() && start_ <= stop_)
+  {
+    if (!isParallelPrimeSieveChild())
+      histogramStart_ = start_;
+    histogramFirst_ = getBucket(start_);
+    uint64_t buckets = getBucket(stop_) - histogramFirst_ + 1;
+    for (int i = 0; i < 7; i++)
+      if (isCount(i))
+        histogram_[i].resize(static_cast<std::size_t>(buckets), 0);
+  }
   seconds_   = 0.0;
   toUpdate_  = 0;
   processed_ = 0;
@@ -186,6 +248,30 @@ bool PrimeSieve::updateStatus(uint64_t processed, bool waitForLock)
   return true;
 }
 
+/// Add the histogram of a ParallelPrimeSieve child
+/// object to the histogram of this object.
+///
+void PrimeSieve::addHistogram(const PrimeSieve& child)
+{
+  std::size_t offset = static_cast<std::size_t>(child.histogramFirst_ - histogramFirst_);
+  for (int i = 0; i < 7; i++)
+    for (std::size_t j = 0; j < child.histogram_[i].size(); j++)
+      histogram_[i][offset + j] += child.histogram_[i][j];
+}
+
+/// Reserve the next segment for sieving, used by ParallelPrimeSieve
+/// to let idle threads steal the end of other threads' intervals.
+/// @param segmentHigh  Upper bound of the next segment.
+/// @param threadNum    ParallelPrimeSieve thread number.
+/// @return             The (possibly reduced) stop number.
+///
+uint64_t PrimeSieve::reserve(uint64_t segmentHigh, int threadNum)
+{
+  if (isParallelPrimeSieveChild())
+    stop_ = parent_->reserve(segmentHigh, threadNum);
+  return stop_;
+}
+
 void PrimeSieve::printStatus(double old, double current)
 {
   int percent = static_cast<int>(current);
@@ -215,9 +301,16 @@ void PrimeSieve::doSmallPrime(const SmallPrime& sp)
         reinterpret_cast<callback_c_t>(callback_)(sp.firstPrime);
       if (isFlag(CALLBACK_PRIMES_C_TN))
         reinterpret_cast<callback_c_tn_t>(callback_tn_)(sp.firstPrime, threadNum_);
+      if (isFlag(CALLBACK_PRIMES_SEGMENT))
+      {
+        uint64_t prime = sp.firstPrime;
+        cb_segment_->callback(&prime, 1);
+      }
     }
     if (isCount(sp.index))
       counts_[sp.index]++;
+    if (isCount(sp.index) && isHistogram())
+      histogram_[sp.index][getBucket(sp.firstPrime) - histogramFirst_]++;
     if (isPrint(sp.index))
       std::cout << sp.str << '\n';
   }
@@ -231,6 +324,8 @@ void PrimeSieve::sieve()
   reset();
   if (start_ > stop_)
     return;
+  if (countIndexed())
+    return;
   double t1 = getWallTime();
   if (isStatus())
     updateStatus(INIT_STATUS, false);
@@ -259,6 +354,80 @@ void PrimeSieve::sieve()
     updateStatus(FINISH_STATUS, true);
 }
 
+/// Count the primes and prime k-tuplets within [start_, stop_]
+/// using the count index: add up the counts of the blocks that
+/// are in the index and sieve only the remaining parts.
+/// @return false if there are no usable blocks in the index.
+///
+bool PrimeSieve::countIndexed()
+{
+  CountIndex* index = CountIndex::get();
+  if (index == NULL ||
+      !isCount() ||
+      isFlag(COUNT_CHECKPOINTS) ||
+      isHistogram() ||
+      isPrint() ||
+      isCallback() ||
+      isStatus() ||
+      isParallelPrimeSieveChild())
+    return false;
+
+  int countFlags = 0;
+  for (int i = 0; i < 7; i++)
+    if (isCount(i))
+      countFlags |= 1 << i;
+
+  uint64_t start = start_;
+  uint64_t stop = stop_;
+  uint64_t blocks = index->getBlocks();
+  uint64_t blockSize = CountIndex::getBlockLow(1) - CountIndex::getBlockLow(0);
+  // block 0 is never indexed
+  uint64_t block = (start > 7) ? (start - 7 + blockSize - 1) / blockSize : 1;
+  block = std::max<uint64_t>(block, 1);
+
+  std::vector<uint64_t> counts(7, 0);
+  std::vector<uint64_t> blockCounts(7, 0);
+  uint64_t low = start;
+  bool found = false;
+  double t1 = getWallTime();
+
+  for (; block < blocks && CountIndex::getBlockHigh(block) <= stop; block++)
+  {
+    if (!index->find(block, countFlags, &blockCounts[0]))
+      continue;
+    found = true;
+    // sieve the gap before the indexed block
+    if (low < CountIndex::getBlockLow(block))
+    {
+      start_ = low;
+      stop_ = CountIndex::getBlockLow(block) - 1;
+      sieve();
+      for (int i = 0; i < 7; i++)
+        counts[i] += counts_[i];
+    }
+    for (int i = 0; i < 7; i++)
+      counts[i] += blockCounts[i];
+    low = CountIndex::getBlockHigh(block) + 1;
+  }
+
+  if (!found)
+    return false;
+  if (low <= stop)
+  {
+    start_ = low;
+    stop_ = stop;
+    sieve();
+    for (int i = 0; i < 7; i++)
+      counts[i] += counts_[i];
+  }
+
+  start_ = start;
+  stop_ = stop;
+  counts_ = counts;
+  seconds_ = getWallTime() - t1;
+  return true;
+}
+
 void PrimeSieve::sieve(uint64_t start, uint64_t stop)
 {
   setStart(start);
@@ -330,6 +499,34 @@ void PrimeSieve::callbackPrimes(uint64_t start,
   sieve(start, stop);
 }
 
+/// Generate the primes within the interval [start, stop] and call
+/// the callback method of the cb object with chunks of primes.
+///
+void PrimeSieve::callbackPrimes(uint64_t start,
+                                uint64_t stop,
+                                SegmentCallback* cb)
+{
+  if (!cb)
+    throw primesieve_error("Callback pointer is NULL");
+  cb_segment_ = cb;
+  flags_ = CALLBACK_PRIMES_SEGMENT;
+  sieve(start, stop);
+}
+
+/// Sieve the primes within the interval [start, stop] and
+/// store the sieve bytes in bitmap, see PrimeBitmap.cpp.
+///
+void PrimeSieve::sieveBitmap(uint64_t start,
+                             uint64_t stop,
+                             PrimeBitmap* bitmap)
+{
+  if (!bitmap)
+    throw primesieve_error("Bitmap pointer is NULL");
+  bitmap_ = bitmap;
+  flags_ = STORE_BITMAP;
+  sieve(start, stop);
+}
+
 /// Generate the primes within the interval [start, stop] and call a
 /// callback function with extern "C" linkage for each prime.
 ///
@@ -439,4 +636,54 @@ uint64_t PrimeSieve::countSeptuplets(uint64_t start, uint64_t stop)
   return getSeptupletCount();
 }
 
+/// Count the primes within [start, stop] and the primes within
+/// [start, checkpoints[i]] for each checkpoint in a single pass,
+/// counts[i] = number of primes within [start, checkpoints[i]].
+/// This is single-threaded, also for ParallelPrimeSieve objects.
+/// @pre checkpoints are sorted and within [start, stop].
+///
+void PrimeSieve::countPrimes(uint64_t start,
+                             uint64_t stop,
+                             const std::vector<uint64_t>& checkpoints,
+                             std::vector<uint64_t>* counts)
+{
+  if (!counts)
+    throw primesieve_error("counts pointer is NULL");
+  for (std::size_t i = 0; i < checkpoints.size(); i++)
+    if (checkpoints[i] < start ||
+        checkpoints[i] > stop ||
+        (i > 0 && checkpoints[i] < checkpoints[i - 1]))
+      throw primesieve_error("checkpoints must be sorted and within [start, stop]");
+
+  counts->assign(checkpoints.size(), 0);
+  setStart(start);
+  setStop(stop);
+  int flags = flags_;
+  flags_ = COUNT_PRIMES | COUNT_CHECKPOINTS;
+  checkpoints_ = &checkpoints;
+  checkpointCounts_ = counts;
+
+  // the checkpoints must not be used by later sieve() calls
+  try {
+    PrimeSieve::sieve();
+  }
+  catch (...)
+  {
+    flags_ = flags;
+    checkpoints_ = NULL;
+    checkpointCounts_ = NULL;
+    throw;
+  }
+  flags_ = flags;
+  checkpoints_ = NULL;
+  checkpointCounts_ = NULL;
+
+  // primes < 7 are not counted by PrimeFinder
+  for (std::size_t i = 0; i < checkpoints.size(); i++)
+    for (int j = 0; j < 3; j++)
+      if (smallPrimes_[j].firstPrime >= start &&
+          smallPrimes_[j].firstPrime <= checkpoints[i])
+        (*counts)[i]++;
+}
+
 } // namespace primesieve
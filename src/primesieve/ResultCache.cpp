@@ -0,0 +1,151 @@
+///
+/// @file   ResultCache.cpp
+/// @brief  Thread-safe, size-bounded LRU cache of the results of
+///         the count and nth prime API functions. The cache is
+///         locked using an OpenMP critical section, without OpenMP
+///         there is no lock and the cache is always disabled.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/config.hpp>
+#include <primesieve/ResultCache.hpp>
+
+#include <stdint.h>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <utility>
+
+using namespace primesieve;
+
+namespace {
+
+struct Key
+{
+  ResultCache::Query query;
+  uint64_t x;
+  uint64_t y;
+  Key(ResultCache::Query q, uint64_t a, uint64_t b) :
+    query(q), x(a), y(b)
+  { }
+  bool operator<(const Key& other) const
+  {
+    if (query != other.query) return query < other.query;
+    if (x != other.x) return x < other.x;
+    return y < other.y;
+  }
+};
+
+typedef std::pair<Key, uint64_t> Result;
+typedef std::list<Result> LruList;
+
+/// Most recently used result first
+LruList lru;
+
+std::map<Key, LruList::iterator> results;
+
+#if defined(_OPENMP)
+std::size_t cacheSize = config::RESULT_CACHE_SIZE;
+#else
+std::size_t cacheSize = 0;
+#endif
+
+uint64_t hits = 0;
+
+uint64_t misses = 0;
+
+void evict(std::size_t size)
+{
+  while (results.size() > size)
+  {
+    results.erase(lru.back().first);
+    lru.pop_back();
+  }
+}
+
+} // namespace
+
+namespace primesieve {
+
+bool ResultCache::find(Query query, uint64_t x, uint64_t y, uint64_t* result)
+{
+  bool found = false;
+
+  #pragma omp critical (primesieve_result_cache)
+  {
+    if (cacheSize > 0)
+    {
+      std::map<Key, LruList::iterator>::iterator iter = results.find(Key(query, x, y));
+      found = (iter != results.end());
+      if (found)
+      {
+        // move to front
+        lru.splice(lru.begin(), lru, iter->second);
+        *result = iter->second->second;
+        hits++;
+      }
+      else
+        misses++;
+    }
+  }
+
+  return found;
+}
+
+void ResultCache::insert(Query query, uint64_t x, uint64_t y, uint64_t result)
+{
+  #pragma omp critical (primesieve_result_cache)
+  {
+    Key key(query, x, y);
+    if (cacheSize > 0 && results.find(key) == results.end())
+    {
+      evict(cacheSize - 1);
+      lru.push_front(Result(key, result));
+      results[key] = lru.begin();
+    }
+  }
+}
+
+void ResultCache::setSize(std::size_t size)
+{
+#if defined(_OPENMP)
+  #pragma omp critical (primesieve_result_cache)
+  {
+    cacheSize = size;
+    evict(size);
+  }
+#else
+  // not thread-safe without OpenMP, keep the cache disabled
+  (void) size;
+#endif
+}
+
+std::size_t ResultCache::getSize()
+{
+  std::size_t size;
+  #pragma omp critical (primesieve_result_cache)
+  size = cacheSize;
+  return size;
+}
+
+uint64_t ResultCache::getHits()
+{
+  uint64_t n;
+  #pragma omp critical (primesieve_result_cache)
+  n = hits;
+  return n;
+}
+
+uint64_t ResultCache::getMisses()
+{
+  uint64_t n;
+  #pragma omp critical (primesieve_result_cache)
+  n = misses;
+  return n;
+}
+
+} // namespace primesieve
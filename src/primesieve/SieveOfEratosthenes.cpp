@@ -14,10 +14,12 @@
 #include <primesieve/EratSmall.hpp>
 #include <primesieve/EratMedium.hpp>
 #include <primesieve/EratBig.hpp>
+#include <primesieve/Allocator.hpp>
 #include <primesieve/pmath.hpp>
 #include <primesieve/primesieve_error.hpp>
 
 #include <stdint.h>
+#include <algorithm>
 #include <exception>
 #include <string>
 #include <cstdlib>
@@ -51,6 +53,7 @@ SieveOfEratosthenes::SieveOfEratosthenes(uint64_t start,
                                          uint_t sieveSize) :
   start_(start),
   stop_(stop),
+  allocator_(Allocator::get()),
   sieve_(NULL),
   preSieve_(NULL),
   eratSmall_(NULL),
@@ -77,7 +80,7 @@ SieveOfEratosthenes::SieveOfEratosthenes(uint64_t start,
   segmentHigh_ = segmentLow_ + sieveSize_ * NUMBERS_PER_BYTE + 1;
 
   // allocate the sieve of Eratosthenes array
-  sieve_ = new byte_t[sieveSize_];
+  sieve_ = static_cast<byte_t*>(allocator_.allocate(sieveSize_));
   init();
 }
 
@@ -88,7 +91,8 @@ SieveOfEratosthenes::~SieveOfEratosthenes()
 
 void SieveOfEratosthenes::cleanUp()
 {
-  delete[] sieve_;
+  if (sieve_)
+    allocator_.deallocate(sieve_, sieveSize_);
   delete preSieve_;
   delete eratSmall_;
   delete eratMedium_;
@@ -104,7 +108,7 @@ void SieveOfEratosthenes::init()
 
     if (sqrtStop_ > limitPreSieve_)   eratSmall_  = new EratSmall (stop_, sieveSize_, limitEratSmall_);
     if (sqrtStop_ > limitEratSmall_)  eratMedium_ = new EratMedium(stop_, sieveSize_, limitEratMedium_);
-    if (sqrtStop_ > limitEratMedium_) eratBig_    = new EratBig   (stop_, sieveSize_, sqrtStop_);
+    if (sqrtStop_ > limitEratMedium_) eratBig_    = new EratBig   (segmentLow_, stop_, sieveSize_, sqrtStop_);
   }
   catch (const std::exception&) {
     cleanUp();
@@ -112,6 +116,17 @@ void SieveOfEratosthenes::init()
   }
 }
 
+/// Reduce the upper bound of the sieving interval, the sieving
+/// primes <= sqrt(old stop) remain in use. Used by ParallelPrimeSieve
+/// when another thread steals the end of the interval.
+/// @pre stop >= segmentHigh_ of the segment after the current one
+///      or stop >= segmentHigh_ if no segment has been sieved yet.
+///
+void SieveOfEratosthenes::setStop(uint64_t stop)
+{
+  stop_ = std::min(stop_, stop);
+}
+
 uint_t SieveOfEratosthenes::getSqrtStop() const
 {
   return sqrtStop_;
@@ -170,6 +185,43 @@ void SieveOfEratosthenes::preSieve()
   }
 }
 
+/// Same as calling addSievingPrime(uint_t) for each prime but all
+/// primes that share the same segmentLow_ are passed at once to the
+/// erat* objects further down which avoids most 64-bit divisions.
+/// @pre primes are sorted in ascending order.
+///
+void SieveOfEratosthenes::addSievingPrimes(const uint_t* primes, std::size_t size)
+{
+  const uint_t* end = primes + size;
+
+  while (primes != end) {
+    uint64_t square = isquare<uint64_t>(*primes);
+    while (segmentHigh_ < square && segmentHigh_ < stop_) {
+      sieveSegment();
+      segmentLow_  += sieveSize_ * NUMBERS_PER_BYTE;
+      segmentHigh_ += sieveSize_ * NUMBERS_PER_BYTE;
+    }
+    // primes <= sqrt(segmentHigh_) need no further segments
+    const uint_t* last = end;
+    if (segmentHigh_ < stop_) {
+      uint_t limit = static_cast<uint_t>(isqrt(segmentHigh_));
+      last = std::upper_bound(primes, end, limit);
+    }
+    // primes > sqrt(stop_) are not needed, stop_ may have been
+    // reduced by setStop() after the sieving primes up to
+    // sqrt(old stop) have been generated
+    const uint_t* used = last;
+    if (segmentHigh_ >= stop_)
+      used = std::upper_bound(primes, last, static_cast<uint_t>(isqrt(stop_)));
+    const uint_t* medium = std::upper_bound(primes, used, limitEratSmall_);
+    const uint_t* big = std::upper_bound(medium, used, limitEratMedium_);
+    if (primes != medium) eratSmall_->addSievingPrimes(primes, medium - primes, segmentLow_);
+    if (medium != big)   eratMedium_->addSievingPrimes(medium, big - medium, segmentLow_);
+    if (big != used)        eratBig_->addSievingPrimes(big, used - big, segmentLow_);
+    primes = last;
+  }
+}
+
 /// Sieve the remaining segments after that addSievingPrime(uint_t)
 /// has been called for all primes up to sqrt(stop).
 ///
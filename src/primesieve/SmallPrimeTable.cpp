@@ -0,0 +1,2155 @@
+///
+/// @file   SmallPrimeTable.cpp
+/// @brief  Embedded bitmap of the primes <= 2^20 with popcount
+///         prefix sums, generated using a sieve of Eratosthenes.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#if !defined(__STDC_CONSTANT_MACROS)
+  #define __STDC_CONSTANT_MACROS
+#endif
+
+#include <primesieve/config.hpp>
+#include <primesieve/SmallPrimeTable.hpp>
+#include <primesieve/pmath.hpp>
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+using namespace primesieve;
+
+namespace {
+
+enum { WORDS = 4370 };
+
+/// Bit i of byte b (bits 8 * b to 8 * b + 7 of the
+/// little endian words) corresponds to the number
+/// b * 30 + bitValues[i], same layout as the sieve.
+///
+const uint64_t bitmap[WORDS] =
+{
+  UINT64_C(0xfc9eeddb3f77efff), UINT64_C(0x4f76d375798f27ea), UINT64_C(0x52acee9de9e98673),
+  UINT64_C(0x2b530f3c5ec933b5), UINT64_C(0xaaa6156f16d6f1ab), UINT64_C(0x7c50aa01cff851ec),
+  UINT64_C(0x1d09fb3374a27e97), UINT64_C(0x2a5f88a29d15a65c), UINT64_C(0xa7c65e6459bd60c6),
+  UINT64_C(0x778be0cdb8b8ac10), UINT64_C(0x234641f2840d4b2a), UINT64_C(0x43ac47c932d77db9),
+  UINT64_C(0xd0719332c0ec4969), UINT64_C(0xccf5c09e13639c08), UINT64_C(0x2699f9921f4428c6),
+  UINT64_C(0x262c5a15538e45ad), UINT64_C(0x61c1ee410cfb1327), UINT64_C(0x0166e6da811c7896),
+  UINT64_C(0x983d262b864a2559), UINT64_C(0xfc12362265f885a1), UINT64_C(0x46f539ae544a808c),
+  UINT64_C(0xe20f11532815cb12), UINT64_C(0xce3a179d6a032468), UINT64_C(0x170ab45fc402b503),
+  UINT64_C(0x0a044c28dbf1aab0), UINT64_C(0x13b824a6a2d52d43), UINT64_C(0xb0c18155e56ac9e9),
+  UINT64_C(0x56d4e11143e71202), UINT64_C(0xd80b44e8bc26c60c), UINT64_C(0x29121a60513163ab),
+  UINT64_C(0x218410c699202d57), UINT64_C(0xb0708cecdb695b1a), UINT64_C(0x4a3d2268301c8d33),
+  UINT64_C(0x882aba5441c404cd), UINT64_C(0x1964118f342ed093), UINT64_C(0x9c58a439a2018cf0),
+  UINT64_C(0x0e5acc30ab957361), UINT64_C(0x14815647c0e2b405), UINT64_C(0x17322708ca71a38d),
+  UINT64_C(0x8803628a6e1ee58a), UINT64_C(0x71a39874c15894f4), UINT64_C(0x5a18180512e18c9a),
+  UINT64_C(0xa6476c222372e0b6), UINT64_C(0x40c4c93c3812112e), UINT64_C(0x528474c30d932b41),
+  UINT64_C(0x0825615814e1e980), UINT64_C(0x63b0210ed09c2cd9), UINT64_C(0x45e30d2264461391),
+  UINT64_C(0x0498d308230d40c1), UINT64_C(0x0ad4ec690c17aa78), UINT64_C(0xc8a807607b061703),
+  UINT64_C(0x618cb29c0c609366), UINT64_C(0xa5426b169545c9ab), UINT64_C(0x623b700496528530),
+  UINT64_C(0x0db30a74046c1e35), UINT64_C(0x8398881b31815258), UINT64_C(0xd04561892124496a),
+  UINT64_C(0xae3c42c1523a16cf), UINT64_C(0x74010e8a30d80c06), UINT64_C(0x98418e2480e0890c),
+  UINT64_C(0x7a0607ec445099b3), UINT64_C(0x58a3a1336bac444c), UINT64_C(0x8aaca08c044b540b),
+  UINT64_C(0xd0d559f0a915225a), UINT64_C(0x8652888c2ab122ac), UINT64_C(0x056b2a5f00339e51),
+  UINT64_C(0x3f040a8641359b10), UINT64_C(0x420530e83c00c8ab), UINT64_C(0xa8502b072b809654),
+  UINT64_C(0x0831903623c64c05), UINT64_C(0xba85c42b867204e2), UINT64_C(0x01121ce141296105),
+  UINT64_C(0x51eb1498bd12ab16), UINT64_C(0x994506580c58f090), UINT64_C(0x1b9856e2849908e0),
+  UINT64_C(0x35929067c148de04), UINT64_C(0x83b523132247984e), UINT64_C(0x629281082c04c724),
+  UINT64_C(0x481e4050402d2162), UINT64_C(0x0628c201f08a3214), UINT64_C(0xbf23e00452455197),
+  UINT64_C(0x8200152a668195e9), UINT64_C(0x60c1a614a1364959), UINT64_C(0x9c6d90a3168e6649),
+  UINT64_C(0x705dac091246422c), UINT64_C(0xc89404e498380683), UINT64_C(0x614018467c992220),
+  UINT64_C(0x8a41c0be86315239), UINT64_C(0x0a3c05410a875570), UINT64_C(0xd978173788044bb8),
+  UINT64_C(0xc33129992224980e), UINT64_C(0x6c9b2588854222b2), UINT64_C(0x0cbe4840309d34c6),
+  UINT64_C(0x16828645a04a9860), UINT64_C(0x0d42cb5a50b8e007), UINT64_C(0xdba426288a0ae00b),
+  UINT64_C(0x5081174544884abc), UINT64_C(0x1104488840c86a8e), UINT64_C(0xae1019e03c748f5a),
+  UINT64_C(0xa38811d571076245), UINT64_C(0x5428d08cbdaa9471), UINT64_C(0xb030e89641480203),
+  UINT64_C(0x11aa40a220832950), UINT64_C(0x2439111382548c44), UINT64_C(0x14e50b89210e205b),
+  UINT64_C(0x44c229709e00ad50), UINT64_C(0x69349678832000ed), UINT64_C(0x64451a10e0b1a124),
+  UINT64_C(0xa2174404933890b6), UINT64_C(0x6889434c0ec9146a), UINT64_C(0xa80a2310235051a9),
+  UINT64_C(0xc654a22841eeee41), UINT64_C(0x1c8dc48a2a170a26), UINT64_C(0x81404794c08a4021),
+  UINT64_C(0x0602d841c14b1901), UINT64_C(0x0d766cfc03c4288a), UINT64_C(0x91834321ae18a403),
+  UINT64_C(0x59780052862204d9), UINT64_C(0x5b0c612170e500c0), UINT64_C(0x309614a91763cd96),
+  UINT64_C(0x2f4042459213450d), UINT64_C(0x10a29a9529e08130), UINT64_C(0x02242562dc2168a9),
+  UINT64_C(0xe22804e0b091b80b), UINT64_C(0x14110b00ec8c4440), UINT64_C(0x84a9921c75c24846),
+  UINT64_C(0x184304c10a3520d4), UINT64_C(0x2d4a9580211c514e), UINT64_C(0x138222d6d160a501),
+  UINT64_C(0x37174602d494602a), UINT64_C(0x000f410dc80b79b0), UINT64_C(0x0d610a250e8e1340),
+  UINT64_C(0x08a4580860c29e11), UINT64_C(0x4618557a1862a500), UINT64_C(0x83f48e78038c24e4),
+  UINT64_C(0x22e1760e0d910666), UINT64_C(0x10360772101d2805), UINT64_C(0x68a631646cc8e1c1),
+  UINT64_C(0x7cca980104b2c2c0), UINT64_C(0xdb61322553013488), UINT64_C(0x18ca39d0a4100b7c),
+  UINT64_C(0x0316410183a230aa), UINT64_C(0x6725e08e04999c00), UINT64_C(0x1516ccc852209a89),
+  UINT64_C(0x0239522568c22ce0), UINT64_C(0x0c008650612a1e11), UINT64_C(0xc9818202724b5656),
+  UINT64_C(0x98809931a2244d82), UINT64_C(0x68c00180012e302f), UINT64_C(0x65622498549a1702),
+  UINT64_C(0x9143028a1925810f), UINT64_C(0x7984006426156162), UINT64_C(0xb1aa25414cb29c0c),
+  UINT64_C(0x0cf4c9892247ca50), UINT64_C(0xd29045090350e514), UINT64_C(0x84485718b80c2428),
+  UINT64_C(0x056448d7994bb421), UINT64_C(0x0952a88646010116), UINT64_C(0x30140445408f0d80),
+  UINT64_C(0x21823b31a21a4369), UINT64_C(0x50e41b200200f880), UINT64_C(0x2a9484a1196761c6),
+  UINT64_C(0x6d500e3021942722), UINT64_C(0x462ca002f9528714), UINT64_C(0x026282f002b05127),
+  UINT64_C(0xda125245541340b1), UINT64_C(0x041a307221408d69), UINT64_C(0x0068238431661c95),
+  UINT64_C(0x44d16c903c0103a0), UINT64_C(0x88b2405c001911a8), UINT64_C(0x4584225505313a74),
+  UINT64_C(0x9527a678968c030b), UINT64_C(0xe89124065a0aa010), UINT64_C(0xc1500a538bec4070),
+  UINT64_C(0x465d88ad44e0320a), UINT64_C(0x4e4dd1120266843c), UINT64_C(0x2fac1d9451a16608),
+  UINT64_C(0x5769160211c82053), UINT64_C(0xa560c034d20d28a9), UINT64_C(0x911221240cc86451),
+  UINT64_C(0x88ba0002e0a28121), UINT64_C(0x12c5399c06084a0a), UINT64_C(0x20c12000bf140382),
+  UINT64_C(0x40f298949b0b36a4), UINT64_C(0x168a0004fd408e52), UINT64_C(0xa701446e4ba03008),
+  UINT64_C(0x48b0514e2242cc0b), UINT64_C(0xc028a0050cb44945), UINT64_C(0x87593231200ac21b),
+  UINT64_C(0x584ca42a80152448), UINT64_C(0xaf004d88098d4284), UINT64_C(0x22c1805274002864),
+  UINT64_C(0x1a1681504e85a036), UINT64_C(0x5023518bc09080c9), UINT64_C(0x00cb0c23c47442c5),
+  UINT64_C(0x810c01044249a0db), UINT64_C(0x508888409d72281a), UINT64_C(0xab8042991a26416d),
+  UINT64_C(0x070ec21c54529425), UINT64_C(0x036361a091285998), UINT64_C(0x420d4502d0941068),
+  UINT64_C(0xe448392223064291), UINT64_C(0x001c983230a0ec0b), UINT64_C(0x280114d90751cb86),
+  UINT64_C(0xe1c84760912e54c4), UINT64_C(0x31c61c160918a023), UINT64_C(0x9c15250059e04332),
+  UINT64_C(0xc08a24a39c09c888), UINT64_C(0x68f2a94726160139), UINT64_C(0x0d30b28326038808),
+  UINT64_C(0x081780f12500c22a), UINT64_C(0x2954804d22210483), UINT64_C(0x1002cc80b0ca1446),
+  UINT64_C(0x9e410c28d13c118e), UINT64_C(0x632243a1e25be820), UINT64_C(0x59291840e0b44985),
+  UINT64_C(0x9981908e124560d4), UINT64_C(0xa2c1712097250a20), UINT64_C(0xa64a900c20035600),
+  UINT64_C(0x04492aca28131033), UINT64_C(0x0130ad884670c10d), UINT64_C(0xd8160346984cb943),
+  UINT64_C(0x0c10231383140c50), UINT64_C(0x4098620c75ce10c1), UINT64_C(0xa8124d1b834260ac),
+  UINT64_C(0x01048c9482a05106), UINT64_C(0x1068f60b88b22942), UINT64_C(0xb01508e88731c33c),
+  UINT64_C(0x5219034230116881), UINT64_C(0x80a1096063c09234), UINT64_C(0xc090a0be2080545d),
+  UINT64_C(0xae16d4500a428848), UINT64_C(0x8742157d6820238a), UINT64_C(0x10a4ea04c0690847),
+  UINT64_C(0xa55020901c581913), UINT64_C(0x309a1027565d2588), UINT64_C(0x2121b83509868ab0),
+  UINT64_C(0x494c4b00742a96ce), UINT64_C(0x18c08cd286266472), UINT64_C(0xa898182509012165),
+  UINT64_C(0x5067a08b71513300), UINT64_C(0x2b63208c0c28c215), UINT64_C(0xb00205cb70c710d0),
+  UINT64_C(0x15020306c9a65c08), UINT64_C(0x18a8a89543022615), UINT64_C(0x16ca4c28bb400080),
+  UINT64_C(0xa434d92152352566), UINT64_C(0x31072e19695aa000), UINT64_C(0x2c6160f21b808b10),
+  UINT64_C(0x428a120144041192), UINT64_C(0x05401a550ee8034c), UINT64_C(0x016121242588309a),
+  UINT64_C(0x4450d9ab90004a4c), UINT64_C(0xa53cd8500284670d), UINT64_C(0x0046921201a30a00),
+  UINT64_C(0x8160c53601a0a0a2), UINT64_C(0xa9ab3420ec132ce0), UINT64_C(0x10128514020a1521),
+  UINT64_C(0x07d0428d41a3ca45), UINT64_C(0x84030cb820046ac2), UINT64_C(0x692a84540b2d4028),
+  UINT64_C(0x32814284a4a08c14), UINT64_C(0x251540c01ec05a28), UINT64_C(0xa98e430180984043),
+  UINT64_C(0xd910aa152c30d1c9), UINT64_C(0xc474a22955c3584b), UINT64_C(0x8c0c69081045802c),
+  UINT64_C(0x463201a8188e0442), UINT64_C(0x200454066030a005), UINT64_C(0x262101444e05b299),
+  UINT64_C(0x38a81089c29a300a), UINT64_C(0x191024370a72d0a4), UINT64_C(0xc1101935228c0c45),
+  UINT64_C(0x80ddc90b3151c5b8), UINT64_C(0x262a1a1088bb1048), UINT64_C(0x420272081c630b40),
+  UINT64_C(0x0d42242ccd00a080), UINT64_C(0xa3202448a8c4b452), UINT64_C(0x5cb01526824a04d4),
+  UINT64_C(0x1a4cd2206364840c), UINT64_C(0x3ad210700846889e), UINT64_C(0x40824a5949a27305),
+  UINT64_C(0x02a12451953aa450), UINT64_C(0x8a06489484054b37), UINT64_C(0x50821080c2117802),
+  UINT64_C(0x608888328aec1d00), UINT64_C(0xc400e08b15464c50), UINT64_C(0x500580d2a021097a),
+  UINT64_C(0x030c0039622e04e1), UINT64_C(0x2008401ead130672), UINT64_C(0x3a404e181188a020),
+  UINT64_C(0x4a90578042c24119), UINT64_C(0xb1421361c728c790), UINT64_C(0x11419a1a5404e081),
+  UINT64_C(0x244411410d11c866), UINT64_C(0x449ad1c8e2993620), UINT64_C(0x074c1083ac501250),
+  UINT64_C(0x043625565835f905), UINT64_C(0x821760a1200c14c9), UINT64_C(0x6ca1a151ca689848),
+  UINT64_C(0x1e803a1016cc2c90), UINT64_C(0x9a028031230509c6), UINT64_C(0x4a569c2c0113202c),
+  UINT64_C(0x71a3b4d005080c15), UINT64_C(0x1200aa024638710c), UINT64_C(0x2301568314884500),
+  UINT64_C(0xe0a83962a8680594), UINT64_C(0x09295830048a0a54), UINT64_C(0xd480e1830b1022b0),
+  UINT64_C(0x072c058d41025749), UINT64_C(0x04c92a8398423216), UINT64_C(0x33238112c8dd4804),
+  UINT64_C(0x1030034e0010b42b), UINT64_C(0x296111444dc49a44), UINT64_C(0x058ceaa0400a0ec9),
+  UINT64_C(0x220da8229c70625a), UINT64_C(0xc01207f103840444), UINT64_C(0x0460f48500391432),
+  UINT64_C(0x87132aa086215824), UINT64_C(0x838c210868c20d10), UINT64_C(0x95220660682609d0),
+  UINT64_C(0x5e7822832300a241), UINT64_C(0xb0da089805534502), UINT64_C(0x8cb65a11838335e1),
+  UINT64_C(0x454230140c502324), UINT64_C(0xb0266d1882105289), UINT64_C(0x481902010a0b8510),
+  UINT64_C(0xa980342125c4c1c9), UINT64_C(0x0250b90c446bc008), UINT64_C(0xaa1760a104320058),
+  UINT64_C(0x2c9c494c523442c0), UINT64_C(0x1107b250d1802202), UINT64_C(0x0e458e6e8148001f),
+  UINT64_C(0x3a03018242196830), UINT64_C(0x086191416496988d), UINT64_C(0x1ab0090920c61841),
+  UINT64_C(0x0446547899048fca), UINT64_C(0x432a1ebc902435c8), UINT64_C(0x748166006438a502),
+  UINT64_C(0x0077294005109206), UINT64_C(0x411032490e4b1952), UINT64_C(0x289abc0725d0c445),
+  UINT64_C(0x0a1183b934a4d000), UINT64_C(0xd0c16ce8020522d0), UINT64_C(0x6a381e1001847283),
+  UINT64_C(0x0468841024e00906), UINT64_C(0x3927cc080108b1b1), UINT64_C(0x010a55a9d408c090),
+  UINT64_C(0x81189024c34a4708), UINT64_C(0x0c4062a23124208c), UINT64_C(0x5692c42b8041e80a),
+  UINT64_C(0x8d6a8ac8181d4021), UINT64_C(0x638470c010122670), UINT64_C(0x881400d808c5028a),
+  UINT64_C(0xe011226782499099), UINT64_C(0x5880960625004d64), UINT64_C(0x1a31cb0a10ac0847),
+  UINT64_C(0x14402dd8220221a2), UINT64_C(0x858e054019920006), UINT64_C(0x52ce848f15701332),
+  UINT64_C(0x181162161289a224), UINT64_C(0x13a8202324523100), UINT64_C(0xcc22130622525c00),
+  UINT64_C(0x412c630e0681c0c4), UINT64_C(0x1c1dc5c2a0258c20), UINT64_C(0x20ac08b0c3b216e4),
+  UINT64_C(0x50084e8cc48a0b44), UINT64_C(0x8240c32201401104), UINT64_C(0x082460e00c884019),
+  UINT64_C(0xf08192008fa018c0), UINT64_C(0x836c10884525a41f), UINT64_C(0x320b344021358cca),
+  UINT64_C(0xe288548c6aa01124), UINT64_C(0x600012dc28ba0e05), UINT64_C(0x9530455a0854d131),
+  UINT64_C(0x493b2441884760bb), UINT64_C(0xb0180f16600412a1), UINT64_C(0x15184a9844013c90),
+  UINT64_C(0x088b8821a6250042), UINT64_C(0x6436da18c004514a), UINT64_C(0x248db80215a03540),
+  UINT64_C(0x201280ae0244603c), UINT64_C(0x90050327828c20a2), UINT64_C(0x24130502a0681bb0),
+  UINT64_C(0xcf6d218810adc45c), UINT64_C(0xcc0499800c51c094), UINT64_C(0x0f4292d1a12966c9),
+  UINT64_C(0x25686800a81a8a14), UINT64_C(0x01710e2ed0115096), UINT64_C(0x823c142fc401482a),
+  UINT64_C(0x08c1061046200141), UINT64_C(0x454419331326b882), UINT64_C(0x9884a051804603d0),
+  UINT64_C(0xcec40521ea1840e3), UINT64_C(0x33810c4500c0a524), UINT64_C(0x0a7402c40c441b32),
+  UINT64_C(0x6b1664c82483bca0), UINT64_C(0x08338654a4404981), UINT64_C(0x09ad800233289253),
+  UINT64_C(0x98991582b10066e4), UINT64_C(0x2690c9480110640c), UINT64_C(0x53a2420821e03270),
+  UINT64_C(0x050384009a0c090d), UINT64_C(0x6083200b0e19555a), UINT64_C(0x09da0920a0108f54),
+  UINT64_C(0x9409f80106204284), UINT64_C(0x20c0383ab822c034), UINT64_C(0x4032de4419801081),
+  UINT64_C(0x0460820981c12a23), UINT64_C(0x19410f181181a810), UINT64_C(0xca08262448956453),
+  UINT64_C(0x38481a1401ce1060), UINT64_C(0x5470222c622558dd), UINT64_C(0x1808111aa402a05e),
+  UINT64_C(0x03b21c091012138b), UINT64_C(0x75450a04f8518423), UINT64_C(0x116044c280618390),
+  UINT64_C(0x2193010534461060), UINT64_C(0x593aa45101a64724), UINT64_C(0xc841a0343040b080),
+  UINT64_C(0x0a51812b28002862), UINT64_C(0xe8009d24d21f1222), UINT64_C(0x266910524531a405),
+  UINT64_C(0x1b30a22488b0a20f), UINT64_C(0xc9285302741c0942), UINT64_C(0xb13a82508e1ac4b4),
+  UINT64_C(0x828c19014148e016), UINT64_C(0x021d2c0328336438), UINT64_C(0x20c60390908c1600),
+  UINT64_C(0x0580841758600a21), UINT64_C(0x0657014448c00188), UINT64_C(0x91a060adb042048a),
+  UINT64_C(0x6441070688400431), UINT64_C(0x98351815226edc80), UINT64_C(0x66410cc980360834),
+  UINT64_C(0x440c42e920964008), UINT64_C(0x50c30654c46ba712), UINT64_C(0x090201b048952182),
+  UINT64_C(0xc3b0016658902828), UINT64_C(0x8028b97208480b55), UINT64_C(0x11001a8502a53015),
+  UINT64_C(0x0006612b244544a0), UINT64_C(0xcd9c841d1a201661), UINT64_C(0x07808806a98a2d42),
+  UINT64_C(0x8e174a349749c080), UINT64_C(0x220447488c0be020), UINT64_C(0x70a113220130d1cc),
+  UINT64_C(0x18053200010b4440), UINT64_C(0x8a1c688182708400), UINT64_C(0x42828c28a939008c),
+  UINT64_C(0x25a7421318508327), UINT64_C(0x0710a2184c00b8a1), UINT64_C(0x18081580088cb138),
+  UINT64_C(0xdc692f600a361291), UINT64_C(0xc0d1e2a824482283), UINT64_C(0xa40b4d02a5112042),
+  UINT64_C(0x2610d1710b1902c6), UINT64_C(0x65a45ed130028300), UINT64_C(0x8050047245010228),
+  UINT64_C(0x00104682b28c8020), UINT64_C(0x9469bd2506984390), UINT64_C(0xc440e80a30c20203),
+  UINT64_C(0xd48034c011436f50), UINT64_C(0x0b2880e419830061), UINT64_C(0x6300624f08331004),
+  UINT64_C(0x3a12e88681016322), UINT64_C(0x1a02410c701420e9), UINT64_C(0x05d0bb25422452a9),
+  UINT64_C(0x440182101028065b), UINT64_C(0x489880030520866e), UINT64_C(0xcf884891f2084481),
+  UINT64_C(0x4005304ffcaa3622), UINT64_C(0x2341210806b89801), UINT64_C(0xd0b8040906020918),
+  UINT64_C(0x9469227200285138), UINT64_C(0x133c0b20206d0684), UINT64_C(0x6880480a04524350),
+  UINT64_C(0x20d2d60ce1850005), UINT64_C(0x020494112858b360), UINT64_C(0x84262d104b00e305),
+  UINT64_C(0x1210062bd6105122), UINT64_C(0x450a2742a82440d0), UINT64_C(0x06bcf1a327eaa804),
+  UINT64_C(0x4285d0018841c406), UINT64_C(0x0a929004713002c9), UINT64_C(0x4004405e08a28d22),
+  UINT64_C(0x884545c00a911a28), UINT64_C(0x5202272832543ca0), UINT64_C(0xa0d10252c4660c05),
+  UINT64_C(0x01a0d1b8002b2046), UINT64_C(0xe0c9658396164418), UINT64_C(0x83ac00dc410a5702),
+  UINT64_C(0x010c781610e10804), UINT64_C(0x144020ac14d13220), UINT64_C(0xc80b4143b204c462),
+  UINT64_C(0x680028032f848490), UINT64_C(0x082d00b440c1dc49), UINT64_C(0x244008581030029e),
+  UINT64_C(0x4920d99c298215c4), UINT64_C(0x26a4160290d33126), UINT64_C(0x24548d0085991a0a),
+  UINT64_C(0x200323a210906501), UINT64_C(0xb0ca8a31096a40a0), UINT64_C(0x0f5951a335804c58),
+  UINT64_C(0x12ca44008e10eb08), UINT64_C(0xc22059e5b0a34040), UINT64_C(0x020e989a68a1a845),
+  UINT64_C(0x9061240018200a89), UINT64_C(0x18884246fa8c0cca), UINT64_C(0xf8210e106c825e05),
+  UINT64_C(0x00d84305174a3400), UINT64_C(0x1a554048a610a026), UINT64_C(0xa0a8508980ac5203),
+  UINT64_C(0x0223105051621021), UINT64_C(0xa607093641554b1c), UINT64_C(0x3323010f4a09a190),
+  UINT64_C(0x0800837422a20824), UINT64_C(0x1788188466856609), UINT64_C(0x8644319138000cf8),
+  UINT64_C(0x67d4433470240209), UINT64_C(0x1123c08059002830), UINT64_C(0x1222cb20129da024),
+  UINT64_C(0x190222614c8450b1), UINT64_C(0x258b2c52cb0a0091), UINT64_C(0x8030ba190400a4c8),
+  UINT64_C(0xbc9020a309110bb6), UINT64_C(0xa3248100532b0088), UINT64_C(0x64a0228684038117),
+  UINT64_C(0x9424001a4c0083b4), UINT64_C(0x10286420c08e0041), UINT64_C(0x0430242283ca9a19),
+  UINT64_C(0xd5681bb012412a05), UINT64_C(0xa00d5519022169e2), UINT64_C(0x6816400522086082),
+  UINT64_C(0x7103ca832118a644), UINT64_C(0x123204c0d06d9186), UINT64_C(0x630e600198082578),
+  UINT64_C(0xe1609122aed2c420), UINT64_C(0x8a043b20164d1001), UINT64_C(0x3a04795a13704610),
+  UINT64_C(0x8024154c480206c1), UINT64_C(0x71a184036118a804), UINT64_C(0x0c11e222c4810a11),
+  UINT64_C(0x28ac154944d05c68), UINT64_C(0x0c40101581f6c050), UINT64_C(0x84c1b1010004464b),
+  UINT64_C(0x08c2a402144680b0), UINT64_C(0x4b581b8402a803ac), UINT64_C(0x54878880c9828220),
+  UINT64_C(0x8051e8560258013a), UINT64_C(0xb010318834025810), UINT64_C(0x1018942388c44c29),
+  UINT64_C(0x9b5189b31001bc92), UINT64_C(0xb842283a210007d0), UINT64_C(0x8c4c036930942043),
+  UINT64_C(0x412340c9c43aa204), UINT64_C(0x3146012246106203), UINT64_C(0x400c2486824025ca),
+  UINT64_C(0xa0403b156014cc40), UINT64_C(0xc0f4e8071521688a), UINT64_C(0x404f80002c420508),
+  UINT64_C(0x2998084822814740), UINT64_C(0x4248545950030741), UINT64_C(0x3850878882cca082),
+  UINT64_C(0xf29020885e4714c1), UINT64_C(0x90118123c302992d), UINT64_C(0x1925201801466812),
+  UINT64_C(0x540c892931206094), UINT64_C(0x4bb286a5133c62ad), UINT64_C(0x014668c601c08e04),
+  UINT64_C(0x101764e00170d206), UINT64_C(0x609053a82c981900), UINT64_C(0x48a82d046c74c220),
+  UINT64_C(0x05254014640d2808), UINT64_C(0x6409a8c03843048a), UINT64_C(0xc04ac5302a1a6201),
+  UINT64_C(0x12c50e4611321403), UINT64_C(0x00308b484bf1018c), UINT64_C(0x41287460921c0413),
+  UINT64_C(0xc940264248048009), UINT64_C(0x544d1a3437850200), UINT64_C(0x860151c20902ac18),
+  UINT64_C(0x8aa2818488155268), UINT64_C(0x442200cc00539830), UINT64_C(0x822263089449898b),
+  UINT64_C(0x59a501c5800c343b), UINT64_C(0x1c1b2114c2c81730), UINT64_C(0x8a1582201500504e),
+  UINT64_C(0x60138568a650c302), UINT64_C(0x880250d882302502), UINT64_C(0x30a43a02595b3174),
+  UINT64_C(0x0b524882c38900a6), UINT64_C(0x410201aa345a0498), UINT64_C(0x6d4080442a229101),
+  UINT64_C(0x5898209821005ac5), UINT64_C(0x0004f4500d070302), UINT64_C(0x8770010843072024),
+  UINT64_C(0x7669841488083003), UINT64_C(0x0452494611443889), UINT64_C(0x43850040e007a990),
+  UINT64_C(0x84203e1004068184), UINT64_C(0xc291383012235095), UINT64_C(0x520340423560c088),
+  UINT64_C(0x82885c015102658a), UINT64_C(0x21006242142a9825), UINT64_C(0xa51282400c616015),
+  UINT64_C(0xc22c06481c8e89b2), UINT64_C(0x05108071419c0661), UINT64_C(0x8208613a26c31c46),
+  UINT64_C(0x1651055a2050a584), UINT64_C(0x41608431e0081129), UINT64_C(0x016c4a0914108741),
+  UINT64_C(0x096408c21d04a306), UINT64_C(0x2a9274241ac84498), UINT64_C(0x048b812181c05388),
+  UINT64_C(0x089572311446884d), UINT64_C(0x6600a10811100234), UINT64_C(0x06101441e08f4402),
+  UINT64_C(0x118c84c850b18a12), UINT64_C(0x26210e861c151014), UINT64_C(0x2a8a0347a085e048),
+  UINT64_C(0x11d02124e416c95c), UINT64_C(0xc5c0423a6382a449), UINT64_C(0x50ce10001c2046a6),
+  UINT64_C(0xa0c442d42a190483), UINT64_C(0x47ec108209e9a202), UINT64_C(0x20132a3c0460c801),
+  UINT64_C(0x8900500b1c922528), UINT64_C(0xc051b641280a5820), UINT64_C(0x90ec820201c138d1),
+  UINT64_C(0x340ac13804542f04), UINT64_C(0xa8aa1d14b1a94582), UINT64_C(0x17221a0c4cc03125),
+  UINT64_C(0x08222720d9201818), UINT64_C(0x3320008d08526560), UINT64_C(0xd5180c164200c679),
+  UINT64_C(0x41bcd0a920680288), UINT64_C(0x284f4000b215c058), UINT64_C(0x65140bd10002008c),
+  UINT64_C(0x102836d111699812), UINT64_C(0x8100057442401223), UINT64_C(0xeb2103803a461980),
+  UINT64_C(0xa4990c46061c0889), UINT64_C(0x0420a81045413094), UINT64_C(0x58452c129820e0d6),
+  UINT64_C(0x0962802d012e1221), UINT64_C(0x10825683a1100e41), UINT64_C(0x9204a4244f802932),
+  UINT64_C(0x0ab970ac0a54d118), UINT64_C(0x0000020706c4932c), UINT64_C(0x990001935042c213),
+  UINT64_C(0x0808c002a851005c), UINT64_C(0x4cba42b0b1004287), UINT64_C(0x0604c800a5188045),
+  UINT64_C(0x1320a86083c86813), UINT64_C(0x388404c18c9e6cdb), UINT64_C(0x58590012c4341508),
+  UINT64_C(0x0b4903a460c16200), UINT64_C(0x8644018111720086), UINT64_C(0x20ba902412271240),
+  UINT64_C(0x238aac8948401451), UINT64_C(0x8c60048ad8804029), UINT64_C(0x6114402c22108c40),
+  UINT64_C(0x991228002c565b00), UINT64_C(0x10e4c232350a8c40), UINT64_C(0x609774188b2700e8),
+  UINT64_C(0xe0465218018240cc), UINT64_C(0x7000248984708107), UINT64_C(0x2201460484692920),
+  UINT64_C(0x120e44c994d9c4b0), UINT64_C(0x614898040c38824d), UINT64_C(0x8c0c820153202895),
+  UINT64_C(0x8c02e0030920e460), UINT64_C(0xa6c80410c8923623), UINT64_C(0x45c90680f0120836),
+  UINT64_C(0x124000205090600b), UINT64_C(0x219060c04400396a), UINT64_C(0x34aa1262a12c1d14),
+  UINT64_C(0x09099215560340d3), UINT64_C(0x62c319400601c546), UINT64_C(0x21e40c8998005422),
+  UINT64_C(0x622da20584080f40), UINT64_C(0x1222ea121284b008), UINT64_C(0x180c308a448fe001),
+  UINT64_C(0x09a8825248d612a4), UINT64_C(0x0f119002240a1cd4), UINT64_C(0x801a904304418524),
+  UINT64_C(0x04705b00c8240084), UINT64_C(0x148e280130a0a204), UINT64_C(0x9856ac80556801b1),
+  UINT64_C(0x31904040fe05200a), UINT64_C(0x8423a0208a808d08), UINT64_C(0x47444911144b0010),
+  UINT64_C(0x82000888117405c0), UINT64_C(0x4600c42459237703), UINT64_C(0x674168425003be21),
+  UINT64_C(0x1a40a18c501d4b83), UINT64_C(0x80a217652200d1c0), UINT64_C(0x48420520ae8c0028),
+  UINT64_C(0x088401936600121a), UINT64_C(0x088c00a110630564), UINT64_C(0x85c4108028a02365),
+  UINT64_C(0x610c04c8c010ac12), UINT64_C(0x0504e8620020922a), UINT64_C(0x4312108c5c405c88),
+  UINT64_C(0x08503231e8205618), UINT64_C(0x8b5508a120a0b488), UINT64_C(0x70c045a815462046),
+  UINT64_C(0x0222c229122301ac), UINT64_C(0x34e788144c732951), UINT64_C(0xa860419815240a04),
+  UINT64_C(0xa1a9320dd2039041), UINT64_C(0x04983c61008c0a11), UINT64_C(0x024860a620205e02),
+  UINT64_C(0x0494d102b8510620), UINT64_C(0x0cb4070469166348), UINT64_C(0x5043920009681362),
+  UINT64_C(0xa930443c42cd080c), UINT64_C(0xa2191000ee9021a2), UINT64_C(0x88128341a5644d64),
+  UINT64_C(0x4615b004002b7041), UINT64_C(0x2c4058e813004a14), UINT64_C(0x03a400c00019004e),
+  UINT64_C(0x06454cd311102272), UINT64_C(0x2340254a0a91483c), UINT64_C(0x82081168829b9819),
+  UINT64_C(0x9922284109c25238), UINT64_C(0x8414718c44c02803), UINT64_C(0x44c9a11212102e48),
+  UINT64_C(0x00009020da1024c0), UINT64_C(0x20a6024514898042), UINT64_C(0x2446820404306225),
+  UINT64_C(0x51846542061c0c53), UINT64_C(0xe0601a2787064658), UINT64_C(0x944d3b300229aa90),
+  UINT64_C(0x90da21ca9d41c09c), UINT64_C(0x014059d82a064102), UINT64_C(0x3280041715022e31),
+  UINT64_C(0x0930844845c02803), UINT64_C(0x90046085a8079030), UINT64_C(0xc48b063000980820),
+  UINT64_C(0x18188211344d3c00), UINT64_C(0x0a40d8a10c428926), UINT64_C(0xc1849a41c12c02c5),
+  UINT64_C(0x620c000e8031b703), UINT64_C(0xb20120969d4c609d), UINT64_C(0x922434058413540a),
+  UINT64_C(0x4132a343264a0b01), UINT64_C(0x1518389a2426e445), UINT64_C(0xd24f45780045ea10),
+  UINT64_C(0xe280c208010e2421), UINT64_C(0x24086092898b1a31), UINT64_C(0x021108680061e0aa),
+  UINT64_C(0x50010481009c60c2), UINT64_C(0xe408840186124600), UINT64_C(0x42590200072c2416),
+  UINT64_C(0x18105c003124c018), UINT64_C(0x64c60104193a5384), UINT64_C(0x42e3d01998c88923),
+  UINT64_C(0x1804e04842341219), UINT64_C(0xc9354248544724a8), UINT64_C(0x0990a45408068a1c),
+  UINT64_C(0x40c14b20424c3a15), UINT64_C(0x9459d43100220880), UINT64_C(0x2bc00cf96298016c),
+  UINT64_C(0x1448060039a08102), UINT64_C(0xa1322c1654190380), UINT64_C(0x909642825a0c2181),
+  UINT64_C(0x602a19218140108c), UINT64_C(0x01042aa510c7180b), UINT64_C(0x0a1c1940261045e0),
+  UINT64_C(0x08248069b1a051ea), UINT64_C(0x40a9024080f00c72), UINT64_C(0x39236702821419b7),
+  UINT64_C(0x289b052c3046e141), UINT64_C(0x588307406d021335), UINT64_C(0xd0884198040ac495),
+  UINT64_C(0x1a5238508e420000), UINT64_C(0x480815d080142725), UINT64_C(0x33a0fc82b8611400),
+  UINT64_C(0xa5456a58040c013a), UINT64_C(0x129e0104488501e0), UINT64_C(0x992a842028220291),
+  UINT64_C(0x4d01000013812483), UINT64_C(0x905225b2a2400152), UINT64_C(0x2260440540a44589),
+  UINT64_C(0x172702912053ab04), UINT64_C(0x0001861a440ce882), UINT64_C(0xb903008e541110d1),
+  UINT64_C(0x641115466c1c8ac8), UINT64_C(0x051809242382a41c), UINT64_C(0x0483016998448b16),
+  UINT64_C(0xa32294010211120c), UINT64_C(0x0561008000631912), UINT64_C(0x2c7401d0195428bc),
+  UINT64_C(0x6a084000b2c20563), UINT64_C(0x80cb004487305089), UINT64_C(0x5985fa040004c018),
+  UINT64_C(0x180971c80a10468e), UINT64_C(0x414410b0020f06a4), UINT64_C(0x70072244a5802d45),
+  UINT64_C(0x060208ac0e3900b2), UINT64_C(0x010901ce8e8d5018), UINT64_C(0x90a81d1521928968),
+  UINT64_C(0x9625600421a2349a), UINT64_C(0xa405e90902208c00), UINT64_C(0x44404f0c52052063),
+  UINT64_C(0x00aeca0670aa8c20), UINT64_C(0x1214acc8092441b8), UINT64_C(0x018404401c100511),
+  UINT64_C(0x0042902188320484), UINT64_C(0x1e117003106d0e95), UINT64_C(0x844a3c6013202192),
+  UINT64_C(0x66520394902c070b), UINT64_C(0x6200c88c51212a40), UINT64_C(0x014382be11884000),
+  UINT64_C(0xa0b4058f00d52c60), UINT64_C(0x0c9a0800abd04181), UINT64_C(0x9630c1145001400a),
+  UINT64_C(0x40c2495187202130), UINT64_C(0x246602014a162188), UINT64_C(0x73248c00c9289530),
+  UINT64_C(0x8810223016d1c09c), UINT64_C(0x6206550382583890), UINT64_C(0x00f92a47000a0c15),
+  UINT64_C(0x860c601111a40c8c), UINT64_C(0x561931881924831a), UINT64_C(0x42444b2470843022),
+  UINT64_C(0x6740c012fd801204), UINT64_C(0x22060060805c810b), UINT64_C(0x11b06128a0418803),
+  UINT64_C(0x710886214020dc0d), UINT64_C(0x904c20974506d209), UINT64_C(0x60880820b5700a06),
+  UINT64_C(0x86aa940c210b02aa), UINT64_C(0x404b700020218501), UINT64_C(0x9a20095200a45088),
+  UINT64_C(0xca0411831c801872), UINT64_C(0x41410a0320e40c90), UINT64_C(0x5309019e20c82640),
+  UINT64_C(0x3e4b99221225a062), UINT64_C(0x0e428314a9333201), UINT64_C(0x10c804908c001a51),
+  UINT64_C(0x1050228080658331), UINT64_C(0x410f31044a19a089), UINT64_C(0x4591a84688584228),
+  UINT64_C(0x4045b8240208000a), UINT64_C(0x0000d0d82e26c7c4), UINT64_C(0x8004007c89025442),
+  UINT64_C(0x51c502c831209847), UINT64_C(0x200026ac0a014835), UINT64_C(0x823b010be0d2c002),
+  UINT64_C(0x48110224cc2803c1), UINT64_C(0x08ac0898022e80c4), UINT64_C(0x888ab0a894264034),
+  UINT64_C(0xaf1a011149012126), UINT64_C(0x07854c4071512d24), UINT64_C(0x2030092804300220),
+  UINT64_C(0x202007436a468dc8), UINT64_C(0x44438032e4cc95b8), UINT64_C(0xcc2c00a142698817),
+  UINT64_C(0x4001ec3010004002), UINT64_C(0xa014834c200665c9), UINT64_C(0x06c1a848c81b1011),
+  UINT64_C(0x306387cad524120b), UINT64_C(0x22981420d016a450), UINT64_C(0x294817072aa00141),
+  UINT64_C(0x50b8a0ad1001d290), UINT64_C(0x2056f078a047480c), UINT64_C(0x48105219290310c8),
+  UINT64_C(0x520e060708c80501), UINT64_C(0x1d45a654482010a0), UINT64_C(0x410a5280a29d2990),
+  UINT64_C(0x041988514608dc64), UINT64_C(0x0d9459010388f243), UINT64_C(0xb047313333022192),
+  UINT64_C(0x8a088e80c8384529), UINT64_C(0x70024490c0082c13), UINT64_C(0x8467804c4ce02212),
+  UINT64_C(0x6906100c2ed00801), UINT64_C(0xa820305461a20adc), UINT64_C(0x873041264401e048),
+  UINT64_C(0x00dd400a93018c86), UINT64_C(0x82a8420850085067), UINT64_C(0x0444000c80311c21),
+  UINT64_C(0x280563000a11a932), UINT64_C(0xb8a90288000085c2), UINT64_C(0x419104704a400568),
+  UINT64_C(0xd1511a251564a056), UINT64_C(0x500c64028a4009a0), UINT64_C(0x2a120089a0005326),
+  UINT64_C(0x14a69c4c3c508a11), UINT64_C(0x112045161121b003), UINT64_C(0xc299466a6012a480),
+  UINT64_C(0x1cb0b4022d920c40), UINT64_C(0x0005083020a1308b), UINT64_C(0x625001b0a6200922),
+  UINT64_C(0x8d22cc0872161148), UINT64_C(0x21203a1401012402), UINT64_C(0x06144a5405a50303),
+  UINT64_C(0x218061456c828120), UINT64_C(0x8082831608581030), UINT64_C(0x4410ba0901c60444),
+  UINT64_C(0x081ac1129023c3a2), UINT64_C(0xc068038091050685), UINT64_C(0x52c91e9c78022271),
+  UINT64_C(0x8a20401cc0185028), UINT64_C(0x1a0050602281690b), UINT64_C(0x158b0f410220d00c),
+  UINT64_C(0x92a8000140452082), UINT64_C(0x9c9240c3b010e938), UINT64_C(0x21745120913a030a),
+  UINT64_C(0x45a26298b8e18401), UINT64_C(0xa006a30205011024), UINT64_C(0x490135220c8c184a),
+  UINT64_C(0x54590f4388781855), UINT64_C(0x0500f03a678a1283), UINT64_C(0x0a90040811638400),
+  UINT64_C(0x654600c102b23385), UINT64_C(0x34890251ac002054), UINT64_C(0x020020164f5cc203),
+  UINT64_C(0x829557064000add1), UINT64_C(0x114aa806e00009a0), UINT64_C(0x097d019c06218858),
+  UINT64_C(0x580e804220432904), UINT64_C(0x001c06c938054663), UINT64_C(0x02084451996a3041),
+  UINT64_C(0x28104c14880c2894), UINT64_C(0x2a940528c4176002), UINT64_C(0x0002303106c85899),
+  UINT64_C(0xd4208a1a64ac6e5b), UINT64_C(0xc80c80481c412260), UINT64_C(0xc40017e0021d0088),
+  UINT64_C(0x30c480c9a8901410), UINT64_C(0x803209720a94930a), UINT64_C(0x31a2540122859460),
+  UINT64_C(0x94022102454a4540), UINT64_C(0x50598120214312ca), UINT64_C(0x3e0158288f000f64),
+  UINT64_C(0x86401c7443030026), UINT64_C(0x5240d8c481620156), UINT64_C(0x04012a6896901090),
+  UINT64_C(0x28210288d440b431), UINT64_C(0x38820c262848c908), UINT64_C(0x5544800a156a9202),
+  UINT64_C(0x088200282e02043c), UINT64_C(0x898648c968863204), UINT64_C(0x4347609169a00030),
+  UINT64_C(0x045160a618ec9a0e), UINT64_C(0x3103000430410140), UINT64_C(0x24b8801325089024),
+  UINT64_C(0x53a1d0206383c20a), UINT64_C(0x2808091aab1047c0), UINT64_C(0xe0668e55901c218e),
+  UINT64_C(0x528c6c0480090460), UINT64_C(0x247420a09021b92c), UINT64_C(0x801b22e0b8514850),
+  UINT64_C(0x05001b1443f649b4), UINT64_C(0x152993310120c658), UINT64_C(0x3c4cc8e2a115a440),
+  UINT64_C(0x00880e900a133080), UINT64_C(0x2645481784502425), UINT64_C(0x18112298c150f002),
+  UINT64_C(0x58a871c084081002), UINT64_C(0x50b33024c6265011), UINT64_C(0xce50400052088487),
+  UINT64_C(0xe0c02c018c30a190), UINT64_C(0x0c00400918841162), UINT64_C(0x1024481a61c28d04),
+  UINT64_C(0x810680d094248983), UINT64_C(0x020106084a8aa832), UINT64_C(0x48928224c60c04c0),
+  UINT64_C(0x10480139008d9c0c), UINT64_C(0x4c043c60835201c0), UINT64_C(0x2440c780c2880008),
+  UINT64_C(0x41af8a5284610441), UINT64_C(0x2f02002086b82a90), UINT64_C(0xa02460445881d890),
+  UINT64_C(0xc889206320f29065), UINT64_C(0x4390019211a03c59), UINT64_C(0xc008104818440682),
+  UINT64_C(0x66008a8863343401), UINT64_C(0x42ca10063c030410), UINT64_C(0x2443096403084881),
+  UINT64_C(0x4b00740d02025801), UINT64_C(0x884024414c1a9041), UINT64_C(0xd80028361165c214),
+  UINT64_C(0x00c724122601014e), UINT64_C(0x84948d88212067a8), UINT64_C(0x02a1004108001214),
+  UINT64_C(0x02028c4c0ae40091), UINT64_C(0xc01a530f4042851a), UINT64_C(0xa881896582ba8074),
+  UINT64_C(0x08d043a245083612), UINT64_C(0x92111c62a1510084), UINT64_C(0x0d020870c1386340),
+  UINT64_C(0x24ae021309100a44), UINT64_C(0x904082e81c093009), UINT64_C(0x21865080a4894933),
+  UINT64_C(0x4129300461e20c30), UINT64_C(0x0068309232445e0b), UINT64_C(0x600c80123a100cb8),
+  UINT64_C(0x4a0842a158820162), UINT64_C(0x6404665490881435), UINT64_C(0x054089045ac92101),
+  UINT64_C(0x9206062da482f041), UINT64_C(0x4cb00741c50e1064), UINT64_C(0xcc2d882b26804883),
+  UINT64_C(0x8850a4580044e492), UINT64_C(0x6188104063210306), UINT64_C(0x73220084d0b13a14),
+  UINT64_C(0x2c00695408c41311), UINT64_C(0xd28c008250800c81), UINT64_C(0x0402803068680b48),
+  UINT64_C(0x1d046b01720e8681), UINT64_C(0x505190001e060ca4), UINT64_C(0x00249444208a10aa),
+  UINT64_C(0x2780ac1841199243), UINT64_C(0xa84122aa14b4c994), UINT64_C(0x0a1522a3181c4561),
+  UINT64_C(0x74080130034cc704), UINT64_C(0x5380102e10c10c80), UINT64_C(0xe20e011b14004312),
+  UINT64_C(0x6a3206845a070605), UINT64_C(0x172080d884c08062), UINT64_C(0x85652886c104100a),
+  UINT64_C(0x3010048294581183), UINT64_C(0x3860870741484cc8), UINT64_C(0x0bf5500061e5b012),
+  UINT64_C(0xa400801138020a12), UINT64_C(0x6246943812105260), UINT64_C(0x00c43e9028d08022),
+  UINT64_C(0x2254284642d0518e), UINT64_C(0x831851aaa21e0130), UINT64_C(0x908a055609220659),
+  UINT64_C(0xca4d502c102c8a81), UINT64_C(0x5a91a17031318408), UINT64_C(0x0d5041080a800067),
+  UINT64_C(0x024a080c31918027), UINT64_C(0x3420e338045dc129), UINT64_C(0x28884449840a4801),
+  UINT64_C(0x21eb28470c2202bc), UINT64_C(0x0a11600040450442), UINT64_C(0x0400d002a4600220),
+  UINT64_C(0x6906ca65a0204020), UINT64_C(0x20245cc040432345), UINT64_C(0x0706c79a54084aba),
+  UINT64_C(0x62ad05c82815040b), UINT64_C(0x8101812446c00a35), UINT64_C(0x84c1c12d432610c0),
+  UINT64_C(0x2444b5b00210014c), UINT64_C(0x856252a042343504), UINT64_C(0x3081020b1410a040),
+  UINT64_C(0x11166b401d004a0b), UINT64_C(0x001c206084402432), UINT64_C(0x6d019a6088040c40),
+  UINT64_C(0xc29c3a052581a241), UINT64_C(0x5a1320329962a120), UINT64_C(0x8a100485ca3510c8),
+  UINT64_C(0x15401012c1403910), UINT64_C(0x0c04010840c08905), UINT64_C(0x710704ac2ac44031),
+  UINT64_C(0x892a343129b09891), UINT64_C(0x90440017414ee04d), UINT64_C(0x188205b139206022),
+  UINT64_C(0xc0200d243011730c), UINT64_C(0x4146c04e88390953), UINT64_C(0x2a1000125a613304),
+  UINT64_C(0x820874c084061448), UINT64_C(0xc088061102b01459), UINT64_C(0x01208912064c0084),
+  UINT64_C(0xa450c04a82216144), UINT64_C(0x47444d01c286428d), UINT64_C(0x008f188848820210),
+  UINT64_C(0x3a0502245f0801a0), UINT64_C(0xa08823237a0180b0), UINT64_C(0x1068ac4421d84504),
+  UINT64_C(0x8d8c41af02624a13), UINT64_C(0x501808810861442c), UINT64_C(0x857a0610000452ab),
+  UINT64_C(0x1289c010900a0056), UINT64_C(0x8933c42809894016), UINT64_C(0x080103648682250a),
+  UINT64_C(0x0102120105e6086c), UINT64_C(0x4820510014023ad2), UINT64_C(0x1041b0f10061a21e),
+  UINT64_C(0x67401884a82c0183), UINT64_C(0x024ac48e4c528204), UINT64_C(0x2960828294001801),
+  UINT64_C(0xab2814400c970850), UINT64_C(0x04132310a9040790), UINT64_C(0x50c1082e40080a01),
+  UINT64_C(0xa402a18828076ae0), UINT64_C(0x26169050209310ca), UINT64_C(0x0601e44c81e18121),
+  UINT64_C(0x0440814813282011), UINT64_C(0x391132a3005295a1), UINT64_C(0xe4c00562cc400425),
+  UINT64_C(0xc160010b02ca2a0c), UINT64_C(0x040ea8d09c61c400), UINT64_C(0x0280581d22a260c5),
+  UINT64_C(0x0428048274a09460), UINT64_C(0x01004590c3141801), UINT64_C(0xd090728058875572),
+  UINT64_C(0x206a950640088d88), UINT64_C(0x0d30801c200e9a81), UINT64_C(0x0000e8138e062492),
+  UINT64_C(0x80a68a950a0951e0), UINT64_C(0x614a76171c610300), UINT64_C(0x8256200e92108028),
+  UINT64_C(0xa031004080d8180a), UINT64_C(0x0c18830140129fa1), UINT64_C(0x01001108658d2a5a),
+  UINT64_C(0x2209c19039350836), UINT64_C(0xaa4a878cd09666c4), UINT64_C(0x30aa8459e01b9d46),
+  UINT64_C(0x14602400c245e928), UINT64_C(0x01a3210350842402), UINT64_C(0x09d9a81040200020),
+  UINT64_C(0x1799320402282804), UINT64_C(0xd41c7009b120863e), UINT64_C(0x818ad27902881068),
+  UINT64_C(0x600482d43d02a900), UINT64_C(0x9234842285086231), UINT64_C(0x8a05440b408000b0),
+  UINT64_C(0xd5420d26810641c0), UINT64_C(0x06a88812056348c0), UINT64_C(0x52516090ad274844),
+  UINT64_C(0xa1a44010a21a0648), UINT64_C(0x036018484921a405), UINT64_C(0x10440d84005ca28a),
+  UINT64_C(0x019845063008d4a2), UINT64_C(0x4511b24308c41424), UINT64_C(0x0280201450e09811),
+  UINT64_C(0x4657b1111d4306f2), UINT64_C(0x02208c5c0808302b), UINT64_C(0x4400380ac1182412),
+  UINT64_C(0x2825cc40d69029a1), UINT64_C(0x502616c420058143), UINT64_C(0x80420b2021040001),
+  UINT64_C(0x0a2920115100264c), UINT64_C(0x920449130654c208), UINT64_C(0x022a4524c9a14724),
+  UINT64_C(0x0048108e84200344), UINT64_C(0x0d0244cc4a0110b0), UINT64_C(0x482423a21043adca),
+  UINT64_C(0x14810a21e8c00c15), UINT64_C(0x84c0f83070884650), UINT64_C(0x0252414a8416e062),
+  UINT64_C(0x4a60d78880092025), UINT64_C(0x5043a08820b01f13), UINT64_C(0x0a7002464d30210b),
+  UINT64_C(0x880601607a0c0931), UINT64_C(0xb05984416f00cc10), UINT64_C(0x0568001924808c08),
+  UINT64_C(0x1a8024021314c8ac), UINT64_C(0x0538071918846400), UINT64_C(0x45e04844380b8023),
+  UINT64_C(0x1c3208a291140200), UINT64_C(0x28251200520d5888), UINT64_C(0x4dc2876007d04104),
+  UINT64_C(0xc8617a0126089882), UINT64_C(0xd0040861820101e2), UINT64_C(0x214a004002a1602b),
+  UINT64_C(0x258e8480c0a2a900), UINT64_C(0x05004a8218505315), UINT64_C(0x120a328912140429),
+  UINT64_C(0x850834714c005238), UINT64_C(0x9b05482200c02099), UINT64_C(0x00d211b8a0112de0),
+  UINT64_C(0x24084d55b132450a), UINT64_C(0x60e508c160880264), UINT64_C(0x100000f0022c4b0a),
+  UINT64_C(0x891804678e40c5d3), UINT64_C(0xb0912e05095c0da9), UINT64_C(0xd200092107c26012),
+  UINT64_C(0x821138e810074a04), UINT64_C(0x2dba800851b00005), UINT64_C(0x400f124328483800),
+  UINT64_C(0x2630639c40811a8c), UINT64_C(0x00a8100004490003), UINT64_C(0x101a1a3622129821),
+  UINT64_C(0x1004c18d60e08209), UINT64_C(0xf0ca241a84204348), UINT64_C(0x094880841a2f0284),
+  UINT64_C(0x2407229198690865), UINT64_C(0x81166c285fe1921a), UINT64_C(0xe29210a110480918),
+  UINT64_C(0x04089e020a124290), UINT64_C(0x405c630835848008), UINT64_C(0xcc00ad42990586c6),
+  UINT64_C(0x2660533831000080), UINT64_C(0x0240140040a01020), UINT64_C(0x2e146d5c0a8c9804),
+  UINT64_C(0x91a622a9208470c0), UINT64_C(0x0031a00100044084), UINT64_C(0xd19c409553096819),
+  UINT64_C(0x068011002c01aa0a), UINT64_C(0x088092c010884148), UINT64_C(0x010062012dc0a260),
+  UINT64_C(0x8872c0081048b021), UINT64_C(0x8a052460d00d2409), UINT64_C(0x0170b80005925814),
+  UINT64_C(0x08c5010665202886), UINT64_C(0x32c2d8f00c56c3d4), UINT64_C(0x4508926051a43604),
+  UINT64_C(0x11280c4c44021164), UINT64_C(0x01426f0010b0ab00), UINT64_C(0x83150409ee912988),
+  UINT64_C(0x6453090000645260), UINT64_C(0x0f8c011711460e50), UINT64_C(0x52198481810381f8),
+  UINT64_C(0x2e48070568b00408), UINT64_C(0x5180688c01523820), UINT64_C(0x007142628138400f),
+  UINT64_C(0x310240a182c89810), UINT64_C(0xd10981320020c94c), UINT64_C(0x522112a00609a006),
+  UINT64_C(0x928835d088048ca0), UINT64_C(0xa11409e46a03020c), UINT64_C(0x0204700490111311),
+  UINT64_C(0x1700aa1c18616a80), UINT64_C(0x08256284400a5080), UINT64_C(0x1068831263300020),
+  UINT64_C(0xd408801406030485), UINT64_C(0x8c90d94304016464), UINT64_C(0x4a1205a02b1e3143),
+  UINT64_C(0x04045a4000221450), UINT64_C(0x383228501275a382), UINT64_C(0xc8041480e05c09d0),
+  UINT64_C(0xf181050460aa4910), UINT64_C(0x04000283220c0010), UINT64_C(0x161ead9009520834),
+  UINT64_C(0x41484481898422e8), UINT64_C(0x0165001170e8a220), UINT64_C(0x0803c7805c5c0300),
+  UINT64_C(0x0027430732d42c62), UINT64_C(0x213190300ec092c0), UINT64_C(0x4008102b20021284),
+  UINT64_C(0x920024619910858a), UINT64_C(0xa0cc410148a0426d), UINT64_C(0x0462a0c320833204),
+  UINT64_C(0x0c20892688dc0015), UINT64_C(0x4004050208d03071), UINT64_C(0xc1182447c8828a70),
+  UINT64_C(0x199400280100aa18), UINT64_C(0x8210219209054834), UINT64_C(0xa21e0818b0b83181),
+  UINT64_C(0x14a2c68405201811), UINT64_C(0x2542a0628320080a), UINT64_C(0x720704c850440429),
+  UINT64_C(0x841321010cb8c101), UINT64_C(0xc0a598a03648009e), UINT64_C(0xa0c0314a06514374),
+  UINT64_C(0x07148c006191210d), UINT64_C(0x1460864644010f12), UINT64_C(0xb16142b80080b8b1),
+  UINT64_C(0x2b090684301700a0), UINT64_C(0x04220004005e4065), UINT64_C(0x400011196201a0c7),
+  UINT64_C(0x104dec802820444a), UINT64_C(0x21ae029148220221), UINT64_C(0x41c4305755d08a62),
+  UINT64_C(0x83256c88010101b0), UINT64_C(0x2a87500e3402905b), UINT64_C(0x4920884324f01c1c),
+  UINT64_C(0x9c54b12041891090), UINT64_C(0x0610602a20660812), UINT64_C(0xe32a931871862542),
+  UINT64_C(0x12aa544104a21100), UINT64_C(0x3700c26c0f311885), UINT64_C(0x882a50000c96a041),
+  UINT64_C(0x817a123781665008), UINT64_C(0xd618002062ac8484), UINT64_C(0x408129002b508422),
+  UINT64_C(0x4046195480a01262), UINT64_C(0x650ac84958c08035), UINT64_C(0x0e40a4001920b1a2),
+  UINT64_C(0x3a14658d1a408451), UINT64_C(0x98e1122648065080), UINT64_C(0x04588a18026de400),
+  UINT64_C(0x1097106805620282), UINT64_C(0x448644a800102087), UINT64_C(0x3349a20289201010),
+  UINT64_C(0x04102de604406000), UINT64_C(0xc2093089dac10922), UINT64_C(0x01c1320480248220),
+  UINT64_C(0x98b0419750027c11), UINT64_C(0x400e31d28404290a), UINT64_C(0x4590c624d30c0483),
+  UINT64_C(0x0488d00a280b0160), UINT64_C(0x8061c04801c0410e), UINT64_C(0x20a405e00a401983),
+  UINT64_C(0x6803923164084704), UINT64_C(0x9281ba8c0421008b), UINT64_C(0xaa491043026180f0),
+  UINT64_C(0x4008056c21224000), UINT64_C(0x0004281120919436), UINT64_C(0x1d060f1400601b9c),
+  UINT64_C(0x022a000898018c80), UINT64_C(0xb1f802008a660ce1), UINT64_C(0x10812b2234861646),
+  UINT64_C(0x161c043896260940), UINT64_C(0x07c04828c0106129), UINT64_C(0x00273841800a1453),
+  UINT64_C(0x0051a0a68b451213), UINT64_C(0x52186563b4090180), UINT64_C(0x917030400520cb90),
+  UINT64_C(0xc14d0130022fd246), UINT64_C(0xc01a50100f356044), UINT64_C(0x8c3a906121812221),
+  UINT64_C(0x4081281a88332002), UINT64_C(0x15214906140c2920), UINT64_C(0x9004024b0414c001),
+  UINT64_C(0x70531b048ac8984c), UINT64_C(0x10a040b0078a048c), UINT64_C(0x288e04099101660a),
+  UINT64_C(0x83824634b1046049), UINT64_C(0x0081e0c454222430), UINT64_C(0xa554013a864c802b),
+  UINT64_C(0x12a203884c90e818), UINT64_C(0x5d011152402019a1), UINT64_C(0x04e0619240a62e00),
+  UINT64_C(0x06caa0a203570510), UINT64_C(0x8cf806210113016e), UINT64_C(0x30e2e2090c080021),
+  UINT64_C(0x29224c081934da91), UINT64_C(0x22ba224092580420), UINT64_C(0x101b1620a5c480e8),
+  UINT64_C(0x8451390c134b0210), UINT64_C(0xe89301b1a0504122), UINT64_C(0xe0100ac90a125544),
+  UINT64_C(0x432010da00293813), UINT64_C(0x3615862cc8c4a80b), UINT64_C(0x9900512638187010),
+  UINT64_C(0x08c20614a02a1088), UINT64_C(0x0ab4808142046859), UINT64_C(0x108c29890004cc90),
+  UINT64_C(0x42f690014a351420), UINT64_C(0x21c5004018612523), UINT64_C(0x371041a49810889a),
+  UINT64_C(0x699832a098029003), UINT64_C(0x40029d4420c040cc), UINT64_C(0x51348030316800d1),
+  UINT64_C(0x06c90840104728e6), UINT64_C(0x08781490c28a5001), UINT64_C(0x20e40a0011a0ad04),
+  UINT64_C(0x1807061407d0e000), UINT64_C(0x400b4003841ac848), UINT64_C(0x080a2c3040084741),
+  UINT64_C(0x45d042a263452082), UINT64_C(0x30db45808250e002), UINT64_C(0x09448b183808152a),
+  UINT64_C(0x3280b0c140d2a524), UINT64_C(0x9a242004c4a1d3b8), UINT64_C(0x428040645a0210d8),
+  UINT64_C(0xa8230902070c0935), UINT64_C(0x82e890050747144e), UINT64_C(0x7e14cc28041501b0),
+  UINT64_C(0x0046044001804442), UINT64_C(0x21cc8e5805111300), UINT64_C(0xbc0200140301aa38),
+  UINT64_C(0x0012402be403c420), UINT64_C(0x0d9b112300e44405), UINT64_C(0x469c11967424da00),
+  UINT64_C(0x5c58411888458850), UINT64_C(0x0ea80831222812c6), UINT64_C(0x04aa140401801a64),
+  UINT64_C(0x041602005288e127), UINT64_C(0x1b040241089cc0d0), UINT64_C(0x08408202c3a01944),
+  UINT64_C(0x99241a8904229614), UINT64_C(0x44460090a801235c), UINT64_C(0x806a0da8592b0184),
+  UINT64_C(0x614b80122c000654), UINT64_C(0xb93008560501ab18), UINT64_C(0x1017306048c61881),
+  UINT64_C(0xc570a62308680040), UINT64_C(0x0409491c46070842), UINT64_C(0x0495881084232120),
+  UINT64_C(0x0412185c4a28528d), UINT64_C(0x048034583d329003), UINT64_C(0x996206108344408e),
+  UINT64_C(0xc80c424440d82928), UINT64_C(0x600001612480ceb0), UINT64_C(0x85803a00304f8a0a),
+  UINT64_C(0xa088049114424800), UINT64_C(0x0f0212f038032221), UINT64_C(0x13a04cc428490212),
+  UINT64_C(0x1220612e41d54121), UINT64_C(0x02275108e29508a0), UINT64_C(0x1162814442620088),
+  UINT64_C(0x4140888055882814), UINT64_C(0x9a0728011e254446), UINT64_C(0x2d960b148aa84400),
+  UINT64_C(0x3247240201c88400), UINT64_C(0xa240a80690ad130b), UINT64_C(0x480c704a06018410),
+  UINT64_C(0x0c503264a0424911), UINT64_C(0x400c810c4124b802), UINT64_C(0x4e9085a0b61042c0),
+  UINT64_C(0x04084504a0090027), UINT64_C(0x0463348469a23a32), UINT64_C(0x8042c8a81c343b01),
+  UINT64_C(0x9004020a9052a168), UINT64_C(0x08881a7122b8803c), UINT64_C(0x92951820074a180c),
+  UINT64_C(0x4e87e1082212820a), UINT64_C(0xe310000029103140), UINT64_C(0x1441c64d5c8a2d23),
+  UINT64_C(0x0040ec22010c90a7), UINT64_C(0x0990048ca8890c50), UINT64_C(0x8c83102060100844),
+  UINT64_C(0x02a1102944812299), UINT64_C(0x9408490208042044), UINT64_C(0xcb9012c10816718c),
+  UINT64_C(0x674b088044010820), UINT64_C(0x8121810284401ba0), UINT64_C(0x42100307104d9018),
+  UINT64_C(0xb9080445036442bc), UINT64_C(0x8910411f75485012), UINT64_C(0xb005449202200c38),
+  UINT64_C(0x8a88cc20000966a5), UINT64_C(0x14408a1195291120), UINT64_C(0x243708804491a00e),
+  UINT64_C(0xe0ab40220a0ed900), UINT64_C(0x98c0a0564f104608), UINT64_C(0x0194680160450a08),
+  UINT64_C(0x104050e1a2320304), UINT64_C(0x61648801a2884042), UINT64_C(0x2486e00d3c41a510),
+  UINT64_C(0x0a5302f0ccc81200), UINT64_C(0x238000ecc8c00841), UINT64_C(0xa00a0404430804b4),
+  UINT64_C(0x00a50a0635eab84f), UINT64_C(0x5291082001302068), UINT64_C(0x2520cb8070102684),
+  UINT64_C(0x10410a1a88788345), UINT64_C(0x004300b01a048034), UINT64_C(0xc383218166822010),
+  UINT64_C(0x05a231570a544d01), UINT64_C(0x40b0211021211a44), UINT64_C(0x9408c0298841e18a),
+  UINT64_C(0xec408045f31e324a), UINT64_C(0x2022429019d10a40), UINT64_C(0xa0200634048d1080),
+  UINT64_C(0x0195132d86c040fa), UINT64_C(0x7040050280109119), UINT64_C(0x48c9008212434614),
+  UINT64_C(0xbe5a30132040a216), UINT64_C(0xc34284400128248a), UINT64_C(0x07aeca4120210855),
+  UINT64_C(0x100285480cb50801), UINT64_C(0x113a140268805512), UINT64_C(0x4d802254c0b008c0),
+  UINT64_C(0x04f9f12a24800203), UINT64_C(0x0c08045120516580), UINT64_C(0x6c0213d4a8141148),
+  UINT64_C(0x4103380070208c57), UINT64_C(0x0303000481486090), UINT64_C(0x1305064084006de2),
+  UINT64_C(0x90a014630bd24128), UINT64_C(0x8118eba216a18013), UINT64_C(0xce02b85815004184),
+  UINT64_C(0x48221128510923a0), UINT64_C(0x10a864c70881a400), UINT64_C(0xb160888240d40833),
+  UINT64_C(0x12071148a20024c8), UINT64_C(0x1422363086f09b45), UINT64_C(0x008cc082020c4a50),
+  UINT64_C(0x028220d21821239c), UINT64_C(0x040806149928424d), UINT64_C(0x024664429010b304),
+  UINT64_C(0x09024b0c9aa00903), UINT64_C(0x8020538a58046929), UINT64_C(0x0040947081840fa9),
+  UINT64_C(0x56b082ae216d809f), UINT64_C(0x06498c100a066000), UINT64_C(0xa0020741701244a9),
+  UINT64_C(0x208048d5255b1936), UINT64_C(0x8900463289008002), UINT64_C(0x50a41086525dc428),
+  UINT64_C(0x30812a1245240708), UINT64_C(0x0764a1004400189c), UINT64_C(0x4802289106204106),
+  UINT64_C(0x02024e4412113600), UINT64_C(0x1002c4009180a021), UINT64_C(0x1c34088053513805),
+  UINT64_C(0x781026a0d0985012), UINT64_C(0x2cf20160200a8048), UINT64_C(0x5545c81d046bf016),
+  UINT64_C(0x7082016900040410), UINT64_C(0x23dc0474821c0060), UINT64_C(0x02804c9199002043),
+  UINT64_C(0x24452caa98082b86), UINT64_C(0x893560821e19c842), UINT64_C(0x4c2218032d428060),
+  UINT64_C(0x12381219110c0c9a), UINT64_C(0xa8948028a2118650), UINT64_C(0x0a00108810880021),
+  UINT64_C(0x340d9c0000c23121), UINT64_C(0x0310888001293988), UINT64_C(0x00003102300280c8),
+  UINT64_C(0x780180660f20d040), UINT64_C(0x041000861004265c), UINT64_C(0xa2c025c9a012033e),
+  UINT64_C(0x44e8000892a34263), UINT64_C(0x560e040178610c01), UINT64_C(0x8d01625608246a21),
+  UINT64_C(0x23ad6066800ca488), UINT64_C(0x30109200800454d1), UINT64_C(0x0c80020076292008),
+  UINT64_C(0x4001cd180d4688a8), UINT64_C(0xc44c01c8019063c0), UINT64_C(0x136ab40a841a0717),
+  UINT64_C(0xb0502b8240a84012), UINT64_C(0x700300495a0a9880), UINT64_C(0xa4c302242c809820),
+  UINT64_C(0x072440932584604c), UINT64_C(0x8017411311218a22), UINT64_C(0x432c4228d0b42040),
+  UINT64_C(0x01c2221449511060), UINT64_C(0x385782360148282e), UINT64_C(0x58005440c883190b),
+  UINT64_C(0x8440b02000981194), UINT64_C(0x4b94ba15050820d4), UINT64_C(0x4e1c51200e452950),
+  UINT64_C(0xa728008160010388), UINT64_C(0x2229925690830005), UINT64_C(0x92204e081045cb25),
+  UINT64_C(0x080a1100b80cc4d1), UINT64_C(0x24c8a504ca90804c), UINT64_C(0x107132b013826291),
+  UINT64_C(0x324b551112000140), UINT64_C(0x40700c0560270142), UINT64_C(0x204c4092a8822c02),
+  UINT64_C(0xa10406e405481007), UINT64_C(0x411b006500094090), UINT64_C(0xa090a465008a902c),
+  UINT64_C(0x020c400310005800), UINT64_C(0xba0600921404c900), UINT64_C(0x8b0495b0c80c2102),
+  UINT64_C(0x00008a0d60512222), UINT64_C(0x894225a2ce912000), UINT64_C(0xa010040566027502),
+  UINT64_C(0x1800004041b60104), UINT64_C(0x81cd209826804cc8), UINT64_C(0x309228081c14e2b2),
+  UINT64_C(0x0110406069012240), UINT64_C(0x428ad80831aa0110), UINT64_C(0x8400684a8801d124),
+  UINT64_C(0xa2a0330b200671e0), UINT64_C(0x5849a14700004488), UINT64_C(0x0608839171683494),
+  UINT64_C(0x6e8a080224404c16), UINT64_C(0x00044771038400c7), UINT64_C(0x1342a001a0089835),
+  UINT64_C(0x1400c120050c0304), UINT64_C(0x512a3461d05194a8), UINT64_C(0x501323170010444c),
+  UINT64_C(0xc021010a02208e00), UINT64_C(0x40584962a2548f44), UINT64_C(0xe7a054583b045065),
+  UINT64_C(0x4202061f2c601541), UINT64_C(0x20742cc089e02887), UINT64_C(0xa01163201c050ca1),
+  UINT64_C(0x8450973300a0c008), UINT64_C(0x09a0038044852818), UINT64_C(0x08c285e001142080),
+  UINT64_C(0xa85812514117146c), UINT64_C(0x0280144781c02b33), UINT64_C(0x0502412609604092),
+  UINT64_C(0xa08a400028c5580b), UINT64_C(0x910a0a0425148729), UINT64_C(0x4220008120a31252),
+  UINT64_C(0xd4044cc902620232), UINT64_C(0x0c500a10a0081544), UINT64_C(0x20a38050a4d22464),
+  UINT64_C(0x3250a44007444314), UINT64_C(0x59292429a0143909), UINT64_C(0xe11b1024486c0001),
+  UINT64_C(0xcc4409161284c012), UINT64_C(0x3448710a09020e34), UINT64_C(0x0ac80091801c4403),
+  UINT64_C(0x052038d318820f50), UINT64_C(0x960205040420ea28), UINT64_C(0xd83845082045000a),
+  UINT64_C(0x050a8912858a1140), UINT64_C(0x0c30980466409800), UINT64_C(0x0050bc418a30626e),
+  UINT64_C(0x81060358290441c1), UINT64_C(0x320886c8150a0014), UINT64_C(0x040322c010a00121),
+  UINT64_C(0x3213202818022582), UINT64_C(0x8163186406628271), UINT64_C(0x9490421440278c05),
+  UINT64_C(0x8a00c0122c05c742), UINT64_C(0xc06040586081022a), UINT64_C(0x6060261a2cc12145),
+  UINT64_C(0x8c628542101ca989), UINT64_C(0x082521a428519048), UINT64_C(0xf0080c214488d91d),
+  UINT64_C(0x4384023253012049), UINT64_C(0x821510038b00618c), UINT64_C(0x6094d841d1112204),
+  UINT64_C(0x212e408380d19020), UINT64_C(0x071289d64190a280), UINT64_C(0x0b08458a2480c040),
+  UINT64_C(0xf4d82403c10a0831), UINT64_C(0x86e07038444d4004), UINT64_C(0x92c11068824201c6),
+  UINT64_C(0x0090100808b43103), UINT64_C(0x106a088939200a03), UINT64_C(0x0245026408393288),
+  UINT64_C(0x09021064044c0502), UINT64_C(0x40128461883842a4), UINT64_C(0x8980100f200e000c),
+  UINT64_C(0x620c61820f7021d0), UINT64_C(0x0250579000223480), UINT64_C(0x3308089e21808005),
+  UINT64_C(0x9c22060e07904124), UINT64_C(0x30034047920a5409), UINT64_C(0x28308900c2480039),
+  UINT64_C(0x9424483212025e17), UINT64_C(0xd28d8caa085041a4), UINT64_C(0x04d603807b290400),
+  UINT64_C(0x444ce8c56c211220), UINT64_C(0x8c06280002044837), UINT64_C(0xe0003542124284b9),
+  UINT64_C(0x413221202d42d0c1), UINT64_C(0x803d688a02a41898), UINT64_C(0x4213601021100806),
+  UINT64_C(0x8cd48828900e6186), UINT64_C(0x7486c85420910a10), UINT64_C(0x14236218de94b208),
+  UINT64_C(0x10941062444d0520), UINT64_C(0x41cb1c01c3204061), UINT64_C(0x953c408d06681c84),
+  UINT64_C(0x8082c88980638328), UINT64_C(0x2f8ac3016080262c), UINT64_C(0x00084251b12b1142),
+  UINT64_C(0x2450494888d080bd), UINT64_C(0x40825222884c1410), UINT64_C(0x1061920400c41d01),
+  UINT64_C(0x08117b10202e421a), UINT64_C(0x4c059c220110815e), UINT64_C(0x22a202c44b173041),
+  UINT64_C(0x308074c105000665), UINT64_C(0x131089880a88802c), UINT64_C(0x8094024b20c00401),
+  UINT64_C(0x4138a1004c9086c0), UINT64_C(0x4069201c3022e051), UINT64_C(0x741109f08321ac40),
+  UINT64_C(0x2d900e8020000004), UINT64_C(0x0606081425892122), UINT64_C(0x380063880760612a),
+  UINT64_C(0x202401c11e183050), UINT64_C(0x89011043403e1609), UINT64_C(0x145c09347480a490),
+  UINT64_C(0x204dc4a12a416802), UINT64_C(0x0ac29170108f4229), UINT64_C(0x0504e00240c22640),
+  UINT64_C(0x0b1344a01140a321), UINT64_C(0x200007a0ca08a4ca), UINT64_C(0x8d888c16a01416d0),
+  UINT64_C(0x0005931340c90c0c), UINT64_C(0x1886107023064886), UINT64_C(0xa9889d09480a0445),
+  UINT64_C(0x4020028891428012), UINT64_C(0x001446a0c1a04b10), UINT64_C(0x5108046304027120),
+  UINT64_C(0x402a12148014894c), UINT64_C(0x480c000b228192c1), UINT64_C(0x040310c218050898),
+  UINT64_C(0x2a1c41610a113006), UINT64_C(0x4608001e08c23560), UINT64_C(0x00204432c6c54124),
+  UINT64_C(0x01800084ae1299a1), UINT64_C(0x1c20027305281f90), UINT64_C(0x0230a02847680680),
+  UINT64_C(0x600314131241a610), UINT64_C(0xc2408c8939024400), UINT64_C(0x024990c80c081321),
+  UINT64_C(0x8034420213c4d184), UINT64_C(0x5a08064238c0a1c9), UINT64_C(0x00080117296090f0),
+  UINT64_C(0x00e9403400046080), UINT64_C(0x00c6194287528000), UINT64_C(0x0e204945ca904120),
+  UINT64_C(0x41049a1b20182a04), UINT64_C(0x19108c4256794203), UINT64_C(0x280921c15808a0e8),
+  UINT64_C(0x3003280105c00504), UINT64_C(0xc88dc20104288253), UINT64_C(0x10005118224600bc),
+  UINT64_C(0x040490800824410b), UINT64_C(0x2544cc9831100411), UINT64_C(0x9662010085590393),
+  UINT64_C(0x0a2d404a62116801), UINT64_C(0x21d1051443248ae0), UINT64_C(0x95e8300b008a1212),
+  UINT64_C(0x520f24508b0204a2), UINT64_C(0x66c845a10024600a), UINT64_C(0x6426004881613420),
+  UINT64_C(0x0924021094258912), UINT64_C(0xb00a50cd00c3c108), UINT64_C(0x01101154046845a0),
+  UINT64_C(0x13d182ac034434c6), UINT64_C(0x1618282010550aa4), UINT64_C(0xac14c510c1360406),
+  UINT64_C(0x1701028069c8a006), UINT64_C(0x01044a605a888892), UINT64_C(0x62231287c4041030),
+  UINT64_C(0x89020816a08c0921), UINT64_C(0x1568182270609012), UINT64_C(0xa65040b99c31030e),
+  UINT64_C(0xa89e4a810b300400), UINT64_C(0x044c3016b8892c50), UINT64_C(0x81002a2800890034),
+  UINT64_C(0x208041000c9954c3), UINT64_C(0x2841087006805081), UINT64_C(0x0ca40b2146463ac4),
+  UINT64_C(0x8008844a00040014), UINT64_C(0x611616041009418d), UINT64_C(0x020204815c410830),
+  UINT64_C(0x837041021b28b09c), UINT64_C(0x0b86216188c60550), UINT64_C(0x9db8264301944221),
+  UINT64_C(0x5064708820647c0a), UINT64_C(0x9895a0c93212208a), UINT64_C(0x0842c02040062084),
+  UINT64_C(0x32a31c0964291141), UINT64_C(0x02148030cc10130b), UINT64_C(0x78011180049455ca),
+  UINT64_C(0xf810200285704201), UINT64_C(0x16046022278c461d), UINT64_C(0xa0d4810080102110),
+  UINT64_C(0x6140013910290001), UINT64_C(0x018a24824923b205), UINT64_C(0x071484c64188403a),
+  UINT64_C(0x4284248fc08214a8), UINT64_C(0x70a31920ea804660), UINT64_C(0x8454401153481041),
+  UINT64_C(0x600220910c02a1fa), UINT64_C(0x6ca24250090e0700), UINT64_C(0x000d821590639516),
+  UINT64_C(0x824202e28a00081f), UINT64_C(0x20ad54688402112a), UINT64_C(0x2402a802047a4f09),
+  UINT64_C(0xc0143a04200386c8), UINT64_C(0x8206044005040b40), UINT64_C(0xc910c121b2bd20e4),
+  UINT64_C(0x00aa000460ca0230), UINT64_C(0x0250401e00f0d12a), UINT64_C(0x13312624c04c5109),
+  UINT64_C(0x2548825224140201), UINT64_C(0x033498004008a4d4), UINT64_C(0x288008818400c9fa),
+  UINT64_C(0x0346dd6890092020), UINT64_C(0x216442c308721420), UINT64_C(0x0a00adc800106081),
+  UINT64_C(0xdb010540f0039008), UINT64_C(0x95a1a41488400c9c), UINT64_C(0x0a215b1a32426005),
+  UINT64_C(0x8a19806897132440), UINT64_C(0x0422d4c129011008), UINT64_C(0x40094ec890800c55),
+  UINT64_C(0x20078ca048695326), UINT64_C(0x59102282340800b2), UINT64_C(0x01c818454a10030c),
+  UINT64_C(0x48280a1034c1965a), UINT64_C(0xe08c094018218498), UINT64_C(0xc24606382920314a),
+  UINT64_C(0x0004820480620444), UINT64_C(0x191040b0539862b0), UINT64_C(0x308c060204cc8003),
+  UINT64_C(0x10018a6020928804), UINT64_C(0x1980838204268801), UINT64_C(0x029c30b08011673a),
+  UINT64_C(0x02420120f8302306), UINT64_C(0x7720d08518301f04), UINT64_C(0x8000c190026c010b),
+  UINT64_C(0x603850041a022d80), UINT64_C(0x9d002401ec2e19d0), UINT64_C(0x8044403820c3800d),
+  UINT64_C(0x70005d9214460042), UINT64_C(0x24a41b08428025a8), UINT64_C(0x52200409010a0010),
+  UINT64_C(0x984007908d888219), UINT64_C(0x5a2312e91c433141), UINT64_C(0x0d0a2007423cc480),
+  UINT64_C(0x8300788625cbda06), UINT64_C(0x4459400020014206), UINT64_C(0x240e480428840124),
+  UINT64_C(0x5447c45a04400652), UINT64_C(0x1311c14099b48a32), UINT64_C(0x198864842a014523),
+  UINT64_C(0xa0101a6043605089), UINT64_C(0x40c120b803a88804), UINT64_C(0xa40130a39d060f08),
+  UINT64_C(0x88300e78810565a1), UINT64_C(0x414c22c455288b02), UINT64_C(0xa000c184195848b2),
+  UINT64_C(0xc0a12049201c8069), UINT64_C(0xa802851562c40470), UINT64_C(0x521433885083f241),
+  UINT64_C(0xe695080a100580c4), UINT64_C(0x0068c80c0b111420), UINT64_C(0x020f0a0050c08c22),
+  UINT64_C(0x1d2504ac0a689291), UINT64_C(0x008c26009212c183), UINT64_C(0xa953ac2084185411),
+  UINT64_C(0x1c00430013296e40), UINT64_C(0x54090d290603c2b2), UINT64_C(0x25f4902080994702),
+  UINT64_C(0x410054961010bb30), UINT64_C(0x8201252418253219), UINT64_C(0x38b42088028b080b),
+  UINT64_C(0x18e1073049100120), UINT64_C(0x8008d90520c18882), UINT64_C(0x20946d0020422292),
+  UINT64_C(0x6428428073062580), UINT64_C(0x53070004982a0205), UINT64_C(0x24502b0690010135),
+  UINT64_C(0x811504408a485002), UINT64_C(0xa4a0102600801848), UINT64_C(0x4830528802448a94),
+  UINT64_C(0x8a0381a290422f10), UINT64_C(0xa304494538041204), UINT64_C(0x44a8a40084001871),
+  UINT64_C(0x9a40895004542008), UINT64_C(0x0a12222d421220b0), UINT64_C(0x44a1b0224ab4144d),
+  UINT64_C(0x4080a8014442b240), UINT64_C(0x748170a092118c3a), UINT64_C(0x8000d8e91b020680),
+  UINT64_C(0x04429804a0aa0746), UINT64_C(0xba1426421c14c0a4), UINT64_C(0xd011022b10075101),
+  UINT64_C(0x08690d1042608400), UINT64_C(0xd899008825010895), UINT64_C(0x12075c0221250900),
+  UINT64_C(0x40a20549a38b4248), UINT64_C(0x0188d84940180c05), UINT64_C(0x136522320004521e),
+  UINT64_C(0xc18b6600441085e9), UINT64_C(0xa46b8443e8681138), UINT64_C(0x024121b510658006),
+  UINT64_C(0xf082981010630ea4), UINT64_C(0xcc04c154f888008a), UINT64_C(0x0041e883b0500c41),
+  UINT64_C(0x366086001e013a84), UINT64_C(0x220a1321104d5d01), UINT64_C(0x2140ad70a1a60810),
+  UINT64_C(0x4c48802b1006c213), UINT64_C(0x2800041089328040), UINT64_C(0x0146416503014125),
+  UINT64_C(0x00aa284150c18032), UINT64_C(0x02620a048060182a), UINT64_C(0xd8242444660381d0),
+  UINT64_C(0x00681244040c8a08), UINT64_C(0x84114005608c0009), UINT64_C(0x4a112012844222c6),
+  UINT64_C(0x20b20039238c600c), UINT64_C(0x00c08a408cf11200), UINT64_C(0x9d0641600628030a),
+  UINT64_C(0x290324a08401a510), UINT64_C(0xb40012016958c284), UINT64_C(0x8090000202096c80),
+  UINT64_C(0xa040a82908070900), UINT64_C(0x00bc101108376441), UINT64_C(0x16611606b0c92502),
+  UINT64_C(0x0004431a422522b1), UINT64_C(0x420073a412421d60), UINT64_C(0x98b2920040848925),
+  UINT64_C(0x4d541209262b0052), UINT64_C(0xe082a4a99402e918), UINT64_C(0x48881608ca283025),
+  UINT64_C(0x144c6e11d1f90a01), UINT64_C(0x8710006c11902182), UINT64_C(0xc089022a36181001),
+  UINT64_C(0xdd0892102a304200), UINT64_C(0x971441a064850452), UINT64_C(0xc0800d00a9410a1c),
+  UINT64_C(0xa120100c50152282), UINT64_C(0x3089405ec1002400), UINT64_C(0x3102a90440809880),
+  UINT64_C(0x48042060140c0400), UINT64_C(0x084ab0414958832c), UINT64_C(0xc0d408000280801b),
+  UINT64_C(0x241801081c234788), UINT64_C(0x461690a890a51103), UINT64_C(0x250828d644128040),
+  UINT64_C(0x0e05840601414382), UINT64_C(0x413006c060091418), UINT64_C(0x20a23822c8c05c20),
+  UINT64_C(0x160d420b50206005), UINT64_C(0x20d68591a204e342), UINT64_C(0x810a8e110838610b),
+  UINT64_C(0x7144a21084431060), UINT64_C(0xa40408c058808925), UINT64_C(0x0391140930402400),
+  UINT64_C(0x01303a270a9c5530), UINT64_C(0x5020c38002c21c09), UINT64_C(0x9406411b0160a690),
+  UINT64_C(0x22bc8c14481b2244), UINT64_C(0x72a09802680b0050), UINT64_C(0x2442014c50084089),
+  UINT64_C(0x0030006d4841c020), UINT64_C(0xc1282d40001049d4), UINT64_C(0x5294382602281001),
+  UINT64_C(0x444049c008508462), UINT64_C(0x20c009e52bb9130a), UINT64_C(0x270ca08834409801),
+  UINT64_C(0x200006405c21812c), UINT64_C(0x91220440048a18b3), UINT64_C(0xe490200081640401),
+  UINT64_C(0x0341088a12890893), UINT64_C(0x8480012201656048), UINT64_C(0x298002c8212d5042),
+  UINT64_C(0x01c3f0c86c820644), UINT64_C(0x311408a20c10a016), UINT64_C(0x8811070722102d58),
+  UINT64_C(0x0009390448709200), UINT64_C(0x0588230302204600), UINT64_C(0x4212804235150204),
+  UINT64_C(0x8828d20c818300a0), UINT64_C(0x610d664111c99016), UINT64_C(0x2902caa288002015),
+  UINT64_C(0x1208002400060420), UINT64_C(0x20110430e5a09995), UINT64_C(0x4465201011a6841f),
+  UINT64_C(0xc8c590e10a258184), UINT64_C(0x07d0124122a52440), UINT64_C(0x068208c2c5882306),
+  UINT64_C(0x0323035880314914), UINT64_C(0x4120760f3a004821), UINT64_C(0x485b82176426cd48),
+  UINT64_C(0x0198639000c13e84), UINT64_C(0x0a02940014044834), UINT64_C(0xa258823082105482),
+  UINT64_C(0x7225504808c8a800), UINT64_C(0x84258c0086844203), UINT64_C(0xa908040284403112),
+  UINT64_C(0x8903350020c84415), UINT64_C(0x0368018071006010), UINT64_C(0x021831220a308620),
+  UINT64_C(0x0d9e09884084310c), UINT64_C(0x154452cab9830163), UINT64_C(0x8124883cd8052024),
+  UINT64_C(0xc013218cb8135052), UINT64_C(0x2490804260301184), UINT64_C(0x55a1aa34630a0856),
+  UINT64_C(0x20047c528320a218), UINT64_C(0x20448a10100a1025), UINT64_C(0x50885c8284312351),
+  UINT64_C(0x2143206086408808), UINT64_C(0x48981222a84d0503), UINT64_C(0xb0801f1042045110),
+  UINT64_C(0x5011213844a17a11), UINT64_C(0x0a5c4092a246ac4e), UINT64_C(0x8c0a40b010921067),
+  UINT64_C(0x02c482016019a823), UINT64_C(0x2004c71481456218), UINT64_C(0x3084626188900cc0),
+  UINT64_C(0x81229040c52e5219), UINT64_C(0x0d81410054e1a085), UINT64_C(0x5244b80030326ca0),
+  UINT64_C(0xc620014802961046), UINT64_C(0x602282cb10320104), UINT64_C(0x0a44041898204988),
+  UINT64_C(0x410147854a089000), UINT64_C(0x6d1a261207060a85), UINT64_C(0x8670001121884047),
+  UINT64_C(0x4a865c910b140040), UINT64_C(0x848814a9420c5548), UINT64_C(0x402c20d04d131020),
+  UINT64_C(0x1803485006c9a03a), UINT64_C(0x53ab400940c15188), UINT64_C(0x00538066a0880028),
+  UINT64_C(0x9b20d88703660451), UINT64_C(0xd058e12010620448), UINT64_C(0x8d5843a13136120e),
+  UINT64_C(0x05039a10dc4a2105), UINT64_C(0x82630110406c4021), UINT64_C(0x60b3400068190071),
+  UINT64_C(0x14c2042065148611), UINT64_C(0x008c089e13001283), UINT64_C(0xc24c211012400442),
+  UINT64_C(0x218e458812101020), UINT64_C(0x46ca1813800a0130), UINT64_C(0x1c10028c0a044229),
+  UINT64_C(0x8006660550c85091), UINT64_C(0x00a02616abb200b0), UINT64_C(0x8861d888408b0456),
+  UINT64_C(0x9c120c2b2312a4a6), UINT64_C(0x0c3292c029800200), UINT64_C(0x314482d009880951),
+  UINT64_C(0xb000800054149224), UINT64_C(0x008e4062c214a12a), UINT64_C(0x006019242a82dc3c),
+  UINT64_C(0x06c150b516484800), UINT64_C(0x280088000c64ab70), UINT64_C(0x435202044821224a),
+  UINT64_C(0x438da44d28a09651), UINT64_C(0x214164200f001083), UINT64_C(0xa894404a10849041),
+  UINT64_C(0x10319d058846021c), UINT64_C(0x0028e08273080410), UINT64_C(0xe893044084272450),
+  UINT64_C(0xaa0c10117a200325), UINT64_C(0x26094445649b1c30), UINT64_C(0x0102808800898118),
+  UINT64_C(0x0928120372c04c11), UINT64_C(0x012a843288241949), UINT64_C(0x58c12b8551021452),
+  UINT64_C(0x4a09408221410464), UINT64_C(0x06204441a2861582), UINT64_C(0x0480381941883211),
+  UINT64_C(0x096228220030b908), UINT64_C(0x9211008100012040), UINT64_C(0x04001a0381a48234),
+  UINT64_C(0x5110092a14a30080), UINT64_C(0x20c8908900650820), UINT64_C(0x2110845400074008),
+  UINT64_C(0x0624c4144482a720), UINT64_C(0x806409d812e52201), UINT64_C(0xa13b2708945048e2),
+  UINT64_C(0x1c61004063089900), UINT64_C(0x0d00209461c0a88a), UINT64_C(0x1c0b84402c208816),
+  UINT64_C(0x81c80e40800113e9), UINT64_C(0x01c404d23448a962), UINT64_C(0xb410004a02e86024),
+  UINT64_C(0xc20573e106571d02), UINT64_C(0xe9a0281024044219), UINT64_C(0x42058190546a9802),
+  UINT64_C(0x3200a412a211024c), UINT64_C(0x85404428c10a4305), UINT64_C(0x008e500541531841),
+  UINT64_C(0x2536022400dc6084), UINT64_C(0x01064648c60688c3), UINT64_C(0x302b1a21845203a8),
+  UINT64_C(0x5710623403040810), UINT64_C(0x04c0a0080623409e), UINT64_C(0xc02619c9a0885140),
+  UINT64_C(0x6280620351400610), UINT64_C(0x07608068018cf818), UINT64_C(0x099101466886801b),
+  UINT64_C(0x05420410298c4164), UINT64_C(0x080000002429e84d), UINT64_C(0x0c02b5480010620e),
+  UINT64_C(0xc8064ad888220483), UINT64_C(0x0002a48440109702), UINT64_C(0xa1516ec40861a211),
+  UINT64_C(0x203c10842298149a), UINT64_C(0x0121883502a00229), UINT64_C(0x410c600f210132c4),
+  UINT64_C(0x0a41a5429404681a), UINT64_C(0x0e54890199882081), UINT64_C(0x43430e10c1020605),
+  UINT64_C(0x20600460d5b46983), UINT64_C(0x7003070808106930), UINT64_C(0xcd219140829082d4),
+  UINT64_C(0x18f80882034ca24a), UINT64_C(0x1a1b31c02a11095e), UINT64_C(0x6490482568a06102),
+  UINT64_C(0x25e040c228200c00), UINT64_C(0x10026b9448108034), UINT64_C(0x102120a190021030),
+  UINT64_C(0x8198044063ca120c), UINT64_C(0xd310010a230e2043), UINT64_C(0x9a94902a1002446a),
+  UINT64_C(0x035291b020294388), UINT64_C(0x7168101038922206), UINT64_C(0x08408c204644a004),
+  UINT64_C(0x1a10178184808098), UINT64_C(0x00d02c06450a0e0c), UINT64_C(0x89a102182023ca54),
+  UINT64_C(0x161af9100c15804c), UINT64_C(0x442a064190292042), UINT64_C(0x764c8a8250312610),
+  UINT64_C(0x053020108a015187), UINT64_C(0x2017044890407121), UINT64_C(0x3060a311015e111d),
+  UINT64_C(0x102148015226448c), UINT64_C(0xa212188802746180), UINT64_C(0x844805d4810d26c3),
+  UINT64_C(0x06084888356b2116), UINT64_C(0xa12000a404815221), UINT64_C(0x9b2050024e804128),
+  UINT64_C(0xc530230328821020), UINT64_C(0x8208c9080280a205), UINT64_C(0x3409c80292440010),
+  UINT64_C(0x0ac0113110a62180), UINT64_C(0x41202208c0208a51), UINT64_C(0x0847290049a00104),
+  UINT64_C(0x022022a516524129), UINT64_C(0x2409002506d404e0), UINT64_C(0x947158805181c49a),
+  UINT64_C(0x024981f08404880a), UINT64_C(0x6300045871235041), UINT64_C(0x002b809960210e00),
+  UINT64_C(0x2d40a18e03190801), UINT64_C(0x8a18558a2ac700e1), UINT64_C(0x10d01911e2380184),
+  UINT64_C(0x15346a044126a251), UINT64_C(0x480b0032033008c6), UINT64_C(0x0894848100005241),
+  UINT64_C(0x220b780294802226), UINT64_C(0x1056248e0a90d028), UINT64_C(0x222811a404c05c21),
+  UINT64_C(0x741a1040642090b5), UINT64_C(0xd84c9000010c04d8), UINT64_C(0x7088043a02028222),
+  UINT64_C(0x4a68c12061850281), UINT64_C(0x200cd012a1198400), UINT64_C(0x030645640890102b),
+  UINT64_C(0x508c518260042c43), UINT64_C(0x508008440228c039), UINT64_C(0x0c0133a276010a0a),
+  UINT64_C(0x84118400192088a4), UINT64_C(0xa008124c3030110d), UINT64_C(0x03a07a152422b560),
+  UINT64_C(0x103142c04c2c0321), UINT64_C(0xa9304109825d9881), UINT64_C(0x85c0063080924885),
+  UINT64_C(0x18a8001e16461000), UINT64_C(0x069110010d242880), UINT64_C(0xa1e604c103146240),
+  UINT64_C(0x4143028d01508526), UINT64_C(0x100704b45231092d), UINT64_C(0x11854482a80804a2),
+  UINT64_C(0x0900a01102ca0614), UINT64_C(0x1004228110c00801), UINT64_C(0x824ef02a8d010450),
+  UINT64_C(0x0060c5118a0e04a8), UINT64_C(0x16216a8cd1101b32), UINT64_C(0x2a1705484020390a),
+  UINT64_C(0x200030c0e0134903), UINT64_C(0xd0009a5341b41280), UINT64_C(0xc3c0b28805284280),
+  UINT64_C(0x304a1c5089010d24), UINT64_C(0x84f4400431104324), UINT64_C(0x244be08090f88002),
+  UINT64_C(0x8000085404456ab0), UINT64_C(0x400f008434021800), UINT64_C(0x4808004083ca0484),
+  UINT64_C(0x8300ab2642894410), UINT64_C(0x204295012330242e), UINT64_C(0x2c54578100883028),
+  UINT64_C(0x114e888ad0302507), UINT64_C(0xb254243a5820c314), UINT64_C(0x5883058152840101),
+  UINT64_C(0x15421003ea20049c), UINT64_C(0x01b4a8280449964b), UINT64_C(0x0018754a3807cad8),
+  UINT64_C(0x420c80a800017380), UINT64_C(0x61e4c41901128843), UINT64_C(0x18008892025c1892),
+  UINT64_C(0x02894024900708ca), UINT64_C(0x0c023e11cf485008), UINT64_C(0xc9e1018216042084),
+  UINT64_C(0x70018c4919040282), UINT64_C(0x0b064e51010520a6), UINT64_C(0x012d100c24a10c12),
+  UINT64_C(0x2c22c1420cb91220), UINT64_C(0x39900204200214a0), UINT64_C(0x184000032cc4d750),
+  UINT64_C(0x0831033240469843), UINT64_C(0xc6409d20a0412304), UINT64_C(0x88a2021da1110023),
+  UINT64_C(0x45a20840e1781150), UINT64_C(0x342120d88020899d), UINT64_C(0x62001429d20270c9),
+  UINT64_C(0x78920b012034c908), UINT64_C(0x505030a601281612), UINT64_C(0x4c5cc12080448708),
+  UINT64_C(0xcc100e8c58810748), UINT64_C(0x0140104c00428840), UINT64_C(0x292101c409008015),
+  UINT64_C(0xb91a050e26123830), UINT64_C(0x0c090840a1b09100), UINT64_C(0x10344aad00091049),
+  UINT64_C(0x184780411322c742), UINT64_C(0x20160000d9002046), UINT64_C(0x3503064004818640),
+  UINT64_C(0x0200044cc6f9e214), UINT64_C(0xe004400d82560d29), UINT64_C(0x6480b1060b16119c),
+  UINT64_C(0x4140b013710a1201), UINT64_C(0x3cc90030b92428c0), UINT64_C(0x09e210a470184301),
+  UINT64_C(0x0482c414940ba800), UINT64_C(0x0330e160c9cd4226), UINT64_C(0x000c05aa300261c0),
+  UINT64_C(0xa0881c14c46042ec), UINT64_C(0x08402a1363052802), UINT64_C(0x3240c0802c328504),
+  UINT64_C(0xae00924890a05440), UINT64_C(0x050a0c0b09802604), UINT64_C(0x100466a4004c5021),
+  UINT64_C(0x589540e2001008c3), UINT64_C(0x0842072026924400), UINT64_C(0x060c1b2800ed0c87),
+  UINT64_C(0x068481612a064344), UINT64_C(0xa1484418089c1080), UINT64_C(0x0002085700038447),
+  UINT64_C(0x054028228b11e315), UINT64_C(0xb014702c4ac91528), UINT64_C(0x807808572a000c40),
+  UINT64_C(0x13ac09052686a054), UINT64_C(0x8612042815410088), UINT64_C(0x6d804a2450283424),
+  UINT64_C(0x12c3020881000020), UINT64_C(0xae140002024501a6), UINT64_C(0x12051368001281a9),
+  UINT64_C(0x282992006c348014), UINT64_C(0x89e0900743226047), UINT64_C(0x968a60431414ce00),
+  UINT64_C(0x20f480c048013022), UINT64_C(0x074960c910421126), UINT64_C(0x1000680450a40b28),
+  UINT64_C(0x09362080a004a060), UINT64_C(0x70f00a45410a9208), UINT64_C(0x90b02808228c5c55),
+  UINT64_C(0x20120c0302638404), UINT64_C(0x0902d9c983841082), UINT64_C(0x14a4140ac8900010),
+  UINT64_C(0x22522430020c6002), UINT64_C(0x001302c444040551), UINT64_C(0x7409184608625a00),
+  UINT64_C(0x4010d002248a8848), UINT64_C(0x1a02c85a05122938), UINT64_C(0x410c0485e82564c0),
+  UINT64_C(0x224406063091be21), UINT64_C(0x1950069e14584982), UINT64_C(0x00930363d0853542),
+  UINT64_C(0x0c810a40a20a9125), UINT64_C(0x4c41080800002614), UINT64_C(0x8085b07014148102),
+  UINT64_C(0x60c0428002144505), UINT64_C(0x17215800c03b0f04), UINT64_C(0xa0760a8804980906),
+  UINT64_C(0xd1a246c800c08151), UINT64_C(0x40610033800a0268), UINT64_C(0x1a0c48036247b001),
+  UINT64_C(0x1e101800900346e4), UINT64_C(0x84660924f2002004), UINT64_C(0x2001021884780120),
+  UINT64_C(0x2121e950c2108200), UINT64_C(0x120c00ed1c0184c2), UINT64_C(0x25d800564918c1c0),
+  UINT64_C(0x800181a20460f080), UINT64_C(0xa204b00902410a40), UINT64_C(0x4102965012231188),
+  UINT64_C(0x1302205a1de30441), UINT64_C(0x0240418843b00a94), UINT64_C(0x32ba26a40e170881),
+  UINT64_C(0x8080041486884961), UINT64_C(0x0031499c41618a00), UINT64_C(0x200a81a288342c00),
+  UINT64_C(0x210080584a036682), UINT64_C(0x72075a14ad210772), UINT64_C(0xa006406804010830),
+  UINT64_C(0x888f30002c52c10b), UINT64_C(0x0002bb0300429d9c), UINT64_C(0x001c402045807458),
+  UINT64_C(0x140c898210302800), UINT64_C(0x22980f1008832200), UINT64_C(0x3400460945788105),
+  UINT64_C(0x0912244086883828), UINT64_C(0x812c154008801002), UINT64_C(0x58a20023835040e5),
+  UINT64_C(0x80117194242100c4), UINT64_C(0xe08860c817032898), UINT64_C(0x4a000085b2281424),
+  UINT64_C(0x50aa849c4c410440), UINT64_C(0x8d10227080008012), UINT64_C(0x0080622d02088809),
+  UINT64_C(0x8099370082861360), UINT64_C(0x863152294144ec84), UINT64_C(0x124230b808658840),
+  UINT64_C(0x2428545040300180), UINT64_C(0x60a304420431a240), UINT64_C(0x14024924c640e229),
+  UINT64_C(0x12af00a2b0112988), UINT64_C(0x81c20136802c086c), UINT64_C(0x00b4021912241e50),
+  UINT64_C(0x184721e080628490), UINT64_C(0x610008dc6aa11621), UINT64_C(0x2641181815020520),
+  UINT64_C(0x1071020613605980), UINT64_C(0x229410c9c8005088), UINT64_C(0x90282322478a9808),
+  UINT64_C(0x492c32981400c686), UINT64_C(0x9006491004456070), UINT64_C(0x446084210a214288),
+  UINT64_C(0x24ec309600099170), UINT64_C(0x823229c002603205), UINT64_C(0xc10440092cc068c2),
+  UINT64_C(0xb0000710220884b0), UINT64_C(0x1c08500216040c86), UINT64_C(0x000c4c11a24701c2),
+  UINT64_C(0x2284c43c29a820a2), UINT64_C(0x6180148010183043), UINT64_C(0x88610ae4944d02a9),
+  UINT64_C(0xc305110210592831), UINT64_C(0x0168190201a28604), UINT64_C(0x05010134140c1853),
+  UINT64_C(0xe888300304012898), UINT64_C(0x007c85d168834160), UINT64_C(0x51ac264001520c17),
+  UINT64_C(0x9101a90e02400820), UINT64_C(0x300806030210c0a0), UINT64_C(0x1c000a3009aa8100),
+  UINT64_C(0x18a988012280008c), UINT64_C(0xa057a45203100424), UINT64_C(0x41140d10803020a3),
+  UINT64_C(0x72648c4f40913a34), UINT64_C(0xab11893200a1d23a), UINT64_C(0xb200030060002858),
+  UINT64_C(0xc060942001c05260), UINT64_C(0xcec820a06082288c), UINT64_C(0x0a00083207020650),
+  UINT64_C(0x84684850b0a12049), UINT64_C(0x7103a20004111806), UINT64_C(0x842084424c20f21a),
+  UINT64_C(0x0984226018079102), UINT64_C(0x8508241488c00314), UINT64_C(0x020819206108449e),
+  UINT64_C(0x685601aa9a660452), UINT64_C(0x2a28528543014061), UINT64_C(0x512d360155022810),
+  UINT64_C(0x2004819c807da896), UINT64_C(0xc30802a206da4902), UINT64_C(0x34090523a1109444),
+  UINT64_C(0x17b0e8100140d00f), UINT64_C(0x4c0501021012a200), UINT64_C(0x401612000210504d),
+  UINT64_C(0x50490a0424010001), UINT64_C(0x0020c9248ca90000), UINT64_C(0x2ba64080a2411022),
+  UINT64_C(0x0118a1104b7003cc), UINT64_C(0x123442b63486a8d8), UINT64_C(0xc2c96c6213020284),
+  UINT64_C(0x04404120309c4303), UINT64_C(0x0641181e811a0801), UINT64_C(0x0c200028041502a0),
+  UINT64_C(0x48813009908ab008), UINT64_C(0x380a24450540d20c), UINT64_C(0x0d485a876025c0ca),
+  UINT64_C(0x361324092000240a), UINT64_C(0x41384280080c4200), UINT64_C(0x15a008c011502174),
+  UINT64_C(0x9807c22c4464cb01), UINT64_C(0x0a882563701b1462), UINT64_C(0xd8c1100428c00c00),
+  UINT64_C(0x9081910904886008), UINT64_C(0x2801048020072234), UINT64_C(0x61000df8800027cc),
+  UINT64_C(0x418480814139a314), UINT64_C(0x8b01608649a14080), UINT64_C(0x003001280041c020),
+  UINT64_C(0x8040381508d00a69), UINT64_C(0x90844a884045f081), UINT64_C(0x104541909d0047a8),
+  UINT64_C(0x04540381b9a6204a), UINT64_C(0x12202284e0030c40), UINT64_C(0x0c02045251215008),
+  UINT64_C(0x02b34400ac8820a1), UINT64_C(0x1ce83340c30a078d), UINT64_C(0x091088b800400600),
+  UINT64_C(0x48ce04b00570e004), UINT64_C(0x8408482d12b27106), UINT64_C(0x2302a21238ba1e44),
+  UINT64_C(0x0e00ecd440400004), UINT64_C(0x412b5504884558db), UINT64_C(0xd1108a16ca00802c),
+  UINT64_C(0xc0292094104a4281), UINT64_C(0x20589012841180e2), UINT64_C(0x6104067002800184),
+  UINT64_C(0x040faa02d5128350), UINT64_C(0x810128768c003014), UINT64_C(0x480836a090940838),
+  UINT64_C(0x7059a840c1929138), UINT64_C(0xc825aa8810034c1e), UINT64_C(0x5a0008812060e860),
+  UINT64_C(0x0648512500084620), UINT64_C(0x00c80ccde1881032), UINT64_C(0x1143071840940900),
+  UINT64_C(0x8286040d2240cca3), UINT64_C(0x1970801086780850), UINT64_C(0x0c41b10074042c00),
+  UINT64_C(0xd000acb10923c100), UINT64_C(0x28401c542800400c), UINT64_C(0x03e2640c21f00924),
+  UINT64_C(0x245402c880d00120), UINT64_C(0x282a71430486e180), UINT64_C(0x883886240d488088),
+  UINT64_C(0x0fa44a82424012d4), UINT64_C(0x3213809802146800), UINT64_C(0x866a590c03067444),
+  UINT64_C(0x1400560000031173), UINT64_C(0x214704889c241809), UINT64_C(0x081904c708125010),
+  UINT64_C(0x0819224449ec04ac), UINT64_C(0x53151089420a4200), UINT64_C(0x008821219200c11a),
+  UINT64_C(0xc0a409d8088034a1), UINT64_C(0x0269a40c15692211), UINT64_C(0x8331c4580250b811),
+  UINT64_C(0x6830202a40980500), UINT64_C(0x20820f3240184004), UINT64_C(0x0ce0f33820851810),
+  UINT64_C(0x10406508aa042746), UINT64_C(0xc006022598012742), UINT64_C(0x068040948c602004),
+  UINT64_C(0xb04409800140e332), UINT64_C(0x2839218724170808), UINT64_C(0x9008901162c24505),
+  UINT64_C(0x0619032e1500d0c1), UINT64_C(0x80844c432146a4a4), UINT64_C(0x24c0cc28411821c1),
+  UINT64_C(0x0605824235209105), UINT64_C(0x0e60ab184021018e), UINT64_C(0x1185508200184003),
+  UINT64_C(0xc0c81420882280d0), UINT64_C(0x918048160244ae0b), UINT64_C(0x12c548011002e826),
+  UINT64_C(0x036a089802951145), UINT64_C(0x3182e4080532a251), UINT64_C(0x1414e20095442808),
+  UINT64_C(0x2200422c288a9008), UINT64_C(0x69190020c2400421), UINT64_C(0x0a7503021006084a),
+  UINT64_C(0x744010c901356130), UINT64_C(0x680e97b062a20588), UINT64_C(0x030c14c201100442),
+  UINT64_C(0xab4301240a2820a1), UINT64_C(0xc012416d808a2410), UINT64_C(0x29881140201e572d),
+  UINT64_C(0x528c010410055681), UINT64_C(0x0600e0b830210e40), UINT64_C(0xa84084844807164b),
+  UINT64_C(0x2300e294d5021316), UINT64_C(0x9c00425415a9882e), UINT64_C(0x6105434c0a808029),
+  UINT64_C(0x39822950273044d5), UINT64_C(0x58d1280b04452046), UINT64_C(0xd0123882a1348512),
+  UINT64_C(0x840c0560c8022108), UINT64_C(0x04251a9000c01364), UINT64_C(0x3b0223804880682c),
+  UINT64_C(0x1a3044c004418008), UINT64_C(0x4041014301c40695), UINT64_C(0x80301ab000c12286),
+  UINT64_C(0x840cc84324360180), UINT64_C(0x23f04180aa0c0004), UINT64_C(0x55280e405ca00a02),
+  UINT64_C(0x8854282800400181), UINT64_C(0x08147102221c0059), UINT64_C(0x20d1a0200c301610),
+  UINT64_C(0x021898902004860b), UINT64_C(0xc214045011228c88), UINT64_C(0x880241f010847022),
+  UINT64_C(0x234140044100aa21), UINT64_C(0x9c40813840087211), UINT64_C(0x88891466100719a8),
+  UINT64_C(0x20318c0486709348), UINT64_C(0x90252812450cb400), UINT64_C(0x2287383216120692),
+  UINT64_C(0x6b941841ca04060e), UINT64_C(0x00031003b8292012), UINT64_C(0x2942203014900029),
+  UINT64_C(0x88a447884c800920), UINT64_C(0x1941871140464e80), UINT64_C(0x9111230801e22690),
+  UINT64_C(0xe0ca50081e0420d0), UINT64_C(0x8618d50db1380448), UINT64_C(0x0080e494648ba841),
+  UINT64_C(0x0001201a18340206), UINT64_C(0x000c04098000a1e1), UINT64_C(0x4c1826550a408ff1),
+  UINT64_C(0x4060810663a31010), UINT64_C(0x249570080c408030), UINT64_C(0x47928451130120e4),
+  UINT64_C(0x000470800d20b910), UINT64_C(0xb00180e44240100f), UINT64_C(0x73124608208c5ca1),
+  UINT64_C(0x2c209b00015e4504), UINT64_C(0x41c009010060d054), UINT64_C(0x0c00805038328c14),
+  UINT64_C(0x030098294a115404), UINT64_C(0x55001a8391e02002), UINT64_C(0x0671ac0604a92208),
+  UINT64_C(0xa0a220803c080840), UINT64_C(0x609800554c948260), UINT64_C(0x4214e22814aa0288),
+  UINT64_C(0x6410e81211220430), UINT64_C(0xe320180012862402), UINT64_C(0x14c48e03c11b3441),
+  UINT64_C(0x074442a081481101), UINT64_C(0xd8803708ac020081), UINT64_C(0xb80108044a3a8034),
+  UINT64_C(0x4488411471a14a91), UINT64_C(0x108208c00601080a), UINT64_C(0x056410b580b30109),
+  UINT64_C(0x27026e0970009260), UINT64_C(0x8502a3c859058310), UINT64_C(0x4a2c00a0a258a082),
+  UINT64_C(0x28128214644e1901), UINT64_C(0x0688082645831043), UINT64_C(0x1012040809622046),
+  UINT64_C(0x006c9621092202c0), UINT64_C(0x2306925240510225), UINT64_C(0x35022a4019bde217),
+  UINT64_C(0x7088552010800000), UINT64_C(0x48480300a8885270), UINT64_C(0x8a14389802c07450),
+  UINT64_C(0x464821520821c172), UINT64_C(0x035c808d082c00c2), UINT64_C(0x150a0406a0413440),
+  UINT64_C(0x00110800d17c20a6), UINT64_C(0x290522456a481050), UINT64_C(0x8400a002a0b853c8),
+  UINT64_C(0x006420300226c003), UINT64_C(0x800474011a504a2c), UINT64_C(0xc41440297082012e),
+  UINT64_C(0x422f184e8c680f03), UINT64_C(0x0700055a5e00b014), UINT64_C(0x9801402410882080),
+  UINT64_C(0x9060853400408e28), UINT64_C(0x88e8580030860a96), UINT64_C(0xb4d9403830002888),
+  UINT64_C(0x20c68001c12240e2), UINT64_C(0x25a240415500a154), UINT64_C(0x2a130c0059058039),
+  UINT64_C(0xc1051544aa506460), UINT64_C(0xf080a96102288d94), UINT64_C(0x0260c1a01224021d),
+  UINT64_C(0x840201d000670910), UINT64_C(0x0252045868280400), UINT64_C(0x6620804951420013),
+  UINT64_C(0x8e20e2308a944031), UINT64_C(0x28841104e0991d68), UINT64_C(0x45002840098682c8),
+  UINT64_C(0x012172123000240c), UINT64_C(0x20412088822103e2), UINT64_C(0x614e4a21601d0680),
+  UINT64_C(0x1504b04c38239722), UINT64_C(0x80100a2e12998030), UINT64_C(0x6012150614040088),
+  UINT64_C(0x0860114585ca0489), UINT64_C(0x536480180240380b), UINT64_C(0xca008d0801512cd4),
+  UINT64_C(0x2a8c190c502160e3), UINT64_C(0x0460924d0031a010), UINT64_C(0x2c44a0a280149900),
+  UINT64_C(0x0900220e48004039), UINT64_C(0x65c016230428010c), UINT64_C(0x84e100047648ac98),
+  UINT64_C(0x0e01289006200944), UINT64_C(0x0704505430010288), UINT64_C(0x4108424e604b2651),
+  UINT64_C(0x3a142af290188029), UINT64_C(0x7081050212110c40), UINT64_C(0xa848847302ccd1a0),
+  UINT64_C(0x0975923060c70a01), UINT64_C(0x7c48952030300150), UINT64_C(0x489a02a4110a1640),
+  UINT64_C(0x314e00c0a8d10916), UINT64_C(0x901728428870e884), UINT64_C(0xc0b9730b0001400a),
+  UINT64_C(0x04b2010161205289), UINT64_C(0x18102202402032c0), UINT64_C(0x0418a808996288cc),
+  UINT64_C(0x4c1205103b910240), UINT64_C(0x02440459a4100000), UINT64_C(0x1a5041804b055992),
+  UINT64_C(0x000a2402341ca801), UINT64_C(0x9100ac6485020180), UINT64_C(0x9101129720a4c085),
+  UINT64_C(0xc00a40023031c800), UINT64_C(0xa53211a8029d0322), UINT64_C(0x44205a4248818344),
+  UINT64_C(0x1043a00e448830a9), UINT64_C(0x212044cd420930c1), UINT64_C(0x6d089010cd000034),
+  UINT64_C(0x04008a0022a34042), UINT64_C(0x22105150871202da), UINT64_C(0x28e05120032424c0),
+  UINT64_C(0x22081e00191a3462), UINT64_C(0x985427000418088e), UINT64_C(0x230214401418ec0a),
+  UINT64_C(0x8569092102509004), UINT64_C(0xd600900200010098), UINT64_C(0x800801a8ac068a32),
+  UINT64_C(0x447847c4a302040a), UINT64_C(0x15293404d8900403), UINT64_C(0xb072045441411981),
+  UINT64_C(0x58a0428008d60192), UINT64_C(0x98211401e100c349), UINT64_C(0x80080013506b140b),
+  UINT64_C(0x4ac030e10504092c), UINT64_C(0x004818a048312184), UINT64_C(0x072b90c004491502),
+  UINT64_C(0x3022819211200018), UINT64_C(0x480c002220c85031), UINT64_C(0x3121a50002900acc),
+  UINT64_C(0x1fd8801440480400), UINT64_C(0x020c11229226ac20), UINT64_C(0x42e6420808351301),
+  UINT64_C(0x3040a0ca090a1412), UINT64_C(0x20118082c04400b8), UINT64_C(0x809b20449005c51a),
+  UINT64_C(0x05c8a004ac128010), UINT64_C(0x4241809d3480480c), UINT64_C(0x880069010c126500),
+  UINT64_C(0xce1c0251e08000a0), UINT64_C(0x14ec2018b0088212), UINT64_C(0x8460040a05040210),
+  UINT64_C(0x30a1104a8682c080), UINT64_C(0x0d229c0405c61808), UINT64_C(0x19205a3a23204c15),
+  UINT64_C(0x100c9c810a010468), UINT64_C(0xa884008030114221), UINT64_C(0x724840053d101604),
+  UINT64_C(0x0213e0a08c28000c), UINT64_C(0x0a8e620002102501), UINT64_C(0x1053031008865860),
+  UINT64_C(0xc820612c51c50cdc), UINT64_C(0x2641ec1810066580), UINT64_C(0x2a289e049007400b),
+  UINT64_C(0x32a71e1829839040), UINT64_C(0x1c42030087244800), UINT64_C(0x81b0200c0c0c4541),
+  UINT64_C(0x00912104a980c488), UINT64_C(0x410908ac02490284), UINT64_C(0x44d000093e410a38),
+  UINT64_C(0x243e899000013064), UINT64_C(0x42022481a5a00500), UINT64_C(0x2a158b224b58802a),
+  UINT64_C(0x02b2648082082823), UINT64_C(0x20198961c0e0150d), UINT64_C(0x422050390682e209),
+  UINT64_C(0x4cc00d001810080a), UINT64_C(0x482292a418376147), UINT64_C(0x01c3101441300c05),
+  UINT64_C(0x175045464848b208), UINT64_C(0x8184004c1806c428), UINT64_C(0x30009c0064948d29),
+  UINT64_C(0xc10420940065e010), UINT64_C(0x289801221340a652), UINT64_C(0xc0a8500868000721),
+  UINT64_C(0x06405059d1aa0440), UINT64_C(0x11010f0404d450b1), UINT64_C(0x102402c80e821dd2),
+  UINT64_C(0xc82802330400001c), UINT64_C(0x009109201404021a), UINT64_C(0x32018801024161a0),
+  UINT64_C(0x0310420100185060), UINT64_C(0x00a0340361902404), UINT64_C(0x8143407c008099a8),
+  UINT64_C(0xd1a1218700940082), UINT64_C(0x60000112675a0980), UINT64_C(0x127159205303000e),
+  UINT64_C(0x0c11d8f020264a50), UINT64_C(0x00c0452802801404), UINT64_C(0x2180a8031c42a070),
+  UINT64_C(0x00042d644a846900), UINT64_C(0x4211250104c0b50a), UINT64_C(0xe093231608800911),
+  UINT64_C(0x980482006400c0c0), UINT64_C(0x0250144aac25e4c0), UINT64_C(0xa59805c4a01a1006),
+  UINT64_C(0x01014c04c0000205), UINT64_C(0x0224002402293901), UINT64_C(0x298143c4205a5018),
+  UINT64_C(0x4c001211a2b2910c), UINT64_C(0x522030000604048c), UINT64_C(0x82d440612821206c),
+  UINT64_C(0x407458000202142e), UINT64_C(0x66e9900f10421341), UINT64_C(0x8734880a03110384),
+  UINT64_C(0x111c154268c00c82), UINT64_C(0x9d28036128c888c5), UINT64_C(0x01a91336410224d0),
+  UINT64_C(0x284400082001404a), UINT64_C(0x47801a3c88265121), UINT64_C(0x6021049924a09a42),
+  UINT64_C(0x281124140301b10a), UINT64_C(0x1a87610076590030), UINT64_C(0x1530000426a84010),
+  UINT64_C(0x02880201102a500e), UINT64_C(0x6086c109317445a0), UINT64_C(0x06005240888e4249),
+  UINT64_C(0x14482248c0b8aa24), UINT64_C(0x2e30283289454183), UINT64_C(0x0826014602989062),
+  UINT64_C(0x5192a0044b14ca51), UINT64_C(0x804c00ba06883458), UINT64_C(0x504a30d900200040),
+  UINT64_C(0xa18a18b080204402), UINT64_C(0x040b8405f4100b02), UINT64_C(0x0e20c20088bc8008),
+  UINT64_C(0x03b6600d4243ccc8), UINT64_C(0x891b1444edc24148), UINT64_C(0x0001429001829008),
+  UINT64_C(0x8811190292012070), UINT64_C(0x0c528c6840381004), UINT64_C(0x3685a010c0008040),
+  UINT64_C(0x1503045808842980), UINT64_C(0x88a0328b4606d031), UINT64_C(0x08000161a2180300),
+  UINT64_C(0xc2e4180701611a08), UINT64_C(0xc41441020404836c), UINT64_C(0xc0b0874910040301),
+  UINT64_C(0x560160071180b332), UINT64_C(0x0815ec1009819a8d), UINT64_C(0x201a112eb4023182),
+  UINT64_C(0xa8201d00240e0408), UINT64_C(0x4e84808000284280), UINT64_C(0x9407281387044618),
+  UINT64_C(0xa1629834c0024348), UINT64_C(0x36431e4108412872), UINT64_C(0x0011a1021421a008),
+  UINT64_C(0x03120066a884d852), UINT64_C(0x04a811044b30c871), UINT64_C(0x020802a1102ca681),
+  UINT64_C(0x4011618a02658672), UINT64_C(0x01e80330ca8b1084), UINT64_C(0x3220580100080d05),
+  UINT64_C(0x2a54012044010221), UINT64_C(0x118136aa2c088002), UINT64_C(0x0079020140324061),
+  UINT64_C(0x001450a233018e8a), UINT64_C(0xa0d2984831124502), UINT64_C(0x88265248200d0003),
+  UINT64_C(0x1608541e30922420), UINT64_C(0x884440204c00f009), UINT64_C(0x51a0022448c22020),
+  UINT64_C(0xd418a81248544d80), UINT64_C(0x18010905212248c1), UINT64_C(0x0406002084742ad4),
+  UINT64_C(0x048a562069260389), UINT64_C(0x408a804e41008171), UINT64_C(0xa305213000842910),
+  UINT64_C(0xc22430cc52ca1412), UINT64_C(0xc4238110a4624020), UINT64_C(0x8918890a4507a844),
+  UINT64_C(0x0040149919404382), UINT64_C(0x4020c419f0391264), UINT64_C(0x1228e80621d31107),
+  UINT64_C(0x9c00437e02415024), UINT64_C(0x4304222180016188), UINT64_C(0x6400ac002a0c0710),
+  UINT64_C(0x117c102001408208), UINT64_C(0x16030431122502d2), UINT64_C(0x804e4c418a830408),
+  UINT64_C(0x4102089b20a81401), UINT64_C(0x0834414604143289), UINT64_C(0x01023181c00fc118),
+  UINT64_C(0x50908660c0620e41), UINT64_C(0xdee9d10004081802), UINT64_C(0x0e0904083020e080),
+  UINT64_C(0x0a2051bdc101224c), UINT64_C(0x404624026102a752), UINT64_C(0x914300908a20d102),
+  UINT64_C(0x718840875e04e572), UINT64_C(0x5188284400901c00), UINT64_C(0x4894aa1822ae1047),
+  UINT64_C(0x0e1008500a5200b4), UINT64_C(0x8834011031223541), UINT64_C(0x2605060801202664),
+  UINT64_C(0x3023283050d502b4), UINT64_C(0x0a1f040020408140), UINT64_C(0x09231d0140189884),
+  UINT64_C(0x41409088168030cd), UINT64_C(0x02809c228000e070), UINT64_C(0x8f004e8490240642),
+  UINT64_C(0x21620008f8918920), UINT64_C(0x8421c1588244881b), UINT64_C(0x6202304330530440),
+  UINT64_C(0x0001002020209610), UINT64_C(0x05d0c83730020009), UINT64_C(0x7880a4808b144980),
+  UINT64_C(0xa8c8106050315020), UINT64_C(0x40429c818000a805), UINT64_C(0x01020800c48c629a),
+  UINT64_C(0x400304040a5dd103), UINT64_C(0x00da02420da4887d), UINT64_C(0x851091aa61015018),
+  UINT64_C(0x460b388900504464), UINT64_C(0x0320588430116128), UINT64_C(0x5123048245093022),
+  UINT64_C(0x13444240c2a02a30), UINT64_C(0x420b0488844c4431), UINT64_C(0x244882032062810c),
+  UINT64_C(0x42c1e3a5008a0098), UINT64_C(0x1c4498ab0d144650), UINT64_C(0x20300018122a3482),
+  UINT64_C(0x0401264029080214), UINT64_C(0x350484e00db1c920), UINT64_C(0xe00813c634104029),
+  UINT64_C(0x98ba805121860a21), UINT64_C(0x187870153044485b), UINT64_C(0x8090010aaa410000),
+  UINT64_C(0xc0a84498010242a0), UINT64_C(0x20a9021034530064), UINT64_C(0x0020048c02209090),
+  UINT64_C(0x498f2043d29ae541), UINT64_C(0x31330040090c9020), UINT64_C(0x0a1440a742096686),
+  UINT64_C(0xa256c08085406880), UINT64_C(0xcd0880b02000044b), UINT64_C(0x13aa181c40e01330),
+  UINT64_C(0x0150621a008110b0), UINT64_C(0x002020600ac32458), UINT64_C(0x00a32b2042400344),
+  UINT64_C(0x9285ca2b54a0c041), UINT64_C(0x0017200908170308), UINT64_C(0x0006ca20088826c0),
+  UINT64_C(0x01080e0948010636), UINT64_C(0x04150802010120b1), UINT64_C(0x13b2510406088920),
+  UINT64_C(0xc488ba2306405004), UINT64_C(0xc0007b836324a014), UINT64_C(0x5601849034406f52),
+  UINT64_C(0x04cc0c81089c0042), UINT64_C(0x2560b60451181071), UINT64_C(0x90140d0081988822),
+  UINT64_C(0x59b145612207a052), UINT64_C(0xc061071048349384), UINT64_C(0xc9058a1e04483448),
+  UINT64_C(0x248918121c40268a), UINT64_C(0xe30214215001020a), UINT64_C(0x20c19a12b8901100),
+  UINT64_C(0x8302209e12004889), UINT64_C(0x1028460d80c15c03), UINT64_C(0xe441a403404c08a5),
+  UINT64_C(0x5448133a14844400), UINT64_C(0x8cc8495104078000), UINT64_C(0x089214a14b80220d),
+  UINT64_C(0x1122741861080900), UINT64_C(0x822008a402000012), UINT64_C(0x2182020054500c81),
+  UINT64_C(0x247aa901830a8530), UINT64_C(0x4994ea06002a0800), UINT64_C(0x040864d12726c868),
+  UINT64_C(0x43020501f0802109), UINT64_C(0x30a5481419423840), UINT64_C(0x20200d084a590804),
+  UINT64_C(0x9020104890563983), UINT64_C(0x41408474a592424c), UINT64_C(0x19049a1843021880),
+  UINT64_C(0x504ab0800b162094), UINT64_C(0x0800501022156508), UINT64_C(0x1688580ad8e33410),
+  UINT64_C(0x003463041800130c), UINT64_C(0x4084048064143128), UINT64_C(0x4428034481e008c0),
+  UINT64_C(0x9a2482bd31e1008e), UINT64_C(0x468b510024004692), UINT64_C(0x22128710a32e2560),
+  UINT64_C(0x5441684888b00b20), UINT64_C(0x2c03240890a8a001), UINT64_C(0x1108302888116089),
+  UINT64_C(0x8482010724ac4114), UINT64_C(0x4529b108530b8084), UINT64_C(0xa210519008438004),
+  UINT64_C(0x4b0c4201028533a0), UINT64_C(0x1001c28234488342), UINT64_C(0x8024600092398280),
+  UINT64_C(0x0a3a132678830d52), UINT64_C(0x2001043144444100), UINT64_C(0x08554909022022d0),
+  UINT64_C(0xc04480431404a0c6), UINT64_C(0x205018c0c1050100), UINT64_C(0x760712c044880300),
+  UINT64_C(0x2050846c11410280), UINT64_C(0x828a00e420805022), UINT64_C(0xcd8a074448305e4d),
+  UINT64_C(0x9a0850b2014a6042), UINT64_C(0xd8852859b0508080), UINT64_C(0x82028838a00162a5),
+  UINT64_C(0x04808052a44b1023), UINT64_C(0x0550831004683904), UINT64_C(0x6128040804005949),
+  UINT64_C(0x80c03c25000a9704), UINT64_C(0x1854413703e8c051), UINT64_C(0xd214404184000392),
+  UINT64_C(0x600ec021b0000403), UINT64_C(0x52260e880843ab55), UINT64_C(0x1621030000c45183),
+  UINT64_C(0x03394180421700c0), UINT64_C(0x95300802028a5a51), UINT64_C(0x14890a0311c11c4c),
+  UINT64_C(0x141099308a34aa00), UINT64_C(0x40004910e830128a), UINT64_C(0x400080405839a010),
+  UINT64_C(0x81052414d42c02ac), UINT64_C(0xc090606b0041252a), UINT64_C(0x814138062cc40528),
+  UINT64_C(0x8208aa85544470c0), UINT64_C(0x8459e0810403c00a), UINT64_C(0xa02806b02037020d),
+  UINT64_C(0x3188009008183827), UINT64_C(0x0002050643146888), UINT64_C(0x2890508d26d00022),
+  UINT64_C(0x8002093388a2091c), UINT64_C(0x0041801400648044), UINT64_C(0x604c610185004432),
+  UINT64_C(0x04305884838b1184), UINT64_C(0x0288da8414690235), UINT64_C(0x05060b0451001288),
+  UINT64_C(0xc9010201ac800020), UINT64_C(0x4c180362c0801871), UINT64_C(0x8120409034070e12),
+  UINT64_C(0x92120120a035018e), UINT64_C(0x24c4044c492a1182), UINT64_C(0x4101d01848081001),
+  UINT64_C(0x19542c1cc5189012), UINT64_C(0x829242c41ac4c043), UINT64_C(0x006a0020840840a0),
+  UINT64_C(0x40b4601b2209000b), UINT64_C(0x109628903b660648), UINT64_C(0x8a320025580a55a8),
+  UINT64_C(0x01042a4709612026), UINT64_C(0x2040cf00801420a0), UINT64_C(0x80844143920914ea),
+  UINT64_C(0x65220000c18050b1), UINT64_C(0x0d249110102422d2), UINT64_C(0xa28a88501d628160),
+  UINT64_C(0x60080271d0a46068), UINT64_C(0x0124d8c18808ba10), UINT64_C(0x0f544b3a88940a29),
+  UINT64_C(0x6114248e74013008), UINT64_C(0x00092151004a9e09), UINT64_C(0x0010221602099440),
+  UINT64_C(0xba01d48820400484), UINT64_C(0x08d45645111044a0), UINT64_C(0x33a12045a41aa150),
+  UINT64_C(0x88214a2009203108), UINT64_C(0xa82f30605206a500), UINT64_C(0x18912220e9200b40),
+  UINT64_C(0x42404188648a4084), UINT64_C(0x020141c104108214), UINT64_C(0x282a15c528002621),
+  UINT64_C(0x064e748131432341), UINT64_C(0x1610461a5080baab), UINT64_C(0xe1080402ec422c42),
+  UINT64_C(0x04410a00e470090c), UINT64_C(0x4525601844200084), UINT64_C(0x800ec508012001d0),
+  UINT64_C(0x234080c88836018a), UINT64_C(0x64c01c4089910047), UINT64_C(0xb212aca85140d026),
+  UINT64_C(0x001012060c428d01), UINT64_C(0x55828e142300c840), UINT64_C(0x8e70330364a45600),
+  UINT64_C(0x2cd8209800042420), UINT64_C(0x81401238999231e1), UINT64_C(0x204948100441a426),
+  UINT64_C(0x1520455844091102), UINT64_C(0x518401c33a903048), UINT64_C(0x0880882549645111),
+  UINT64_C(0xc650011044c82244), UINT64_C(0x8083750139400112), UINT64_C(0x0200418d90820606),
+  UINT64_C(0x4200aa9130e00f11), UINT64_C(0x8a3500ea58490110), UINT64_C(0x1389000b520f10c1),
+  UINT64_C(0x2d00022408981404), UINT64_C(0x0a08c92226070802), UINT64_C(0x0c1014b028048140),
+  UINT64_C(0xc420000892000409), UINT64_C(0x408c0010816a1361), UINT64_C(0x1c132a46c849a090),
+  UINT64_C(0x309e044134424082), UINT64_C(0xc508231026405560), UINT64_C(0xc1b0a01b1120500c),
+  UINT64_C(0x545d542a91044810), UINT64_C(0x8528082020323621), UINT64_C(0x5402021241400006),
+  UINT64_C(0x3202846202b87806), UINT64_C(0x130150600e8528b0), UINT64_C(0x34c008028a161118),
+  UINT64_C(0x02a83090100202d5), UINT64_C(0x3212788204616100), UINT64_C(0x81a8008041316080),
+  UINT64_C(0x00e0085100380c02), UINT64_C(0x840242000ce04205), UINT64_C(0x4a06202c2c83c16a),
+  UINT64_C(0x8011852203048410), UINT64_C(0x88d0202a43020a05), UINT64_C(0x88190579341080a8),
+  UINT64_C(0x04200a1421062008), UINT64_C(0x30ac569060183904), UINT64_C(0x121380a40014a294),
+  UINT64_C(0x928c608502c06031), UINT64_C(0x80102d05c012d60c), UINT64_C(0x0528a01b00c1080a),
+  UINT64_C(0x8c84c94910066c20), UINT64_C(0x4370d1c141a825a2), UINT64_C(0x4009c48cc8a18475),
+  UINT64_C(0x0602e10a88404202), UINT64_C(0x90a0540024006069), UINT64_C(0x783021610c8a4280),
+  UINT64_C(0x1164a39321282005), UINT64_C(0x609084189051408a), UINT64_C(0x804449a011240060),
+  UINT64_C(0x764334c005a02230), UINT64_C(0xa11028f80a449b05), UINT64_C(0x983610066890b890),
+  UINT64_C(0x543a021180008029), UINT64_C(0x40008b0d502da01a), UINT64_C(0x3489401208040794),
+  UINT64_C(0x289c4a55a0240002), UINT64_C(0x0743360000b39325), UINT64_C(0x80460a5006102905),
+  UINT64_C(0x20001240d8164188), UINT64_C(0x4810192062988f24), UINT64_C(0x11a008a44029400a),
+  UINT64_C(0x6604504a0e010a40), UINT64_C(0x020295581b820425), UINT64_C(0x1502609b01819800),
+  UINT64_C(0x0b504a72d0102a09), UINT64_C(0x222a6004c0c94080), UINT64_C(0x945806004640d4e0),
+  UINT64_C(0x085010a121479a02), UINT64_C(0x2804a0488200cc92), UINT64_C(0x00980c29433131a2),
+  UINT64_C(0x00c4084109288054), UINT64_C(0x064021249a001884), UINT64_C(0x48006389804a0128),
+  UINT64_C(0xb8ba30020ce4ca11), UINT64_C(0x0004433020c59a92), UINT64_C(0x40c0a0c801332030),
+  UINT64_C(0x89da08ac21802447), UINT64_C(0x0203424860529505), UINT64_C(0x104484980e950182),
+  UINT64_C(0x8128210848084082), UINT64_C(0x6100085302180410), UINT64_C(0x570d0800540c44c7),
+  UINT64_C(0xa014302032512532), UINT64_C(0x0be452e4020c000d), UINT64_C(0x1620080410702811),
+  UINT64_C(0x8356060244ad0812), UINT64_C(0x420826c490938c11), UINT64_C(0x71cb9104031c0260),
+  UINT64_C(0x0a50000400a26c88), UINT64_C(0x344420888000a24e), UINT64_C(0x44221120b9101242),
+  UINT64_C(0x1149ac9808001503), UINT64_C(0x285720968a6c0300), UINT64_C(0x00904080c01a1110),
+  UINT64_C(0xc0331a65200e8009), UINT64_C(0x448408090322a458), UINT64_C(0x920110222c048d4a),
+  UINT64_C(0x08000968011e04e2), UINT64_C(0x50486c0245492835), UINT64_C(0x38278410809ca089),
+  UINT64_C(0x438304a140c5b130), UINT64_C(0x008830026ab2c0c5), UINT64_C(0x1240809641447008),
+  UINT64_C(0x0699293031108584), UINT64_C(0x001c5c000a11028e), UINT64_C(0x000200c1b0719f00),
+  UINT64_C(0x2800831241100808), UINT64_C(0xc105228984430c28), UINT64_C(0xc4800c3048d21415),
+  UINT64_C(0x1b3000a600064847), UINT64_C(0x28580c2891062c0e), UINT64_C(0x42401a0923205305),
+  UINT64_C(0x0588248098222442), UINT64_C(0x112086b4121c8021), UINT64_C(0xa808042016014451),
+  UINT64_C(0xa1381123488a8120), UINT64_C(0xcca403b112838448), UINT64_C(0x601e748b0e242208),
+  UINT64_C(0x004e861030272060), UINT64_C(0x1000e84449920414), UINT64_C(0xa6204814868019a2),
+  UINT64_C(0x08921621400900c2), UINT64_C(0x00328245a02c8060), UINT64_C(0x00400200110e2a96),
+  UINT64_C(0xc21aa4839042442e), UINT64_C(0x0f0004043805040b), UINT64_C(0x6061804679023204),
+  UINT64_C(0x2861800090b98200), UINT64_C(0x310a108502440559), UINT64_C(0x08682656e0060980),
+  UINT64_C(0x5395400840449085), UINT64_C(0x94180598a5004890), UINT64_C(0x0816886031800008),
+  UINT64_C(0x7480941dc5e21051), UINT64_C(0x0800082081206208), UINT64_C(0x088230c8004260c0),
+  UINT64_C(0x1801270280cc4498), UINT64_C(0x42314009202a0410), UINT64_C(0x008219ca20048406),
+  UINT64_C(0x8a08d301401140a4), UINT64_C(0x520a201035820a11), UINT64_C(0x9a00a120088d2208),
+  UINT64_C(0x000a51280a041c80), UINT64_C(0x2042920504c80180), UINT64_C(0x04044108000fa8d8),
+  UINT64_C(0x2049c041a514a096), UINT64_C(0x00a41061082715ab), UINT64_C(0x000806061d380046),
+  UINT64_C(0x3030298c1d200194), UINT64_C(0x28043100125a4032), UINT64_C(0x84300d1044300310),
+  UINT64_C(0x4c29121c05c18a88), UINT64_C(0xf880842a20140812), UINT64_C(0x0110c498221810e4),
+  UINT64_C(0x0226101b44402006), UINT64_C(0x02244aa48001423a), UINT64_C(0x912015a3101c3541),
+  UINT64_C(0x0881a404806a90f9), UINT64_C(0x4948512335402642), UINT64_C(0x0003b4e0a4034418),
+  UINT64_C(0x8a42811480010120), UINT64_C(0x2080cc5604a01c14), UINT64_C(0x1460678ec1284110),
+  UINT64_C(0x2108622020060800), UINT64_C(0xe891a20440840341), UINT64_C(0x8448002c116b1040),
+  UINT64_C(0x7603e42103018a28), UINT64_C(0x04804da1cb8c4109), UINT64_C(0x122f301110600225),
+  UINT64_C(0xb213222448354982), UINT64_C(0x110b240424491120), UINT64_C(0x04120037a4800f68),
+  UINT64_C(0x4824900164605884), UINT64_C(0x8a06d5420801c602), UINT64_C(0x009000b1a10030a2),
+  UINT64_C(0x22410008100b0235), UINT64_C(0x1c41081806199025), UINT64_C(0x42b420a8c8d8489a),
+  UINT64_C(0xa92904304b800011), UINT64_C(0x0371122b060c26d4), UINT64_C(0x108414220b10e82c),
+  UINT64_C(0x028245e00091012c), UINT64_C(0x2046f81a8c888042), UINT64_C(0x291424060d010b88),
+  UINT64_C(0x10241304e88a31c0), UINT64_C(0x41190220090c1a90), UINT64_C(0x01500030560030c3),
+  UINT64_C(0x0812485303002422), UINT64_C(0x0c24c40400b03287), UINT64_C(0x54651241a0a0a800),
+  UINT64_C(0x80300a4450102011), UINT64_C(0x828a00c00c104003), UINT64_C(0x3161842349824e00),
+  UINT64_C(0x02840838240d0a08), UINT64_C(0x14100053202608d4), UINT64_C(0x4302c484902c00a9),
+  UINT64_C(0x2428c410782b0650), UINT64_C(0x31106280c6803282), UINT64_C(0x0889406126c74880),
+  UINT64_C(0x2440295088e89015), UINT64_C(0x4044a8201404e842), UINT64_C(0x52dd04220d06030a),
+  UINT64_C(0x22180511538463a8), UINT64_C(0x44200804e8622200), UINT64_C(0x834583c20c659124),
+  UINT64_C(0xb192510d24802820), UINT64_C(0x045014040148c811), UINT64_C(0x046c029523820e05),
+  UINT64_C(0x06c12c38a0540842), UINT64_C(0x806a4749732b000a), UINT64_C(0x008612c024aa0a26),
+  UINT64_C(0xa52048085604181c), UINT64_C(0xe88100008200b189), UINT64_C(0x40001b570050010c),
+  UINT64_C(0x8001680045a95012), UINT64_C(0x401ce18106424228), UINT64_C(0x8418848428332245),
+  UINT64_C(0x156290500c038120), UINT64_C(0x2441e33450242289), UINT64_C(0xab304422888e4010),
+  UINT64_C(0x1482121683b00929), UINT64_C(0x4240cb0422c41042), UINT64_C(0x1c87049082024880),
+  UINT64_C(0x0158106000381408), UINT64_C(0x15804e8171c10037), UINT64_C(0x20552c0a98f090ba),
+  UINT64_C(0x0b0062290a181070), UINT64_C(0x0c00ac4108045034), UINT64_C(0x485080a23085721b),
+  UINT64_C(0xa20c89e2096008ca), UINT64_C(0x6682898c42153304), UINT64_C(0x2068420140981020),
+  UINT64_C(0x111009380a8d800f), UINT64_C(0x40200401a882b082), UINT64_C(0xb042042042184745),
+  UINT64_C(0xd8410301252900d9), UINT64_C(0x000a00409d232024), UINT64_C(0x823e1a150a045244),
+  UINT64_C(0x430a524e6c708030), UINT64_C(0x000226e410a08022), UINT64_C(0x22a0024e80952881),
+  UINT64_C(0x00530502a1144c30), UINT64_C(0x168101105144cc81), UINT64_C(0x260141d82e000874),
+  UINT64_C(0x4402010152027401), UINT64_C(0x0066805dc8192621), UINT64_C(0x881400c2821508b9),
+  UINT64_C(0xc08b618d44005908), UINT64_C(0xac38224382000069), UINT64_C(0x1094199622821848),
+  UINT64_C(0x5000f4402940c420), UINT64_C(0x0c440970a21b0640), UINT64_C(0x0040941005902571),
+  UINT64_C(0xa200470683085924), UINT64_C(0x211400c10251480a), UINT64_C(0x01082112c026c854),
+  UINT64_C(0x1088022a17424087), UINT64_C(0x5e030440bc016c00), UINT64_C(0x20d2180068082628),
+  UINT64_C(0x0384280928a08111), UINT64_C(0x0034261800f05a0c), UINT64_C(0xd80660485c4a8419),
+  UINT64_C(0x7510a26748260828), UINT64_C(0x0c110008050c1400), UINT64_C(0x04938440b5028482),
+  UINT64_C(0x40d0802c22ba6104), UINT64_C(0x302d020b45280900), UINT64_C(0x81040e6010054300),
+  UINT64_C(0x92152604208d0102), UINT64_C(0x404280230908d080), UINT64_C(0x451841191021045c),
+  UINT64_C(0x900809010944c23c), UINT64_C(0x08101780a9233040), UINT64_C(0x5288620070502402),
+  UINT64_C(0x150202868d410211), UINT64_C(0x300c01438253b8a8), UINT64_C(0x14828000648ec0e4),
+  UINT64_C(0x4101922a002a8618), UINT64_C(0xc2c12058001281b8), UINT64_C(0x6a000b24882406ca),
+  UINT64_C(0x63670040416a0704), UINT64_C(0x2170295c8c240111), UINT64_C(0x42a444852c160890),
+  UINT64_C(0x0852804441828260), UINT64_C(0x88480004010f9800), UINT64_C(0x9881603803566622),
+  UINT64_C(0x2680481170090183), UINT64_C(0x2486640140009b40), UINT64_C(0x110483720c20080c),
+  UINT64_C(0xc93310848c040410), UINT64_C(0xa0881946a5700004), UINT64_C(0x40a0598114a08c86),
+  UINT64_C(0x2c5919819a220c4a), UINT64_C(0xa2064a4140b62604), UINT64_C(0x4161a018c080a200),
+  UINT64_C(0x1b650c8c00f93a80), UINT64_C(0x3a8050880c8250e0), UINT64_C(0x8080801043448440),
+  UINT64_C(0x025000a8002318d0), UINT64_C(0xc048043326208282), UINT64_C(0xc1680459080e00ea),
+  UINT64_C(0x40cc38012000a814), UINT64_C(0x1037cc6ccec88a14), UINT64_C(0x8210100020800140),
+  UINT64_C(0xb820145606841169), UINT64_C(0x8e0492ab04c168c1), UINT64_C(0x50040d090241042c),
+  UINT64_C(0x2120831061014380), UINT64_C(0x1041cc016471a004), UINT64_C(0x0620c0a4012db2b5),
+  UINT64_C(0x218820828c0a7049), UINT64_C(0x802306204310161c), UINT64_C(0x848868811008e88c),
+  UINT64_C(0x1046480211530082), UINT64_C(0x4f84c04418070002), UINT64_C(0x53809a1034200410),
+  UINT64_C(0x0a04441259a08032), UINT64_C(0x7800030e10488409), UINT64_C(0x085092040b5c1541),
+  UINT64_C(0x0c30012b25cb0088), UINT64_C(0x60413980ac54a010), UINT64_C(0x6d6e03410a023045),
+  UINT64_C(0x0220164b81111054), UINT64_C(0x3c40605080108912), UINT64_C(0x938900c8e091a82a),
+  UINT64_C(0x04a200020a00904c), UINT64_C(0x19882886202048c9), UINT64_C(0x14040052b06620a2),
+  UINT64_C(0x05a48419c200040b), UINT64_C(0x00ca8210d0c00215), UINT64_C(0x0874821213285087),
+  UINT64_C(0x2205606c00cc2861), UINT64_C(0x116a1b0101328498), UINT64_C(0x03851280410a6205),
+  UINT64_C(0x40440c92092103c2), UINT64_C(0x0000412818103620), UINT64_C(0x20c2385b00c10764),
+  UINT64_C(0x9c0044825a0593a0), UINT64_C(0xc220212a4009e529), UINT64_C(0x35d10f44a2361201),
+  UINT64_C(0x42512280020c1082), UINT64_C(0x1a105430102000e4), UINT64_C(0x4010402d03102041),
+  UINT64_C(0x30058a80a91a3805), UINT64_C(0x0241260419486392), UINT64_C(0xb31611a0e4d0c913),
+  UINT64_C(0x5420880000528e94), UINT64_C(0x800551aa10ae1005), UINT64_C(0xc00200101602205c),
+  UINT64_C(0x873a0021e00c0601), UINT64_C(0x1561400661a10251), UINT64_C(0x920269244a410000),
+  UINT64_C(0x183e06093411fc00), UINT64_C(0x0c0013300f8c0180), UINT64_C(0x0c8148083382c202),
+  UINT64_C(0xa288281300436618), UINT64_C(0xc35200d5210440a3), UINT64_C(0x7260988e804b3814),
+  UINT64_C(0xa0000a028490012e), UINT64_C(0x19040048541420c1), UINT64_C(0x0c4292012886dbd0),
+  UINT64_C(0x0909218910842005), UINT64_C(0x0e1a60b283534420), UINT64_C(0x82a01524009020aa),
+  UINT64_C(0x23811a0440402b21), UINT64_C(0x856208800410a189), UINT64_C(0x0083002606028400),
+  UINT64_C(0x890016242e804038), UINT64_C(0x438cf00424611684), UINT64_C(0x808461099014cc00),
+  UINT64_C(0xc4bc150c10964240), UINT64_C(0x400a3083802ab002), UINT64_C(0x0615215cd12c0a19),
+  UINT64_C(0x6200022446c32973), UINT64_C(0x0c188113e1940468), UINT64_C(0x1380b10101094009),
+  UINT64_C(0x00ca41211200cc12), UINT64_C(0xa1c202041a28028b), UINT64_C(0x200b484458000410),
+  UINT64_C(0x013020801731ba20), UINT64_C(0x00a240a482010112), UINT64_C(0x6d1232400ae01564),
+  UINT64_C(0x88015084300400c2), UINT64_C(0x308908420210281c), UINT64_C(0x63309e0870112481),
+  UINT64_C(0x12c8085214c30040), UINT64_C(0x19204a8c09406000), UINT64_C(0x40aa4301688c4489),
+  UINT64_C(0x20601023034c0610), UINT64_C(0x154020171384868c), UINT64_C(0x0654b10934200ba0),
+  UINT64_C(0x091402d8aa0f4160), UINT64_C(0x0228901731531234), UINT64_C(0x0014006441a9c8a2),
+  UINT64_C(0x228d6403500894a1), UINT64_C(0x61430812adc20804), UINT64_C(0x16e0110a17042408),
+  UINT64_C(0x4040c060a4212800), UINT64_C(0x01008ae081100088), UINT64_C(0x616a000a41039124),
+  UINT64_C(0x01004212832d8081), UINT64_C(0x009044c764015c32), UINT64_C(0x0149014608400945),
+  UINT64_C(0x8010c10416a180c0), UINT64_C(0x1801814a09450088), UINT64_C(0x60280210c31236e0),
+  UINT64_C(0x31836214c0890750), UINT64_C(0x8406830840012100), UINT64_C(0x3232264c0e00a822),
+  UINT64_C(0x8880ad21c5184448), UINT64_C(0x5b5180001021d401), UINT64_C(0x2600116210358712),
+  UINT64_C(0x444600c810927024), UINT64_C(0x212952d9b4110254), UINT64_C(0x010264000e85e125),
+  UINT64_C(0x9225228440421508), UINT64_C(0x64a90c1088180045), UINT64_C(0x90814088014c6281),
+  UINT64_C(0x08c94820a032a048), UINT64_C(0x4112801041ad106a), UINT64_C(0x0140820b208a8306),
+  UINT64_C(0xaa3780588944a0b5), UINT64_C(0xe8190001468d0480), UINT64_C(0x11400800c08ad280),
+  UINT64_C(0x89e0922c00604200), UINT64_C(0x8402cd420b700904), UINT64_C(0x851090b400214229),
+  UINT64_C(0x3188084089080824), UINT64_C(0x9e626d82808120a1), UINT64_C(0x1010070664805808),
+  UINT64_C(0x4580a1410434c809), UINT64_C(0x54a1811100261618), UINT64_C(0x3002007906644260),
+  UINT64_C(0x6382110452200025), UINT64_C(0x4282608e9002a102), UINT64_C(0x00442ae40e111035),
+  UINT64_C(0x1124640a1082d000), UINT64_C(0x4d621706a4880d10), UINT64_C(0x10a1020922480082),
+  UINT64_C(0x14c130003a114210), UINT64_C(0x8a5a4c59c3805420), UINT64_C(0x04670c85a0d12002),
+  UINT64_C(0x2060410ac49c0102), UINT64_C(0x5088040190500428), UINT64_C(0x69cb03202d480ec8),
+  UINT64_C(0x0424e00003814084), UINT64_C(0x6495c86380524046), UINT64_C(0x0220d20010042044),
+  UINT64_C(0x0009e00000291c10), UINT64_C(0x022481c8c1710009), UINT64_C(0x001b10a6d0012942),
+  UINT64_C(0x24200477256a58c5), UINT64_C(0x1c91b21842846859), UINT64_C(0x288800c805064004),
+  UINT64_C(0xc0160ea489203144), UINT64_C(0x4300121098d00a66), UINT64_C(0x30352482c1695108),
+  UINT64_C(0x482a11019a840100), UINT64_C(0x840018052c84d26c), UINT64_C(0x4959d2020500308a),
+  UINT64_C(0x6a00012380202080), UINT64_C(0x6080c08853855602), UINT64_C(0x360a1e1220111107),
+  UINT64_C(0x000608f08c6c6114), UINT64_C(0xa1a700835a8ec100), UINT64_C(0x1001b60446268631),
+  UINT64_C(0x8544190000842646), UINT64_C(0x021021c810228790), UINT64_C(0x44a8c2842a10560b),
+  UINT64_C(0x240806d059119f60), UINT64_C(0x09204360510c9a00), UINT64_C(0xe0004001900700f0),
+  UINT64_C(0x8042041223484514), UINT64_C(0x0224821c3220c4c3), UINT64_C(0x1a05584987036294),
+  UINT64_C(0xad408f1190360202), UINT64_C(0x210728424830a540), UINT64_C(0x1a02445413508906),
+  UINT64_C(0x129841a2c8101408), UINT64_C(0x24620002a0c6100d), UINT64_C(0xd200610400a6c4d4),
+  UINT64_C(0x44141598bc00ac22), UINT64_C(0xc4484d1188311083), UINT64_C(0x108320008cc00820),
+  UINT64_C(0x82048c68104108a4), UINT64_C(0x0310630060128058), UINT64_C(0x18409c3029ac9491),
+  UINT64_C(0x4250100752034447), UINT64_C(0x0042193290000100), UINT64_C(0x878c150089090500),
+  UINT64_C(0x2228d29034c90122), UINT64_C(0x2912068c15002209), UINT64_C(0x0010004040451162),
+  UINT64_C(0x013922008912806c), UINT64_C(0x00291a9610083e45), UINT64_C(0x248a400281254840),
+  UINT64_C(0x0c34d8c4490c008c), UINT64_C(0x410b4ac025281a16), UINT64_C(0x2255024806502108),
+  UINT64_C(0x108705a012084493), UINT64_C(0x8060880443020e10), UINT64_C(0x4c15d020022e1807),
+  UINT64_C(0x129091923930ec98), UINT64_C(0xc4000421000e7223), UINT64_C(0x1180200a101a9660),
+  UINT64_C(0x00106d0a0a907a13), UINT64_C(0x88a91365e017a9a0), UINT64_C(0x2441352560708300),
+  UINT64_C(0x9080439a0008c009), UINT64_C(0x1099b04011250054), UINT64_C(0x491e1050210c0508),
+  UINT64_C(0x41012c0d21308220), UINT64_C(0x021080ee08004025), UINT64_C(0x1014000102024d58),
+  UINT64_C(0x9402266360c00ca9), UINT64_C(0xda04201810c9a200), UINT64_C(0x0000c518001462a0),
+  UINT64_C(0x8a125001e002300d), UINT64_C(0x26241c8060821056), UINT64_C(0x11004aba10106301),
+  UINT64_C(0xf18900a1000d618b), UINT64_C(0x09430912083444e0), UINT64_C(0x04c03800138a1004),
+  UINT64_C(0xe6148840b845c528), UINT64_C(0x281e4c0800824300), UINT64_C(0x4005248800220150),
+  UINT64_C(0x840022680a90301d), UINT64_C(0x2108600a801d4092), UINT64_C(0x1438841005e00805),
+  UINT64_C(0x0000180120cce016), UINT64_C(0xa80804b192364cc0), UINT64_C(0x03ca008509063362),
+  UINT64_C(0x104614d371402105), UINT64_C(0x12018c0080880882), UINT64_C(0x41a6634402460c20),
+  UINT64_C(0x00a0204623f00490), UINT64_C(0x423802b9600a1283), UINT64_C(0xc409c4581021a020),
+  UINT64_C(0x699000002a905144), UINT64_C(0x3420840290890402), UINT64_C(0x06630030c7000b25),
+  UINT64_C(0x3009002ad400e4d1), UINT64_C(0x088a1045096c43b5), UINT64_C(0x0688030452000019),
+  UINT64_C(0xa0545000a002880a), UINT64_C(0xca061ba182214007), UINT64_C(0x6486c68648401425),
+  UINT64_C(0x0d118082c96c1839), UINT64_C(0x5100628348408008), UINT64_C(0x249104002b4a4401),
+  UINT64_C(0x8881d00c10c0e00b), UINT64_C(0x181448292360013a), UINT64_C(0xa48cc50802181445),
+  UINT64_C(0x1220220000039600), UINT64_C(0x91502c00cc2ccb85), UINT64_C(0x302f546d7a001080),
+  UINT64_C(0x01e8214000b2d600), UINT64_C(0x8b30010125818a00), UINT64_C(0x420a553101424440),
+  UINT64_C(0x00c04a800aa92061), UINT64_C(0x3068041c04100802), UINT64_C(0x1e428a44c444100a),
+  UINT64_C(0x310142482001c100), UINT64_C(0x01098f60e6200091), UINT64_C(0x8045880011201015),
+  UINT64_C(0xb49c01c2840041d4), UINT64_C(0xa06a506870aa112c), UINT64_C(0x04042a10903a0914),
+  UINT64_C(0xa5008a4815916104), UINT64_C(0x4222200c18009829), UINT64_C(0x14b08802010e184c),
+  UINT64_C(0x4c30020830812604), UINT64_C(0x3096490a00458468), UINT64_C(0x41f00dd089054283),
+  UINT64_C(0x452098102410ae44), UINT64_C(0x3802808487284223), UINT64_C(0xea8064008a0140a0),
+  UINT64_C(0x70002c2786801000), UINT64_C(0x8665918504a80448), UINT64_C(0x0606ac4313016204),
+  UINT64_C(0x0140020c692d20ca), UINT64_C(0x02040882600a2003), UINT64_C(0xa14060a401903021),
+  UINT64_C(0x2a92150a608c280a), UINT64_C(0x48821034aa320a2c), UINT64_C(0x90a0119164283048),
+  UINT64_C(0x008c00128432a700), UINT64_C(0x609a48f082100186), UINT64_C(0x0509108108209834),
+  UINT64_C(0x0046822c16780200), UINT64_C(0x6104328b385415c0), UINT64_C(0x1810242241460940),
+  UINT64_C(0x5821011040e0020a), UINT64_C(0x1c08010a0c402300), UINT64_C(0x2644053560306125),
+  UINT64_C(0x52627405e1109044), UINT64_C(0x0c262c3005002002), UINT64_C(0x131510050011c4b9),
+  UINT64_C(0x90400a0208440401), UINT64_C(0x4051c080602a1e18), UINT64_C(0x408b21c092330022),
+  UINT64_C(0x82000a900a03438c), UINT64_C(0x0201801ff1230211), UINT64_C(0xa32081600930982a),
+  UINT64_C(0x121813040a456190), UINT64_C(0x38510c50838690a4), UINT64_C(0x581023bc00490003),
+  UINT64_C(0x58c4107117002a86), UINT64_C(0xa840860181014645), UINT64_C(0x200260930049a241),
+  UINT64_C(0x172708e41000f890), UINT64_C(0x833e102828919000), UINT64_C(0xe5000a4126240440),
+  UINT64_C(0x4d050104000ba252), UINT64_C(0x3a8400a011200828), UINT64_C(0xa4924510a3011540),
+  UINT64_C(0x1200024681ca0540), UINT64_C(0x2404a600811d5024), UINT64_C(0xd9045609e0042111),
+  UINT64_C(0x6080b220cc020048), UINT64_C(0x040d19b210c1a015), UINT64_C(0x664aa5ca09100000),
+  UINT64_C(0x8454d0242a10022c), UINT64_C(0x022070d068009021), UINT64_C(0x9070659480c8db83),
+  UINT64_C(0xa808600042120c12), UINT64_C(0x50b38016001c0080), UINT64_C(0x143802344680480c),
+  UINT64_C(0x0a0631180b41c38c), UINT64_C(0x4964d2d10b985508), UINT64_C(0x6200ae8185591022),
+  UINT64_C(0x1540482010c50827), UINT64_C(0x012b2120f8108012), UINT64_C(0x4082011024b00a01),
+  UINT64_C(0x9190000021200451), UINT64_C(0x14423080a0440218), UINT64_C(0x0410035958a40623),
+  UINT64_C(0x06a2188acc983947), UINT64_C(0x00514810c231d102), UINT64_C(0x089402e40e02a0e2),
+  UINT64_C(0x680a8c0001a4810c), UINT64_C(0x8114022313600651), UINT64_C(0x00404571aa00e88e),
+  UINT64_C(0x8238518801026708), UINT64_C(0x004b485984cb9301), UINT64_C(0x8030ae0e10e4410c),
+  UINT64_C(0x500410c44002a120), UINT64_C(0xd400a000600a8488), UINT64_C(0x11e04028450d3404),
+  UINT64_C(0x809141238064a940), UINT64_C(0x051082bc28a022a2), UINT64_C(0x11a580c10d223342),
+  UINT64_C(0x1924a024425822b8), UINT64_C(0xb09440804c040888), UINT64_C(0x208b1042418a06a0),
+  UINT64_C(0xc1c038160448d04b), UINT64_C(0xec80c80a14102428), UINT64_C(0x431c01b810ad1208),
+  UINT64_C(0x21c4041421900254), UINT64_C(0x8243851442c04336), UINT64_C(0x28091428001944a0),
+  UINT64_C(0x141208554440581c), UINT64_C(0xd488328b11205885), UINT64_C(0x420e2c8102608484),
+  UINT64_C(0x04900644b101210a), UINT64_C(0x20cb908524c12032), UINT64_C(0x0331002002098329),
+  UINT64_C(0x40040048044250c0), UINT64_C(0xc170a142208c0130), UINT64_C(0x4221012810a00801),
+  UINT64_C(0xd6415188a5052502), UINT64_C(0x2e46050091ab044c), UINT64_C(0x06c10e44001a2352),
+  UINT64_C(0x042000c099800899), UINT64_C(0xb0b4140840170400), UINT64_C(0x5498202300400114),
+  UINT64_C(0x00c4d8081609cc00), UINT64_C(0x0001a81198434618), UINT64_C(0x040812d040040120),
+  UINT64_C(0x060b104c20020b73), UINT64_C(0x0d000918086920aa), UINT64_C(0x41a0568ca2984121),
+  UINT64_C(0x2881090040d448a5), UINT64_C(0x1e343220024d1000), UINT64_C(0xf4880c583120ed18),
+  UINT64_C(0xc28a96311b064020), UINT64_C(0x0641340400888434), UINT64_C(0x3036804a8d19023e),
+  UINT64_C(0xc026000612c38828), UINT64_C(0xc008ac1322401408), UINT64_C(0x08442086250b12c2),
+  UINT64_C(0x4a4021c221210402), UINT64_C(0x04b84aa4a3810124), UINT64_C(0x0280d20d04800060),
+  UINT64_C(0x1837252804804010), UINT64_C(0x68855500c6880058), UINT64_C(0x09100053401083a5),
+  UINT64_C(0x924c289020412416), UINT64_C(0x348e816815104332), UINT64_C(0x654080a1980c5004),
+  UINT64_C(0x26804cd148109824), UINT64_C(0x0604640401402282), UINT64_C(0x43180020bad5b069),
+  UINT64_C(0x19238a14a2180230), UINT64_C(0x062058324006284a), UINT64_C(0x66940c000e400a6a),
+  UINT64_C(0xe0021c71aa000446), UINT64_C(0x116482d01c22a034), UINT64_C(0x304449864e104188),
+  UINT64_C(0x101e110b204a2980), UINT64_C(0x04430260808a001d), UINT64_C(0x0c24419800442010),
+  UINT64_C(0xc0117110042388d8), UINT64_C(0x82d400c940041027), UINT64_C(0x4700608869821102),
+  UINT64_C(0xa425072204006085), UINT64_C(0x282003c522402011), UINT64_C(0x34ca013308141bcc),
+  UINT64_C(0x0a11a01811081482), UINT64_C(0x804a00010720623a), UINT64_C(0x40c2094810a27404),
+  UINT64_C(0x00e482c518a30223), UINT64_C(0x0106600803e02328), UINT64_C(0x810324c004086042),
+  UINT64_C(0x0da082204b120210), UINT64_C(0x4081902a65011605), UINT64_C(0x1006116920418562),
+  UINT64_C(0x46a6100da0100023), UINT64_C(0x1022e88bccb03640), UINT64_C(0x28220e0057201108),
+  UINT64_C(0x1b1a20e43a018858), UINT64_C(0x611380000ca058a0), UINT64_C(0x0115f80030814011),
+  UINT64_C(0x1a04048a2604a058), UINT64_C(0x04305220c9002482), UINT64_C(0x5409a2dab110b824),
+  UINT64_C(0x980186a008594000), UINT64_C(0x00a047241488c802), UINT64_C(0x51a33144c03408a9),
+  UINT64_C(0x80e0e1a00008a014), UINT64_C(0xc09808c80854e288), UINT64_C(0x0180440190b90361),
+  UINT64_C(0x50822cc930528902), UINT64_C(0x2112015000109204), UINT64_C(0x9a9e004004410839),
+  UINT64_C(0xc85b042408a80588), UINT64_C(0x01802123000a8008), UINT64_C(0x004804a202014350),
+  UINT64_C(0x8e249540810b048c), UINT64_C(0x06819808e068a805), UINT64_C(0x1062090244006284),
+  UINT64_C(0xa9ba0647801190d8), UINT64_C(0x1d580c600818cc48), UINT64_C(0x414141a100617812),
+  UINT64_C(0x8083b1101054842e), UINT64_C(0x68a4028862030180), UINT64_C(0x072920400d211510),
+  UINT64_C(0xb431208442089208), UINT64_C(0x83096020989b6012), UINT64_C(0x905012550632c100),
+  UINT64_C(0x0430828c00620840), UINT64_C(0x50007128a5108108), UINT64_C(0x6ae68a9851054102),
+  UINT64_C(0x00c35c8204408b11), UINT64_C(0xb041050612118aa0), UINT64_C(0x082820c000864442),
+  UINT64_C(0x109a280140d01d04), UINT64_C(0x060503a470a82e82), UINT64_C(0xb8c52092204100e8),
+  UINT64_C(0x26508224d9881262), UINT64_C(0x0427804100610105), UINT64_C(0x02458c1c84000281),
+  UINT64_C(0x2101236a90903c08), UINT64_C(0x4808042200380341), UINT64_C(0x4609701304250a08),
+  UINT64_C(0x505980e29402050c), UINT64_C(0xa3ac09183a240204), UINT64_C(0x1100c0811c821841),
+  UINT64_C(0x1c04602208814b01), UINT64_C(0x48b066a65285304a), UINT64_C(0xb43027104e401201),
+  UINT64_C(0x086409023600a800), UINT64_C(0x0041808181452034), UINT64_C(0x240c9078f020004a),
+  UINT64_C(0x408d084488000242), UINT64_C(0xb0122a900180000a), UINT64_C(0x8280412684c20890),
+  UINT64_C(0xa101137084c08111), UINT64_C(0x8220110010c12c14), UINT64_C(0x424650213d664082),
+  UINT64_C(0x41c80060032826a8), UINT64_C(0x25c0a08c4c003906), UINT64_C(0x9c30081410143807),
+  UINT64_C(0x41202081084cd08b), UINT64_C(0x588082120a02c141), UINT64_C(0x03101805514c240a),
+  UINT64_C(0x900b20b086010290), UINT64_C(0x409a54008a2a1104), UINT64_C(0x2041884ba0300954),
+  UINT64_C(0x141401480ba42020), UINT64_C(0x4922004a048844a0), UINT64_C(0x0061880441e08cc1),
+  UINT64_C(0x88208380128c1205), UINT64_C(0x3841401110144480), UINT64_C(0x05608019a209032d),
+  UINT64_C(0x40ae541080101300), UINT64_C(0xb3502a0cce2d420c), UINT64_C(0x009900064e158822),
+  UINT64_C(0x104139438d220c94), UINT64_C(0x0988b0040201501a), UINT64_C(0xc014ad1313118080),
+  UINT64_C(0x4032054800244421), UINT64_C(0x30a94004c8400467), UINT64_C(0xa20384aa14cc3030),
+  UINT64_C(0x2a94120c9008c509), UINT64_C(0x14e28241454449c1), UINT64_C(0x4460e0902402c004),
+  UINT64_C(0x281e1c028311416e), UINT64_C(0x0d880061900522c9), UINT64_C(0x3082148720182d26),
+  UINT64_C(0x2144828c80381901), UINT64_C(0x033403010044a130), UINT64_C(0x0d2aa075a4c25218),
+  UINT64_C(0xc7c0e90252a200c4), UINT64_C(0x68c28db0201408c4), UINT64_C(0x06d8da05c1202084),
+  UINT64_C(0x4101d20085881232), UINT64_C(0x30632a2a01b00186), UINT64_C(0x1082040e000bd130),
+  UINT64_C(0x08180055c180ca7c), UINT64_C(0x8030008f02001200), UINT64_C(0x4a8300c20223c428),
+  UINT64_C(0x64a0811010203009), UINT64_C(0x10474217c8429920), UINT64_C(0x0c00611400b88aa6),
+  UINT64_C(0x113116a8220c0041), UINT64_C(0x005b0134629a402c), UINT64_C(0x498528000460b881),
+  UINT64_C(0x9cc0358115000842), UINT64_C(0x000018800210668b), UINT64_C(0x624200d654582401),
+  UINT64_C(0x050240200c192096), UINT64_C(0xa308200b90104808), UINT64_C(0x0018005600040c09),
+  UINT64_C(0x8844200240844441), UINT64_C(0x808800018a108024), UINT64_C(0x00fa4a04511860c0),
+  UINT64_C(0x10cad204e0899440), UINT64_C(0x2b2162e801a48009), UINT64_C(0x200332490282800b),
+  UINT64_C(0x20028417063a8130), UINT64_C(0x9809680140880091), UINT64_C(0x4010150b052042a6),
+  UINT64_C(0x23460084981a0242), UINT64_C(0x4084c01c1d409a70), UINT64_C(0x810381ea81810a18),
+  UINT64_C(0x0a80202040c4a022), UINT64_C(0xc030221628124380), UINT64_C(0x80b95014622cb406),
+  UINT64_C(0x6402c40102242902), UINT64_C(0x61441850b1862140), UINT64_C(0x20820c05106b1467),
+  UINT64_C(0x0454237214510212), UINT64_C(0x90360142aa508438), UINT64_C(0x00382a040e205008),
+  UINT64_C(0x5c04510854054c8c), UINT64_C(0x144510c08c06e042), UINT64_C(0x0f4480c8620130e0),
+  UINT64_C(0x4002a08240920001), UINT64_C(0x2622402a42581026), UINT64_C(0x19210004428050d9),
+  UINT64_C(0x61882402ec045701), UINT64_C(0x80400210510d0613), UINT64_C(0x144508e0a6418906),
+  UINT64_C(0x809400c5c0ab0202), UINT64_C(0x20802818a43a1164), UINT64_C(0x9220051a0d001814),
+  UINT64_C(0xc20142ec04090d42), UINT64_C(0xf939804040969880), UINT64_C(0x94e0892a00400411),
+  UINT64_C(0x908e582a04020986), UINT64_C(0x0200d110c83b6200), UINT64_C(0x150420020900a005),
+  UINT64_C(0x0055063a0b610007), UINT64_C(0x3203330348c1a0c0), UINT64_C(0x0412a8048132cab0),
+  UINT64_C(0x0db5512012c41044), UINT64_C(0x800a2090132447b0), UINT64_C(0x040ac720c1204640),
+  UINT64_C(0x7120c608800a1c34), UINT64_C(0x8041038098c471a3), UINT64_C(0x32350369e4954101),
+  UINT64_C(0x0453305008960308), UINT64_C(0x5448c918402cc841), UINT64_C(0xa28014a01400a208),
+  UINT64_C(0xa0c6590029094268), UINT64_C(0x510e084420910432), UINT64_C(0x25018b0c0c418122),
+  UINT64_C(0x48a045090a0190d8), UINT64_C(0x0168100585a80230), UINT64_C(0x802c881030030a48),
+  UINT64_C(0x0848b10a00120504), UINT64_C(0xa2225421102a34c0), UINT64_C(0x44a0020580000065),
+  UINT64_C(0x284720a0013cc098), UINT64_C(0xc80400ec1c50008a), UINT64_C(0x68c0003042e8c900),
+  UINT64_C(0x14e040052422501c), UINT64_C(0x82901902a2440d7a), UINT64_C(0x0b204098720024a4),
+  UINT64_C(0x17082081dc41a341), UINT64_C(0x0524800a92203888), UINT64_C(0x109b6100625e0402),
+  UINT64_C(0x9808105001209d40), UINT64_C(0x4841211824c30052), UINT64_C(0x0082103189006448),
+  UINT64_C(0x62641c09080024cc), UINT64_C(0x0301048074410304), UINT64_C(0x0110810e05484800),
+  UINT64_C(0xaa2c5102160b5842), UINT64_C(0x3098820242308864), UINT64_C(0x000ca1200103dc48),
+  UINT64_C(0x004d4d48a1260a9c), UINT64_C(0x4410463090000723), UINT64_C(0x0005c810c4638d01),
+  UINT64_C(0x1054a07083502180), UINT64_C(0x8026040844048d40), UINT64_C(0x41c982100c0a1405),
+  UINT64_C(0x59d4121534a02407), UINT64_C(0x4288646008120b80), UINT64_C(0x8d285a6090350020),
+  UINT64_C(0x60a4260430102d11), UINT64_C(0x0620c2b059e0a182), UINT64_C(0x03202361180520b0),
+  UINT64_C(0x28408c2463144020), UINT64_C(0x801959064227800a), UINT64_C(0x408000300231608a),
+  UINT64_C(0x2c28c28161002041), UINT64_C(0x10882a9080520614), UINT64_C(0x3115481049084a95),
+  UINT64_C(0x231b10400888701a), UINT64_C(0x08830a0008461c01), UINT64_C(0x1200608a000026c1),
+  UINT64_C(0xce1d20ca01028330), UINT64_C(0x46a80a3491030244), UINT64_C(0x0049549e2d021061),
+  UINT64_C(0x2853844445a44820), UINT64_C(0x0182340c08806900), UINT64_C(0xd1230c0088040310),
+  UINT64_C(0xd0c0801316654200), UINT64_C(0xd80868011024c900), UINT64_C(0x4202008110b2208c),
+  UINT64_C(0x4406385828089026), UINT64_C(0x2802474600a08285), UINT64_C(0x4312526094480809),
+  UINT64_C(0x3ce08540023012c1), UINT64_C(0x8e106a2210404804), UINT64_C(0x8cc48142a452204c),
+  UINT64_C(0x0cc09a1160b86000), UINT64_C(0x74c3b24104121450), UINT64_C(0x2b2084e481542308),
+  UINT64_C(0x528130a042102082), UINT64_C(0x05111c202290978c), UINT64_C(0x405c0203020e8049),
+  UINT64_C(0x5080e10125408a40), UINT64_C(0x0408d45d08814441), UINT64_C(0x440c480ae1223430),
+  UINT64_C(0x12612d208e4c1094), UINT64_C(0x0088064306024180), UINT64_C(0x34021710c76a9014),
+  UINT64_C(0x9d20018051200882), UINT64_C(0x7840104807140090), UINT64_C(0x024246a5c18520c8),
+  UINT64_C(0x2104840c00ca9912), UINT64_C(0x044041800864101d), UINT64_C(0x5280300028c040a0),
+  UINT64_C(0x99010200e50211c9), UINT64_C(0x05d10816020e08c0), UINT64_C(0xc00a842097414e02),
+  UINT64_C(0x08841021212024c6), UINT64_C(0x10071854018a1803), UINT64_C(0x8444a9089e000814),
+  UINT64_C(0x280d1262420ce030), UINT64_C(0x0410052201500400), UINT64_C(0x122010af174a8810),
+  UINT64_C(0x2e5300138a204210), UINT64_C(0x0830098423844424), UINT64_C(0x000130d400c1b251),
+  UINT64_C(0x11710e8810882a25), UINT64_C(0xa8024000220b2101), UINT64_C(0x0c41890540180840),
+  UINT64_C(0x0095128000acc246), UINT64_C(0xcc4380000c00a606), UINT64_C(0x28e69861002c0186),
+  UINT64_C(0x04c0300211902013), UINT64_C(0x90024480d4496b9a), UINT64_C(0xa029300090978818),
+  UINT64_C(0x618011034b34c820), UINT64_C(0x581870a025287281), UINT64_C(0x1ad0e870a0152a00),
+  UINT64_C(0x8680471002040282), UINT64_C(0x168c000a50492845), UINT64_C(0x1023804001405b20),
+  UINT64_C(0x2108130146022812), UINT64_C(0x2198285144629589), UINT64_C(0x4a050a005408c440),
+  UINT64_C(0x1084c04399404124), UINT64_C(0xc408c92d802c4466), UINT64_C(0x2228809210822304),
+  UINT64_C(0x8f2405804001a208), UINT64_C(0x08814283420408b0), UINT64_C(0x8d409500a28200c4),
+  UINT64_C(0x1260891605010403), UINT64_C(0x128410990031097c), UINT64_C(0x610a12304080414a),
+  UINT64_C(0x006a00cf18000521), UINT64_C(0x240548260698009e), UINT64_C(0xe002440c780b842a),
+  UINT64_C(0x01402a0002028748), UINT64_C(0x42b02215234018cc), UINT64_C(0x0c15040a00270d98),
+  UINT64_C(0xed0c80a0b20a0008), UINT64_C(0x21011000a4080040), UINT64_C(0x8262024050245000),
+  UINT64_C(0x5982478068069060), UINT64_C(0x9188102182849214), UINT64_C(0xc82d101000067400),
+  UINT64_C(0x0680308296004602), UINT64_C(0x05f0888871081182), UINT64_C(0x6040c00424308600),
+  UINT64_C(0x3e30ca1044049bb5), UINT64_C(0x0900500578091008), UINT64_C(0x00402d06832a1451),
+  UINT64_C(0x5c09582454806400), UINT64_C(0x005f900015626400), UINT64_C(0x4130131009284204),
+  UINT64_C(0x00458a817c021214), UINT64_C(0x1112209ac0087098), UINT64_C(0x0800406422c06012),
+  UINT64_C(0x14891d00aa400e1c), UINT64_C(0x8380102030640408), UINT64_C(0x9c1ae55b3c0484e8),
+  UINT64_C(0x081c0010602c0600), UINT64_C(0x472d620118c30817), UINT64_C(0x0012aa0e15497023),
+  UINT64_C(0x80904122a0c6a129), UINT64_C(0x00208060092c0108), UINT64_C(0x0d611228150aca8c),
+  UINT64_C(0x1a1808f00d0007c4), UINT64_C(0x85000c9020b002e0), UINT64_C(0x16a2c404cc83a420),
+  UINT64_C(0x8210001a82014111), UINT64_C(0xc19446825ac16441), UINT64_C(0x805190140404c1a1),
+  UINT64_C(0x1561e01d40062008), UINT64_C(0x4099c02025002594), UINT64_C(0x2c0c022c4208106a),
+  UINT64_C(0x0400b81521728060), UINT64_C(0x084503da888c9811), UINT64_C(0x48a12463c0481122),
+  UINT64_C(0x5002011146a00884), UINT64_C(0x1464080401a0029c), UINT64_C(0xaaca015030000246),
+  UINT64_C(0x8412525c29352088), UINT64_C(0x0008e09c04090a52), UINT64_C(0x813524e001208081),
+  UINT64_C(0x8080508002404582), UINT64_C(0x980a0645c140c040), UINT64_C(0x0c0108210043a212),
+  UINT64_C(0x440c4cb00a264254), UINT64_C(0x4b0e90208b30428a), UINT64_C(0x130432922c982104),
+  UINT64_C(0x80042908c61141b0), UINT64_C(0x4103520080c45031), UINT64_C(0x3122130200b041c8),
+  UINT64_C(0x4e00809c6000c812), UINT64_C(0x605020688b268c08), UINT64_C(0x024a0d20e01b0300),
+  UINT64_C(0x16a3004800731162), UINT64_C(0x2511c99c80012083), UINT64_C(0x91002249a6020080),
+  UINT64_C(0x7901021109240424), UINT64_C(0x5a191a311429c84c), UINT64_C(0xe488090a36026126),
+  UINT64_C(0xa2b402509a8c4042), UINT64_C(0x6024640640021640), UINT64_C(0x9312633005848021),
+  UINT64_C(0x1a18060ee09208c8), UINT64_C(0xb0231c042d5401b0), UINT64_C(0x8230912643082004),
+  UINT64_C(0x0600c8412c150000), UINT64_C(0x09421010b9860689), UINT64_C(0x42c9280680782004),
+  UINT64_C(0x9102018089600810), UINT64_C(0x438021249a180802), UINT64_C(0xcd211024a0600100),
+  UINT64_C(0x8c10110472402059), UINT64_C(0x0012859a2944459a), UINT64_C(0x6e48c4049907000e),
+  UINT64_C(0x0062300a55d80c03), UINT64_C(0x04240b3801158184), UINT64_C(0x4206064c04158071),
+  UINT64_C(0x0ca8003202829450), UINT64_C(0x001430890601c449), UINT64_C(0x1e12208229010966),
+  UINT64_C(0xe104958d40a01080), UINT64_C(0x41000a5010388a02), UINT64_C(0x0602018450203028),
+  UINT64_C(0x113414a118010849), UINT64_C(0xa8000907007a0410), UINT64_C(0x8830228010c60810),
+  UINT64_C(0x80800c0882426480), UINT64_C(0x6560c1c0209f338b), UINT64_C(0x654124405d200d40),
+  UINT64_C(0x21600c1a40408282), UINT64_C(0x088904a642182061), UINT64_C(0x91b00164060a1304),
+  UINT64_C(0x4420722d20a48053), UINT64_C(0x0080000136500288), UINT64_C(0xc864009108090142),
+  UINT64_C(0x518902c108011040), UINT64_C(0xa1200a1402404114), UINT64_C(0x8217414004c250a8),
+  UINT64_C(0x0083060400da1900), UINT64_C(0x008d912a402802dd), UINT64_C(0x00129ca08251209c),
+  UINT64_C(0xc9400d04a8b8418c), UINT64_C(0x05c810022da02120), UINT64_C(0x0f0080309a141800),
+  UINT64_C(0x8206008e0c832139), UINT64_C(0x40003004002484b8), UINT64_C(0x9550802d0024a44e),
+  UINT64_C(0x0000a81214030e50), UINT64_C(0x0a34115432b40460), UINT64_C(0x60809ec101a11910),
+  UINT64_C(0x0100c0100108c107), UINT64_C(0x28021480864074ea), UINT64_C(0x80900841c0a04909),
+  UINT64_C(0x8309a9a17361c004), UINT64_C(0x0e41000a2c20c00a), UINT64_C(0x48ae031501000344),
+  UINT64_C(0x0302124845012c00), UINT64_C(0x213040920a982014), UINT64_C(0x4912230208d06ca3),
+  UINT64_C(0x840b001146109460), UINT64_C(0x1d848085040ef088), UINT64_C(0x00426001891029c8),
+  UINT64_C(0xa11c9c24590a014a), UINT64_C(0x01c8621151592010), UINT64_C(0x0371a4641630b820),
+  UINT64_C(0xa004600208d60021), UINT64_C(0x6810a442250400a0), UINT64_C(0x026c001021004081),
+  UINT64_C(0x1a8489b202460042), UINT64_C(0xe112059c400910c4), UINT64_C(0x1202941441400920),
+  UINT64_C(0x1430288482e008ba), UINT64_C(0x108044881208d140), UINT64_C(0x40d2000600304290),
+  UINT64_C(0x0819023203058e44), UINT64_C(0xb41008a19400c304), UINT64_C(0xc3925341301b0528),
+  UINT64_C(0x4080d48800002524), UINT64_C(0x1400016ad0e53b10), UINT64_C(0x48040580701114a9),
+  UINT64_C(0xa0283a0280580a04), UINT64_C(0x8a811802752b1045), UINT64_C(0x1841812120048068),
+  UINT64_C(0x04a4cc110a826405), UINT64_C(0x1267000a0102a524), UINT64_C(0x224608020691e3a3),
+  UINT64_C(0x20b801409c424030), UINT64_C(0x24620250a0009348), UINT64_C(0x0f20520801219010),
+  UINT64_C(0x8c10310284218522), UINT64_C(0x02300c45a1b81008), UINT64_C(0x10088804c88a0b01),
+  UINT64_C(0x8e04c4000470080a), UINT64_C(0x3891212884152842), UINT64_C(0xdd021b4066208005),
+  UINT64_C(0xd000908d01061418), UINT64_C(0x204205d20d008432), UINT64_C(0x044a04452a13218e),
+  UINT64_C(0x2029400508180206), UINT64_C(0x20028c804b61d820), UINT64_C(0x09144162848728d2),
+  UINT64_C(0x9c188861800402a0), UINT64_C(0x00c93b2054011012), UINT64_C(0x02021c018062a0ac),
+  UINT64_C(0x044019c8c0a25081), UINT64_C(0x20004e9980a08410), UINT64_C(0x802786fa9128e215),
+  UINT64_C(0x6802512558154811), UINT64_C(0x84c911642a020024), UINT64_C(0x01d800072442c814),
+  UINT64_C(0x880a05c019422644), UINT64_C(0x43041081a0286301), UINT64_C(0x3500029921020472),
+  UINT64_C(0x0332601055081a06), UINT64_C(0x02a11461144b8948), UINT64_C(0x40c1084063109044),
+  UINT64_C(0x40249212008e004a), UINT64_C(0x00403441802320a6), UINT64_C(0x801c0430e0890424),
+  UINT64_C(0x24c430866c922310), UINT64_C(0x0b01000c1c6c8904), UINT64_C(0x2120060a5890d058),
+  UINT64_C(0x8d30b002c840d840), UINT64_C(0x4808418c60213a40), UINT64_C(0x028148829a450ea2),
+  UINT64_C(0x04240c50520514c3), UINT64_C(0x1705a08000129b20), UINT64_C(0x880220e092ac9008),
+  UINT64_C(0x89850408de005039), UINT64_C(0xf010283005440da5), UINT64_C(0x00cc68ae03493890),
+  UINT64_C(0xe000a0eb00504614), UINT64_C(0x21889ec808944200), UINT64_C(0x4003d24014090060),
+  UINT64_C(0x3950021808adb084), UINT64_C(0x8318112c28000522), UINT64_C(0x80a0052560049001),
+  UINT64_C(0x00100a890228b240), UINT64_C(0x200001109d2009da), UINT64_C(0x0a1612550b2001a0),
+  UINT64_C(0x508c2840d5610226), UINT64_C(0x2206882489193086), UINT64_C(0x2a00028012188d18),
+  UINT64_C(0x04088c4241860400), UINT64_C(0x1e11339831e72403), UINT64_C(0x4c8520e0a0060a9e),
+  UINT64_C(0x46424280008c3060), UINT64_C(0x0603504c01b8a800), UINT64_C(0x0062041481585211),
+  UINT64_C(0x412142488a144158), UINT64_C(0x70f2a60300580141), UINT64_C(0x8198620323016a43),
+  UINT64_C(0x745581020200078c), UINT64_C(0x088cda1428a80029), UINT64_C(0x4200400f18a18134),
+  UINT64_C(0x092680be1144e020), UINT64_C(0xf03c4208024808f0), UINT64_C(0x61113320c6c04d01),
+  UINT64_C(0x10e992044181cc08), UINT64_C(0x120445110a018800), UINT64_C(0x04c00640202e0489),
+  UINT64_C(0x020c100a04080611), UINT64_C(0x0d004840528580b3), UINT64_C(0x822411a378180c80),
+  UINT64_C(0x089b0144a6081138), UINT64_C(0x5480138073020c18), UINT64_C(0xdc1440400022098a),
+  UINT64_C(0x0918444c410b1280), UINT64_C(0x406218148d083000), UINT64_C(0x8851c24c9491202d),
+  UINT64_C(0x5835122966987000), UINT64_C(0x10e22332450e4384), UINT64_C(0x906c8802440080c2),
+  UINT64_C(0x4c59050024000024), UINT64_C(0x060a00c0c1001202), UINT64_C(0x024e4a8098609407),
+  UINT64_C(0x2000261640b56085), UINT64_C(0x101c234ba0408141), UINT64_C(0x11800142c3988838),
+  UINT64_C(0xc108128820894205), UINT64_C(0x2201196023014462), UINT64_C(0x40b04c0cabb01044),
+  UINT64_C(0x24601e4010080001), UINT64_C(0x02010602d229c2b6), UINT64_C(0x698a246400454c4a),
+  UINT64_C(0x652214462cc28800), UINT64_C(0xc098c020040b8604), UINT64_C(0x8298b80101402230),
+  UINT64_C(0xc070006c11801220), UINT64_C(0x4108868300919a42), UINT64_C(0xa873e10008546112),
+  UINT64_C(0x00164000e05800aa), UINT64_C(0x09118040e424182d), UINT64_C(0x0100c9006020121b),
+  UINT64_C(0x328228298100044a), UINT64_C(0x4404118152800108), UINT64_C(0x116030c870e0a020),
+  UINT64_C(0x2415894a0c54400f), UINT64_C(0xab88110c005021d0), UINT64_C(0x14133426410e5008),
+  UINT64_C(0x0aece8294100044e), UINT64_C(0x8080083023514222), UINT64_C(0x2400052832185527),
+  UINT64_C(0x01826a50a140a051), UINT64_C(0x1861009054089102), UINT64_C(0xc0852205ce0841a0),
+  UINT64_C(0x44181c07a82043dd), UINT64_C(0x9121b80707e2e408), UINT64_C(0x2681800a82000c28),
+  UINT64_C(0x4910918161150088), UINT64_C(0x0364049421802600), UINT64_C(0x1f00802200e812b1),
+  UINT64_C(0x708220027e811440), UINT64_C(0x9068810480509504), UINT64_C(0x0a310b1003203092),
+  UINT64_C(0xa04ed1381a302c04), UINT64_C(0x818a82110a0070c1), UINT64_C(0x62001086c1002400),
+  UINT64_C(0x2202808c1e00008a), UINT64_C(0xe808100114920033), UINT64_C(0x482203002a924119),
+  UINT64_C(0x440812ac140410d8), UINT64_C(0x524905b292222420), UINT64_C(0xeb121500b9166201),
+  UINT64_C(0x3428441d24032820), UINT64_C(0x1a012054868042a8), UINT64_C(0x000851cb20104c41),
+  UINT64_C(0x19180831420487c0), UINT64_C(0xc1512aa24084600e), UINT64_C(0x101d80002f210200),
+  UINT64_C(0x0e0e481530920304), UINT64_C(0x5224580808830650), UINT64_C(0x0b420102c0488223),
+  UINT64_C(0x4020218118103c90), UINT64_C(0x00a022004d1e4925), UINT64_C(0x124dd22315a11002),
+  UINT64_C(0x300039602422aac0), UINT64_C(0x0108d30010160102), UINT64_C(0x2028140c99000661),
+  UINT64_C(0x34000124c24cc024), UINT64_C(0xd3a1112300524990), UINT64_C(0xa5612b11a8041c20),
+  UINT64_C(0xcc20098201402c08), UINT64_C(0x1a57c06125410610), UINT64_C(0x09800a14820c0282),
+  UINT64_C(0x05422002d1801340), UINT64_C(0xa832c42080384022), UINT64_C(0x002501c4404508aa),
+  UINT64_C(0xc80200408318020d), UINT64_C(0x887888a640090452), UINT64_C(0xe2c9014034440246),
+  UINT64_C(0x42000480100a3000), UINT64_C(0x2286008208031801), UINT64_C(0x0d04498c1a514810),
+  UINT64_C(0x9330140d848088ca), UINT64_C(0xd4008a07e0340491), UINT64_C(0x12804810570d0a00),
+  UINT64_C(0x8e05947835460020), UINT64_C(0x4e0206014309706a), UINT64_C(0x00010641b5128005),
+  UINT64_C(0x083080c018610081), UINT64_C(0x0a1c454080dcc92b), UINT64_C(0x411a884024d88410),
+  UINT64_C(0x4f4d10a300c10016), UINT64_C(0x0808841134168020), UINT64_C(0x86248129808b0402),
+  UINT64_C(0x42a1281078c13430), UINT64_C(0x1002862408005385), UINT64_C(0x3811060c70082040),
+  UINT64_C(0x4983b86404241344), UINT64_C(0x8184609000821cd3), UINT64_C(0x685b10009a426010),
+  UINT64_C(0x800641a0a02c20c0), UINT64_C(0x2244200005601a14), UINT64_C(0x05520b028001592c),
+  UINT64_C(0x6a00070c08840d08), UINT64_C(0x8428912461024281), UINT64_C(0x08f10121400c0e58),
+  UINT64_C(0x044090a001530076), UINT64_C(0x88c20578d0205429), UINT64_C(0x230402002ca80103),
+  UINT64_C(0x084448c0983c8a00), UINT64_C(0x1a0100e188501040), UINT64_C(0x89820c00250c0360),
+  UINT64_C(0x8380012850602000), UINT64_C(0xe214b0da12104062), UINT64_C(0x0a844880000144e1),
+  UINT64_C(0x1008c40284601813), UINT64_C(0xa305ad3a1888009a), UINT64_C(0xd0a8020012135012),
+  UINT64_C(0x144b1644c6201cc9), UINT64_C(0x05b4118802c18004), UINT64_C(0x9405410a02062418),
+  UINT64_C(0x803082a09011306c), UINT64_C(0x100746022c00a673), UINT64_C(0x007008424810b106),
+  UINT64_C(0x421020658006592a), UINT64_C(0x0488024207009150), UINT64_C(0x4000b2ad008e1401),
+  UINT64_C(0xa251200081420496), UINT64_C(0xec208428411f0122), UINT64_C(0x02421618317a0005),
+  UINT64_C(0x0945ca5401902230), UINT64_C(0x41a811a32c005c89), UINT64_C(0x014020540c501140),
+  UINT64_C(0x0280311360c0cadd), UINT64_C(0x640e15808621a502), UINT64_C(0x0cce0840980c0360),
+  UINT64_C(0x44a488065c612840), UINT64_C(0x0c004250c0205802), UINT64_C(0x0014034710098400),
+  UINT64_C(0x70c3100005180cf0), UINT64_C(0x8819410141005804), UINT64_C(0x0c45099000028b18),
+  UINT64_C(0x4948868061122108), UINT64_C(0x022f168150182117), UINT64_C(0x1812609258004095),
+  UINT64_C(0xa2006488a6c33800), UINT64_C(0x04e1395282600e10), UINT64_C(0x1084801c30005c00),
+  UINT64_C(0x5009000124030b20), UINT64_C(0x0000000000000006)
+};
+
+/// prefixSums[i] = number of 1 bits within bitmap[0, i[
+const uint32_t prefixSums[WORDS] =
+{
+  0, 50, 89, 125, 159, 194, 225, 260,
+  290, 323, 354, 379, 414, 442, 471, 500,
+  529, 559, 587, 615, 644, 672, 698, 727,
+  754, 780, 808, 838, 864, 891, 916, 939,
+  971, 997, 1021, 1048, 1073, 1103, 1127, 1155,
+  1182, 1211, 1234, 1263, 1286, 1312, 1334, 1361,
+  1386, 1406, 1435, 1460, 1486, 1516, 1540, 1567,
+  1590, 1613, 1643, 1664, 1684, 1712, 1740, 1763,
+  1792, 1816, 1844, 1868, 1890, 1914, 1936, 1963,
+  1983, 2013, 2036, 2061, 2087, 2114, 2134, 2153,
+  2173, 2201, 2224, 2249, 2278, 2302, 2324, 2345,
+  2371, 2394, 2423, 2447, 2472, 2497, 2518, 2544,
+  2569, 2592, 2611, 2640, 2666, 2694, 2714, 2733,
+  2754, 2778, 2801, 2826, 2848, 2872, 2897, 2918,
+  2946, 2971, 2989, 3009, 3037, 3060, 3082, 3104,
+  3133, 3156, 3178, 3201, 3224, 3242, 3267, 3287,
+  3311, 3334, 3359, 3382, 3404, 3424, 3447, 3474,
+  3500, 3521, 3548, 3571, 3596, 3621, 3641, 3665,
+  3689, 3712, 3731, 3756, 3778, 3797, 3821, 3843,
+  3865, 3891, 3917, 3939, 3960, 3987, 4006, 4024,
+  4049, 4067, 4093, 4116, 4140, 4161, 4185, 4206,
+  4228, 4249, 4268, 4292, 4320, 4340, 4364, 4389,
+  4414, 4441, 4464, 4488, 4508, 4526, 4548, 4566,
+  4593, 4615, 4637, 4660, 4680, 4704, 4724, 4746,
+  4764, 4787, 4808, 4831, 4850, 4871, 4896, 4920,
+  4943, 4962, 4984, 5005, 5029, 5055, 5077, 5100,
+  5122, 5149, 5169, 5189, 5208, 5227, 5252, 5278,
+  5301, 5324, 5346, 5364, 5385, 5407, 5433, 5451,
+  5474, 5498, 5515, 5539, 5565, 5584, 5604, 5626,
+  5648, 5673, 5694, 5715, 5740, 5763, 5789, 5813,
+  5833, 5857, 5879, 5902, 5923, 5945, 5965, 5992,
+  6015, 6038, 6054, 6076, 6095, 6117, 6142, 6157,
+  6177, 6204, 6220, 6245, 6264, 6286, 6305, 6326,
+  6346, 6372, 6400, 6418, 6437, 6452, 6474, 6495,
+  6518, 6539, 6567, 6588, 6607, 6625, 6647, 6670,
+  6692, 6715, 6738, 6760, 6783, 6799, 6820, 6841,
+  6861, 6881, 6902, 6920, 6941, 6967, 6987, 7007,
+  7033, 7053, 7080, 7100, 7125, 7147, 7167, 7189,
+  7212, 7231, 7249, 7273, 7292, 7313, 7336, 7358,
+  7381, 7399, 7422, 7444, 7468, 7487, 7507, 7529,
+  7548, 7569, 7591, 7613, 7641, 7659, 7681, 7697,
+  7720, 7740, 7760, 7783, 7802, 7826, 7845, 7868,
+  7887, 7912, 7938, 7959, 7977, 7999, 8025, 8046,
+  8068, 8090, 8106, 8129, 8149, 8169, 8187, 8210,
+  8233, 8253, 8270, 8293, 8313, 8336, 8355, 8373,
+  8400, 8420, 8438, 8458, 8479, 8502, 8526, 8547,
+  8561, 8577, 8597, 8621, 8644, 8666, 8687, 8711,
+  8737, 8757, 8777, 8795, 8818, 8839, 8857, 8876,
+  8896, 8924, 8944, 8971, 8991, 9014, 9036, 9050,
+  9074, 9093, 9118, 9137, 9158, 9184, 9204, 9226,
+  9250, 9268, 9289, 9306, 9329, 9350, 9368, 9389,
+  9408, 9426, 9445, 9468, 9487, 9513, 9532, 9553,
+  9577, 9595, 9613, 9638, 9655, 9673, 9697, 9719,
+  9742, 9764, 9790, 9809, 9831, 9848, 9866, 9883,
+  9904, 9921, 9946, 9967, 9985, 10011, 10028, 10049,
+  10071, 10089, 10107, 10132, 10153, 10178, 10197, 10219,
+  10233, 10251, 10271, 10295, 10314, 10332, 10359, 10381,
+  10401, 10424, 10446, 10461, 10476, 10502, 10520, 10543,
+  10562, 10581, 10603, 10622, 10647, 10663, 10682, 10705,
+  10731, 10749, 10766, 10787, 10808, 10825, 10846, 10865,
+  10886, 10906, 10926, 10955, 10973, 10992, 11010, 11030,
+  11052, 11073, 11092, 11117, 11139, 11156, 11174, 11196,
+  11214, 11235, 11251, 11275, 11298, 11319, 11336, 11358,
+  11384, 11404, 11426, 11449, 11464, 11488, 11512, 11531,
+  11551, 11571, 11587, 11613, 11635, 11651, 11674, 11695,
+  11718, 11734, 11755, 11775, 11798, 11816, 11840, 11858,
+  11878, 11896, 11911, 11932, 11956, 11979, 11995, 12018,
+  12040, 12061, 12085, 12104, 12128, 12145, 12165, 12184,
+  12208, 12227, 12245, 12262, 12285, 12304, 12325, 12342,
+  12362, 12388, 12408, 12429, 12450, 12468, 12486, 12506,
+  12531, 12546, 12564, 12584, 12605, 12629, 12651, 12669,
+  12689, 12719, 12738, 12759, 12779, 12801, 12818, 12838,
+  12859, 12880, 12901, 12921, 12937, 12959, 12978, 12999,
+  13016, 13038, 13062, 13085, 13103, 13125, 13142, 13168,
+  13189, 13208, 13226, 13246, 13263, 13281, 13301, 13321,
+  13340, 13356, 13378, 13396, 13416, 13434, 13453, 13477,
+  13496, 13519, 13540, 13558, 13577, 13597, 13620, 13639,
+  13662, 13677, 13695, 13716, 13736, 13758, 13782, 13806,
+  13825, 13846, 13869, 13887, 13906, 13926, 13947, 13968,
+  13994, 14016, 14034, 14053, 14076, 14097, 14117, 14134,
+  14156, 14172, 14194, 14215, 14231, 14254, 14273, 14292,
+  14313, 14338, 14354, 14373, 14388, 14411, 14427, 14448,
+  14475, 14494, 14513, 14530, 14549, 14570, 14588, 14604,
+  14624, 14645, 14670, 14689, 14707, 14724, 14749, 14769,
+  14788, 14806, 14828, 14849, 14862, 14880, 14904, 14926,
+  14947, 14966, 14986, 15005, 15025, 15047, 15067, 15084,
+  15100, 15117, 15141, 15160, 15177, 15195, 15210, 15233,
+  15257, 15280, 15300, 15317, 15334, 15351, 15370, 15388,
+  15405, 15425, 15445, 15466, 15487, 15506, 15533, 15551,
+  15574, 15592, 15609, 15628, 15651, 15670, 15692, 15712,
+  15735, 15754, 15773, 15787, 15809, 15830, 15851, 15872,
+  15891, 15911, 15924, 15941, 15958, 15980, 16004, 16028,
+  16054, 16072, 16092, 16109, 16127, 16143, 16162, 16182,
+  16204, 16224, 16249, 16269, 16291, 16315, 16340, 16357,
+  16378, 16395, 16410, 16426, 16444, 16460, 16482, 16507,
+  16525, 16549, 16568, 16589, 16607, 16632, 16647, 16668,
+  16688, 16705, 16725, 16744, 16766, 16784, 16810, 16833,
+  16856, 16876, 16893, 16912, 16935, 16957, 16975, 16993,
+  17008, 17028, 17046, 17069, 17086, 17107, 17131, 17150,
+  17171, 17188, 17203, 17227, 17246, 17265, 17284, 17305,
+  17323, 17345, 17364, 17385, 17408, 17430, 17447, 17467,
+  17489, 17510, 17523, 17537, 17561, 17581, 17604, 17622,
+  17639, 17662, 17681, 17698, 17717, 17735, 17757, 17777,
+  17798, 17818, 17837, 17860, 17879, 17900, 17916, 17934,
+  17954, 17976, 17994, 18016, 18031, 18048, 18068, 18085,
+  18105, 18130, 18152, 18168, 18185, 18206, 18227, 18241,
+  18263, 18279, 18301, 18318, 18339, 18357, 18375, 18396,
+  18417, 18440, 18452, 18474, 18499, 18521, 18533, 18554,
+  18574, 18600, 18619, 18639, 18660, 18683, 18701, 18719,
+  18739, 18760, 18781, 18804, 18828, 18849, 18866, 18887,
+  18905, 18927, 18946, 18966, 18984, 18998, 19017, 19034,
+  19052, 19077, 19093, 19110, 19134, 19152, 19174, 19195,
+  19210, 19228, 19250, 19264, 19284, 19302, 19318, 19336,
+  19357, 19375, 19401, 19417, 19435, 19455, 19469, 19493,
+  19514, 19537, 19552, 19572, 19598, 19621, 19635, 19657,
+  19675, 19694, 19717, 19734, 19756, 19773, 19794, 19813,
+  19830, 19850, 19868, 19896, 19913, 19930, 19948, 19969,
+  19989, 20006, 20026, 20049, 20068, 20089, 20106, 20125,
+  20144, 20164, 20179, 20201, 20221, 20245, 20257, 20275,
+  20298, 20318, 20344, 20361, 20382, 20403, 20427, 20449,
+  20473, 20488, 20509, 20528, 20545, 20567, 20585, 20604,
+  20618, 20637, 20656, 20673, 20691, 20709, 20728, 20743,
+  20765, 20784, 20803, 20826, 20847, 20861, 20881, 20898,
+  20915, 20932, 20949, 20970, 20988, 21010, 21021, 21038,
+  21060, 21084, 21104, 21123, 21142, 21160, 21178, 21199,
+  21218, 21239, 21257, 21275, 21296, 21314, 21336, 21358,
+  21381, 21400, 21417, 21439, 21458, 21474, 21490, 21513,
+  21531, 21547, 21569, 21593, 21615, 21634, 21651, 21670,
+  21692, 21710, 21729, 21746, 21768, 21792, 21806, 21826,
+  21844, 21866, 21888, 21909, 21931, 21953, 21969, 21987,
+  22011, 22027, 22051, 22064, 22076, 22095, 22114, 22140,
+  22162, 22180, 22201, 22219, 22240, 22254, 22275, 22289,
+  22307, 22330, 22352, 22372, 22388, 22401, 22423, 22447,
+  22468, 22487, 22506, 22529, 22547, 22564, 22582, 22596,
+  22615, 22638, 22653, 22672, 22692, 22712, 22737, 22753,
+  22773, 22789, 22810, 22827, 22844, 22861, 22882, 22902,
+  22922, 22937, 22957, 22975, 22990, 23011, 23031, 23051,
+  23065, 23088, 23108, 23127, 23147, 23167, 23184, 23199,
+  23224, 23243, 23262, 23280, 23302, 23325, 23342, 23357,
+  23377, 23396, 23418, 23446, 23473, 23492, 23508, 23522,
+  23540, 23565, 23586, 23605, 23625, 23640, 23661, 23680,
+  23703, 23721, 23739, 23757, 23776, 23796, 23811, 23839,
+  23856, 23872, 23895, 23914, 23925, 23942, 23961, 23983,
+  23997, 24015, 24038, 24057, 24078, 24098, 24118, 24139,
+  24159, 24178, 24200, 24215, 24234, 24252, 24272, 24288,
+  24306, 24328, 24349, 24365, 24381, 24400, 24418, 24436,
+  24456, 24474, 24495, 24518, 24537, 24552, 24577, 24602,
+  24620, 24639, 24658, 24675, 24697, 24707, 24727, 24745,
+  24766, 24784, 24806, 24833, 24851, 24867, 24885, 24909,
+  24925, 24934, 24958, 24979, 24989, 25014, 25029, 25043,
+  25059, 25076, 25095, 25113, 25131, 25159, 25179, 25196,
+  25214, 25237, 25254, 25276, 25297, 25316, 25334, 25353,
+  25370, 25389, 25406, 25426, 25446, 25461, 25482, 25497,
+  25513, 25529, 25550, 25573, 25586, 25609, 25628, 25648,
+  25658, 25681, 25700, 25718, 25737, 25760, 25779, 25792,
+  25811, 25831, 25849, 25868, 25883, 25905, 25920, 25937,
+  25959, 25977, 25994, 26013, 26031, 26053, 26075, 26094,
+  26113, 26135, 26153, 26167, 26184, 26203, 26221, 26246,
+  26264, 26287, 26308, 26328, 26344, 26370, 26387, 26411,
+  26428, 26451, 26470, 26486, 26504, 26526, 26544, 26567,
+  26586, 26605, 26623, 26639, 26656, 26671, 26693, 26707,
+  26730, 26749, 26771, 26787, 26803, 26821, 26841, 26861,
+  26881, 26894, 26910, 26932, 26945, 26968, 26989, 27009,
+  27027, 27045, 27066, 27087, 27106, 27129, 27149, 27169,
+  27185, 27203, 27217, 27241, 27258, 27277, 27298, 27315,
+  27338, 27358, 27377, 27396, 27417, 27439, 27456, 27479,
+  27497, 27518, 27538, 27559, 27579, 27598, 27623, 27642,
+  27658, 27677, 27694, 27715, 27733, 27754, 27774, 27791,
+  27810, 27830, 27848, 27865, 27883, 27900, 27916, 27937,
+  27957, 27977, 27998, 28021, 28038, 28058, 28081, 28103,
+  28114, 28134, 28152, 28169, 28190, 28214, 28234, 28254,
+  28270, 28288, 28306, 28322, 28343, 28361, 28383, 28401,
+  28423, 28442, 28461, 28479, 28495, 28516, 28536, 28556,
+  28575, 28592, 28612, 28626, 28646, 28665, 28686, 28706,
+  28722, 28738, 28760, 28781, 28797, 28819, 28835, 28854,
+  28870, 28891, 28905, 28929, 28950, 28967, 28988, 29008,
+  29029, 29043, 29069, 29087, 29105, 29119, 29137, 29150,
+  29173, 29189, 29205, 29222, 29244, 29266, 29283, 29303,
+  29321, 29340, 29361, 29382, 29398, 29415, 29432, 29454,
+  29474, 29491, 29506, 29532, 29547, 29566, 29586, 29600,
+  29619, 29642, 29658, 29678, 29704, 29721, 29736, 29760,
+  29775, 29793, 29816, 29833, 29855, 29871, 29890, 29908,
+  29929, 29945, 29966, 29985, 29998, 30017, 30038, 30061,
+  30081, 30099, 30117, 30137, 30154, 30179, 30194, 30213,
+  30231, 30249, 30268, 30288, 30307, 30335, 30350, 30369,
+  30393, 30407, 30429, 30447, 30464, 30479, 30495, 30508,
+  30528, 30548, 30565, 30592, 30605, 30625, 30641, 30664,
+  30687, 30705, 30725, 30744, 30754, 30772, 30788, 30799,
+  30818, 30832, 30855, 30875, 30894, 30915, 30937, 30952,
+  30966, 30986, 31005, 31030, 31048, 31066, 31084, 31104,
+  31123, 31142, 31159, 31182, 31201, 31216, 31239, 31261,
+  31277, 31296, 31317, 31335, 31355, 31377, 31394, 31411,
+  31428, 31446, 31461, 31480, 31490, 31507, 31527, 31542,
+  31562, 31579, 31591, 31612, 31633, 31646, 31665, 31682,
+  31704, 31721, 31743, 31762, 31780, 31798, 31811, 31835,
+  31853, 31866, 31889, 31915, 31935, 31957, 31976, 31994,
+  32010, 32025, 32048, 32068, 32084, 32102, 32122, 32137,
+  32157, 32172, 32192, 32211, 32233, 32251, 32270, 32290,
+  32306, 32327, 32344, 32361, 32379, 32395, 32417, 32435,
+  32452, 32465, 32482, 32504, 32523, 32542, 32558, 32579,
+  32601, 32619, 32641, 32659, 32677, 32697, 32715, 32736,
+  32752, 32774, 32794, 32813, 32827, 32845, 32863, 32877,
+  32895, 32910, 32932, 32948, 32965, 32985, 33004, 33020,
+  33042, 33065, 33084, 33106, 33122, 33142, 33162, 33183,
+  33197, 33219, 33239, 33263, 33280, 33300, 33323, 33342,
+  33364, 33382, 33403, 33419, 33435, 33455, 33475, 33496,
+  33514, 33531, 33545, 33563, 33582, 33604, 33616, 33633,
+  33653, 33670, 33689, 33710, 33730, 33752, 33767, 33786,
+  33804, 33826, 33844, 33863, 33884, 33897, 33914, 33930,
+  33947, 33964, 33979, 33998, 34016, 34034, 34052, 34073,
+  34090, 34108, 34125, 34142, 34161, 34182, 34199, 34212,
+  34229, 34248, 34266, 34288, 34307, 34321, 34341, 34357,
+  34370, 34389, 34410, 34429, 34450, 34470, 34490, 34509,
+  34526, 34543, 34563, 34579, 34603, 34621, 34642, 34660,
+  34678, 34697, 34714, 34733, 34757, 34776, 34797, 34810,
+  34827, 34842, 34865, 34875, 34894, 34908, 34930, 34951,
+  34974, 34995, 35017, 35029, 35051, 35068, 35088, 35105,
+  35127, 35140, 35154, 35174, 35194, 35214, 35236, 35253,
+  35272, 35291, 35312, 35330, 35350, 35370, 35388, 35401,
+  35426, 35440, 35459, 35480, 35496, 35513, 35531, 35551,
+  35570, 35585, 35604, 35625, 35646, 35667, 35683, 35702,
+  35724, 35741, 35758, 35779, 35797, 35818, 35829, 35850,
+  35866, 35880, 35896, 35918, 35935, 35958, 35973, 35990,
+  36013, 36029, 36047, 36066, 36077, 36097, 36122, 36141,
+  36166, 36179, 36194, 36215, 36238, 36258, 36276, 36293,
+  36315, 36337, 36358, 36377, 36395, 36415, 36438, 36457,
+  36473, 36489, 36512, 36529, 36551, 36569, 36591, 36612,
+  36631, 36650, 36669, 36686, 36703, 36720, 36739, 36756,
+  36774, 36789, 36803, 36821, 36841, 36859, 36875, 36891,
+  36909, 36932, 36947, 36970, 36988, 37007, 37029, 37047,
+  37062, 37081, 37098, 37119, 37136, 37156, 37178, 37203,
+  37221, 37242, 37263, 37281, 37301, 37321, 37341, 37360,
+  37372, 37390, 37407, 37422, 37443, 37457, 37471, 37489,
+  37508, 37524, 37543, 37560, 37579, 37591, 37606, 37625,
+  37647, 37665, 37685, 37704, 37725, 37748, 37767, 37792,
+  37809, 37826, 37844, 37865, 37882, 37898, 37914, 37929,
+  37940, 37961, 37975, 37993, 38014, 38031, 38048, 38064,
+  38083, 38101, 38124, 38144, 38162, 38179, 38193, 38216,
+  38233, 38253, 38275, 38293, 38308, 38322, 38340, 38357,
+  38373, 38397, 38415, 38430, 38448, 38462, 38480, 38495,
+  38513, 38535, 38552, 38572, 38587, 38601, 38617, 38634,
+  38657, 38674, 38683, 38704, 38725, 38747, 38766, 38785,
+  38804, 38824, 38850, 38870, 38884, 38902, 38920, 38937,
+  38952, 38970, 38984, 39000, 39020, 39045, 39064, 39086,
+  39101, 39126, 39145, 39159, 39180, 39195, 39215, 39232,
+  39253, 39277, 39296, 39314, 39333, 39351, 39372, 39391,
+  39411, 39428, 39445, 39461, 39477, 39500, 39517, 39536,
+  39556, 39573, 39593, 39614, 39629, 39653, 39671, 39696,
+  39717, 39733, 39751, 39769, 39786, 39801, 39817, 39835,
+  39851, 39870, 39890, 39911, 39935, 39950, 39969, 39983,
+  40002, 40023, 40042, 40059, 40076, 40101, 40117, 40134,
+  40154, 40169, 40189, 40209, 40232, 40244, 40263, 40282,
+  40304, 40320, 40338, 40355, 40372, 40382, 40398, 40414,
+  40429, 40442, 40461, 40481, 40505, 40521, 40539, 40557,
+  40576, 40597, 40614, 40640, 40658, 40677, 40694, 40712,
+  40730, 40749, 40769, 40790, 40807, 40824, 40844, 40860,
+  40880, 40900, 40917, 40931, 40948, 40968, 40982, 41005,
+  41024, 41040, 41059, 41079, 41098, 41116, 41138, 41155,
+  41176, 41197, 41221, 41240, 41255, 41272, 41285, 41304,
+  41323, 41343, 41363, 41382, 41396, 41413, 41431, 41451,
+  41473, 41490, 41512, 41529, 41546, 41568, 41585, 41603,
+  41625, 41646, 41661, 41679, 41696, 41711, 41726, 41743,
+  41758, 41773, 41792, 41809, 41832, 41849, 41868, 41884,
+  41903, 41927, 41946, 41968, 41985, 41998, 42017, 42037,
+  42055, 42075, 42092, 42108, 42127, 42143, 42161, 42180,
+  42195, 42215, 42230, 42247, 42270, 42288, 42310, 42328,
+  42344, 42359, 42379, 42398, 42419, 42436, 42451, 42462,
+  42483, 42501, 42525, 42544, 42560, 42580, 42599, 42618,
+  42636, 42655, 42671, 42684, 42698, 42717, 42736, 42755,
+  42777, 42800, 42817, 42836, 42858, 42882, 42897, 42918,
+  42935, 42952, 42973, 42991, 43008, 43028, 43045, 43065,
+  43079, 43098, 43117, 43136, 43154, 43174, 43194, 43214,
+  43234, 43252, 43271, 43292, 43303, 43318, 43341, 43356,
+  43374, 43395, 43408, 43424, 43445, 43465, 43487, 43505,
+  43526, 43545, 43562, 43586, 43602, 43623, 43640, 43657,
+  43675, 43691, 43707, 43725, 43740, 43762, 43781, 43797,
+  43812, 43833, 43856, 43873, 43895, 43910, 43930, 43941,
+  43958, 43976, 43994, 44016, 44037, 44053, 44073, 44088,
+  44103, 44123, 44144, 44159, 44179, 44194, 44209, 44224,
+  44243, 44258, 44279, 44299, 44320, 44342, 44364, 44382,
+  44394, 44411, 44426, 44447, 44466, 44486, 44501, 44521,
+  44539, 44556, 44569, 44586, 44605, 44626, 44641, 44656,
+  44674, 44695, 44712, 44736, 44752, 44770, 44786, 44803,
+  44830, 44843, 44864, 44884, 44900, 44914, 44930, 44949,
+  44966, 44979, 44999, 45016, 45037, 45053, 45072, 45086,
+  45100, 45120, 45143, 45161, 45175, 45192, 45212, 45233,
+  45252, 45270, 45289, 45310, 45326, 45344, 45361, 45381,
+  45402, 45419, 45435, 45456, 45474, 45492, 45507, 45523,
+  45541, 45562, 45577, 45600, 45619, 45635, 45652, 45669,
+  45691, 45712, 45727, 45740, 45755, 45770, 45789, 45805,
+  45831, 45855, 45868, 45884, 45904, 45918, 45937, 45953,
+  45972, 45989, 46005, 46022, 46046, 46065, 46085, 46107,
+  46127, 46146, 46167, 46180, 46194, 46206, 46220, 46238,
+  46258, 46283, 46304, 46320, 46337, 46349, 46366, 46385,
+  46409, 46425, 46438, 46456, 46479, 46502, 46517, 46532,
+  46546, 46566, 46585, 46603, 46613, 46631, 46650, 46670,
+  46691, 46706, 46721, 46739, 46764, 46776, 46796, 46817,
+  46840, 46855, 46880, 46899, 46916, 46933, 46947, 46969,
+  46986, 47004, 47027, 47049, 47065, 47080, 47100, 47116,
+  47136, 47154, 47170, 47189, 47203, 47224, 47239, 47260,
+  47278, 47299, 47315, 47338, 47353, 47372, 47388, 47409,
+  47426, 47441, 47460, 47481, 47502, 47517, 47532, 47553,
+  47572, 47590, 47604, 47622, 47642, 47660, 47680, 47700,
+  47719, 47737, 47757, 47771, 47787, 47807, 47825, 47845,
+  47866, 47883, 47898, 47913, 47930, 47950, 47974, 47988,
+  48007, 48025, 48047, 48064, 48081, 48101, 48123, 48145,
+  48163, 48187, 48207, 48228, 48243, 48260, 48279, 48293,
+  48310, 48327, 48345, 48362, 48381, 48394, 48411, 48427,
+  48443, 48460, 48477, 48492, 48510, 48531, 48551, 48569,
+  48591, 48613, 48628, 48643, 48661, 48681, 48700, 48719,
+  48742, 48762, 48775, 48788, 48813, 48830, 48846, 48867,
+  48882, 48899, 48921, 48940, 48955, 48971, 48988, 49006,
+  49026, 49040, 49059, 49078, 49095, 49111, 49134, 49150,
+  49168, 49186, 49207, 49219, 49239, 49259, 49280, 49298,
+  49317, 49335, 49349, 49366, 49385, 49411, 49423, 49440,
+  49460, 49480, 49498, 49514, 49531, 49550, 49568, 49582,
+  49600, 49619, 49644, 49663, 49675, 49692, 49712, 49731,
+  49748, 49767, 49786, 49807, 49829, 49846, 49861, 49875,
+  49892, 49913, 49934, 49950, 49965, 49981, 50002, 50025,
+  50042, 50056, 50075, 50093, 50113, 50135, 50151, 50168,
+  50182, 50200, 50221, 50236, 50251, 50272, 50294, 50309,
+  50332, 50354, 50373, 50391, 50412, 50433, 50452, 50469,
+  50482, 50502, 50520, 50532, 50553, 50568, 50584, 50604,
+  50618, 50640, 50658, 50677, 50696, 50713, 50726, 50746,
+  50763, 50782, 50800, 50818, 50835, 50847, 50865, 50886,
+  50905, 50925, 50943, 50962, 50979, 50998, 51013, 51032,
+  51046, 51061, 51079, 51095, 51113, 51132, 51149, 51163,
+  51183, 51199, 51217, 51232, 51250, 51268, 51280, 51297,
+  51316, 51338, 51354, 51368, 51387, 51403, 51418, 51435,
+  51459, 51479, 51499, 51522, 51537, 51554, 51570, 51586,
+  51605, 51623, 51638, 51661, 51678, 51699, 51718, 51732,
+  51756, 51772, 51793, 51809, 51828, 51844, 51863, 51879,
+  51898, 51917, 51937, 51951, 51964, 51979, 51991, 52006,
+  52025, 52043, 52060, 52080, 52101, 52113, 52131, 52148,
+  52166, 52185, 52198, 52219, 52239, 52250, 52264, 52284,
+  52303, 52316, 52335, 52351, 52374, 52393, 52412, 52435,
+  52455, 52466, 52488, 52507, 52524, 52545, 52559, 52573,
+  52595, 52612, 52632, 52654, 52671, 52693, 52712, 52726,
+  52742, 52760, 52776, 52800, 52824, 52835, 52851, 52868,
+  52882, 52898, 52920, 52932, 52952, 52969, 52986, 53007,
+  53029, 53049, 53064, 53077, 53098, 53118, 53140, 53153,
+  53173, 53193, 53209, 53230, 53250, 53264, 53278, 53296,
+  53311, 53330, 53350, 53366, 53385, 53400, 53415, 53436,
+  53452, 53469, 53490, 53507, 53523, 53545, 53562, 53583,
+  53599, 53620, 53642, 53662, 53677, 53693, 53707, 53726,
+  53744, 53760, 53778, 53796, 53815, 53835, 53849, 53870,
+  53889, 53906, 53932, 53946, 53969, 53985, 54003, 54019,
+  54040, 54053, 54071, 54089, 54104, 54123, 54141, 54161,
+  54178, 54187, 54205, 54224, 54241, 54256, 54272, 54290,
+  54312, 54331, 54350, 54367, 54385, 54403, 54421, 54437,
+  54457, 54480, 54495, 54508, 54530, 54549, 54570, 54593,
+  54605, 54621, 54638, 54649, 54676, 54691, 54712, 54730,
+  54746, 54767, 54782, 54797, 54813, 54836, 54851, 54866,
+  54882, 54895, 54913, 54932, 54953, 54975, 54991, 55012,
+  55028, 55052, 55072, 55093, 55112, 55128, 55146, 55163,
+  55182, 55202, 55220, 55237, 55256, 55272, 55282, 55296,
+  55318, 55335, 55357, 55373, 55392, 55407, 55426, 55447,
+  55464, 55483, 55497, 55520, 55535, 55550, 55566, 55591,
+  55609, 55631, 55650, 55666, 55682, 55700, 55721, 55736,
+  55755, 55772, 55787, 55812, 55824, 55841, 55858, 55871,
+  55889, 55904, 55919, 55945, 55964, 55984, 56002, 56019,
+  56036, 56051, 56069, 56092, 56108, 56123, 56147, 56163,
+  56180, 56199, 56219, 56238, 56254, 56267, 56287, 56306,
+  56325, 56345, 56363, 56382, 56399, 56414, 56432, 56450,
+  56461, 56478, 56497, 56518, 56533, 56546, 56565, 56582,
+  56600, 56619, 56632, 56654, 56675, 56686, 56704, 56726,
+  56747, 56765, 56779, 56799, 56815, 56833, 56854, 56873,
+  56892, 56917, 56936, 56953, 56966, 56983, 57002, 57024,
+  57039, 57060, 57078, 57094, 57107, 57126, 57149, 57172,
+  57191, 57207, 57222, 57237, 57255, 57274, 57297, 57311,
+  57330, 57353, 57368, 57390, 57406, 57423, 57443, 57461,
+  57478, 57496, 57511, 57531, 57551, 57571, 57585, 57602,
+  57616, 57627, 57644, 57666, 57684, 57703, 57722, 57743,
+  57760, 57772, 57792, 57811, 57828, 57844, 57862, 57876,
+  57889, 57903, 57925, 57939, 57956, 57976, 57988, 58009,
+  58026, 58045, 58064, 58080, 58100, 58124, 58146, 58161,
+  58176, 58195, 58215, 58232, 58246, 58267, 58289, 58310,
+  58325, 58344, 58361, 58379, 58401, 58417, 58432, 58452,
+  58467, 58484, 58503, 58520, 58541, 58557, 58576, 58594,
+  58610, 58630, 58644, 58659, 58675, 58699, 58717, 58733,
+  58755, 58773, 58791, 58804, 58817, 58838, 58857, 58877,
+  58891, 58911, 58931, 58952, 58966, 58982, 58999, 59017,
+  59038, 59050, 59070, 59087, 59105, 59121, 59142, 59162,
+  59183, 59202, 59218, 59238, 59254, 59271, 59283, 59302,
+  59321, 59339, 59359, 59377, 59393, 59411, 59426, 59445,
+  59467, 59489, 59506, 59522, 59541, 59556, 59572, 59586,
+  59608, 59623, 59642, 59657, 59675, 59694, 59712, 59730,
+  59743, 59767, 59777, 59791, 59809, 59823, 59838, 59855,
+  59872, 59888, 59902, 59916, 59932, 59952, 59972, 59987,
+  60006, 60022, 60037, 60058, 60075, 60092, 60107, 60124,
+  60145, 60165, 60186, 60204, 60217, 60235, 60256, 60267,
+  60285, 60301, 60322, 60343, 60361, 60383, 60399, 60418,
+  60435, 60454, 60468, 60482, 60500, 60523, 60540, 60563,
+  60581, 60597, 60617, 60635, 60654, 60670, 60685, 60700,
+  60718, 60736, 60749, 60762, 60782, 60797, 60813, 60831,
+  60851, 60869, 60888, 60907, 60923, 60944, 60965, 60979,
+  61002, 61021, 61035, 61055, 61074, 61097, 61115, 61133,
+  61148, 61163, 61179, 61197, 61216, 61233, 61254, 61273,
+  61293, 61310, 61326, 61339, 61361, 61385, 61402, 61417,
+  61438, 61459, 61481, 61494, 61513, 61527, 61545, 61565,
+  61579, 61600, 61622, 61636, 61654, 61671, 61689, 61708,
+  61722, 61743, 61761, 61781, 61799, 61818, 61834, 61853,
+  61869, 61888, 61903, 61920, 61938, 61957, 61973, 61989,
+  62007, 62029, 62051, 62062, 62080, 62099, 62116, 62130,
+  62147, 62161, 62179, 62196, 62213, 62229, 62246, 62267,
+  62285, 62302, 62320, 62339, 62359, 62379, 62398, 62413,
+  62426, 62448, 62465, 62481, 62497, 62514, 62532, 62551,
+  62574, 62594, 62609, 62633, 62651, 62663, 62677, 62694,
+  62714, 62729, 62756, 62764, 62785, 62808, 62823, 62838,
+  62856, 62878, 62896, 62913, 62931, 62946, 62963, 62979,
+  62996, 63012, 63031, 63050, 63069, 63091, 63108, 63124,
+  63146, 63158, 63176, 63193, 63210, 63226, 63246, 63265,
+  63285, 63302, 63319, 63331, 63352, 63372, 63392, 63416,
+  63430, 63445, 63458, 63478, 63497, 63523, 63539, 63558,
+  63571, 63589, 63608, 63623, 63645, 63661, 63678, 63697,
+  63717, 63740, 63754, 63769, 63791, 63806, 63828, 63844,
+  63861, 63877, 63888, 63905, 63926, 63942, 63963, 63979,
+  64002, 64023, 64043, 64058, 64074, 64092, 64105, 64123,
+  64136, 64158, 64171, 64186, 64207, 64223, 64238, 64258,
+  64273, 64293, 64313, 64334, 64355, 64372, 64392, 64411,
+  64429, 64442, 64454, 64472, 64487, 64507, 64522, 64537,
+  64552, 64571, 64592, 64604, 64624, 64644, 64661, 64680,
+  64697, 64720, 64738, 64755, 64772, 64788, 64805, 64823,
+  64839, 64864, 64881, 64895, 64911, 64930, 64947, 64961,
+  64983, 64998, 65016, 65034, 65051, 65067, 65084, 65103,
+  65118, 65140, 65153, 65169, 65192, 65211, 65227, 65240,
+  65264, 65277, 65299, 65310, 65322, 65339, 65357, 65381,
+  65404, 65417, 65437, 65455, 65476, 65491, 65510, 65529,
+  65541, 65560, 65580, 65599, 65621, 65641, 65657, 65673,
+  65694, 65716, 65733, 65747, 65763, 65782, 65805, 65826,
+  65844, 65863, 65880, 65896, 65915, 65936, 65956, 65968,
+  65984, 65999, 66021, 66040, 66051, 66068, 66088, 66105,
+  66116, 66133, 66153, 66168, 66188, 66209, 66225, 66243,
+  66257, 66277, 66301, 66317, 66333, 66353, 66379, 66398,
+  66413, 66430, 66447, 66463, 66477, 66490, 66511, 66528,
+  66541, 66558, 66576, 66593, 66614, 66632, 66646, 66669,
+  66684, 66696, 66713, 66729, 66745, 66759, 66780, 66800,
+  66820, 66832, 66851, 66867, 66887, 66904, 66920, 66934,
+  66953, 66972, 66994, 67007, 67021, 67042, 67063, 67085,
+  67099, 67115, 67133, 67152, 67171, 67182, 67205, 67227,
+  67244, 67260, 67277, 67293, 67306, 67325, 67338, 67357,
+  67370, 67390, 67413, 67429, 67448, 67463, 67480, 67495,
+  67514, 67536, 67554, 67572, 67588, 67603, 67623, 67642,
+  67660, 67672, 67688, 67708, 67728, 67746, 67761, 67780,
+  67795, 67811, 67833, 67848, 67862, 67875, 67896, 67917,
+  67931, 67950, 67961, 67979, 67997, 68013, 68032, 68051,
+  68069, 68090, 68107, 68128, 68145, 68161, 68182, 68200,
+  68216, 68233, 68247, 68266, 68281, 68298, 68318, 68333,
+  68353, 68371, 68389, 68404, 68429, 68443, 68458, 68475,
+  68496, 68521, 68541, 68558, 68575, 68588, 68600, 68614,
+  68633, 68658, 68675, 68694, 68710, 68728, 68748, 68766,
+  68788, 68808, 68821, 68835, 68853, 68871, 68890, 68911,
+  68931, 68946, 68963, 68984, 69002, 69022, 69038, 69059,
+  69074, 69092, 69114, 69131, 69147, 69167, 69182, 69193,
+  69211, 69223, 69245, 69266, 69285, 69299, 69315, 69329,
+  69346, 69363, 69374, 69393, 69410, 69431, 69448, 69465,
+  69489, 69510, 69525, 69548, 69565, 69581, 69599, 69614,
+  69634, 69647, 69663, 69682, 69698, 69716, 69738, 69755,
+  69774, 69787, 69810, 69829, 69846, 69865, 69884, 69904,
+  69923, 69941, 69956, 69969, 69988, 70005, 70022, 70039,
+  70054, 70077, 70092, 70108, 70125, 70145, 70161, 70175,
+  70191, 70209, 70227, 70244, 70267, 70283, 70305, 70321,
+  70337, 70354, 70369, 70393, 70408, 70424, 70446, 70461,
+  70480, 70497, 70517, 70529, 70547, 70566, 70577, 70590,
+  70610, 70629, 70643, 70667, 70687, 70705, 70724, 70740,
+  70757, 70774, 70794, 70812, 70825, 70841, 70864, 70882,
+  70900, 70913, 70930, 70951, 70970, 70991, 71005, 71020,
+  71039, 71052, 71070, 71089, 71109, 71124, 71140, 71164,
+  71183, 71197, 71211, 71229, 71242, 71256, 71272, 71290,
+  71304, 71325, 71342, 71361, 71379, 71396, 71412, 71429,
+  71445, 71462, 71480, 71495, 71510, 71527, 71543, 71557,
+  71576, 71591, 71616, 71633, 71654, 71669, 71688, 71702,
+  71720, 71741, 71760, 71781, 71796, 71818, 71836, 71856,
+  71873, 71888, 71912, 71934, 71954, 71974, 71991, 72011,
+  72027, 72047, 72058, 72076, 72090, 72111, 72129, 72146,
+  72166, 72183, 72201, 72214, 72233, 72248, 72263, 72274,
+  72287, 72298, 72317, 72337, 72357, 72373, 72391, 72406,
+  72423, 72440, 72460, 72479, 72492, 72509, 72531, 72546,
+  72565, 72585, 72604, 72624, 72638, 72658, 72676, 72695,
+  72706, 72724, 72740, 72760, 72775, 72795, 72812, 72830,
+  72846, 72865, 72886, 72902, 72921, 72938, 72950, 72969,
+  72989, 73008, 73028, 73046, 73063, 73082, 73102, 73126,
+  73143, 73163, 73177, 73197, 73214, 73232, 73250, 73266,
+  73281, 73295, 73314, 73326, 73345, 73362, 73379, 73396,
+  73417, 73434, 73455, 73471, 73490, 73505, 73522, 73536,
+  73554, 73568, 73581, 73603, 73620, 73636, 73658, 73674,
+  73692, 73709, 73723, 73740, 73763, 73779, 73798, 73816,
+  73837, 73854, 73870, 73889, 73902, 73918, 73934, 73954,
+  73972, 73986, 73999, 74020, 74039, 74059, 74078, 74092,
+  74107, 74125, 74141, 74155, 74173, 74190, 74208, 74227,
+  74243, 74263, 74281, 74302, 74322, 74337, 74357, 74373,
+  74389, 74407, 74426, 74447, 74460, 74482, 74497, 74512,
+  74532, 74549, 74563, 74576, 74594, 74611, 74630, 74645,
+  74662, 74679, 74698, 74708, 74728, 74746, 74762, 74779,
+  74799, 74812, 74826, 74843, 74859, 74879, 74893, 74915,
+  74933, 74952, 74973, 74994, 75008, 75026, 75040, 75055,
+  75077, 75092, 75109, 75131, 75146, 75162, 75177, 75194,
+  75210, 75229, 75245, 75261, 75280, 75300, 75313, 75333,
+  75351, 75369, 75378, 75391, 75411, 75428, 75443, 75458,
+  75477, 75490, 75515, 75529, 75547, 75565, 75582, 75597,
+  75615, 75633, 75646, 75666, 75679, 75707, 75719, 75742,
+  75763, 75782, 75793, 75815, 75834, 75849, 75870, 75883,
+  75906, 75922, 75940, 75957, 75974, 75991, 76012, 76031,
+  76045, 76060, 76077, 76098, 76114, 76130, 76142, 76159,
+  76173, 76193, 76214, 76233, 76250, 76266, 76283, 76299,
+  76318, 76335, 76354, 76373, 76387, 76403, 76427, 76448,
+  76468, 76483, 76502, 76522, 76543, 76559, 76572, 76591,
+  76608, 76621, 76637, 76652, 76669, 76690, 76711, 76730,
+  76747, 76765, 76781, 76797, 76816, 76834, 76848, 76861,
+  76878, 76893, 76907, 76920, 76946, 76965, 76980, 76997,
+  77015, 77035, 77046, 77061, 77075, 77089, 77107, 77121,
+  77141, 77159, 77180, 77196, 77211, 77230, 77242, 77262,
+  77276, 77296, 77315, 77327, 77346, 77361, 77384, 77399,
+  77416, 77430, 77446, 77467, 77483, 77503, 77518, 77540,
+  77558, 77580, 77594, 77609, 77620, 77638, 77657, 77671,
+  77690, 77704, 77717, 77735, 77752, 77775, 77788, 77809,
+  77826, 77842, 77863, 77877, 77896, 77913, 77934, 77950,
+  77966, 77981, 77998, 78015, 78030, 78045, 78064, 78084,
+  78100, 78117, 78137, 78150, 78168, 78189, 78205, 78222,
+  78238, 78255, 78270, 78296, 78316, 78333, 78350, 78368,
+  78384, 78401, 78419, 78439, 78454, 78469, 78484, 78500,
+  78521, 78538, 78556, 78575, 78592, 78612, 78630, 78647,
+  78664, 78684, 78704, 78726, 78744, 78762, 78776, 78796,
+  78812, 78826, 78840, 78856, 78874, 78894, 78913, 78928,
+  78941, 78967, 78988, 79003, 79020, 79036, 79054, 79074,
+  79095, 79113, 79132, 79149, 79169, 79188, 79209, 79228,
+  79241, 79256, 79268, 79286, 79305, 79324, 79342, 79358,
+  79375, 79390, 79412, 79434, 79456, 79471, 79484, 79496,
+  79516, 79534, 79552, 79570, 79586, 79603, 79623, 79635,
+  79655, 79676, 79695, 79711, 79727, 79742, 79760, 79781,
+  79795, 79813, 79827, 79843, 79856, 79874, 79895, 79913,
+  79932, 79953, 79968, 79987, 80005, 80020, 80039, 80062,
+  80086, 80100, 80117, 80132, 80150, 80168, 80184, 80201,
+  80223, 80240, 80252, 80266, 80282, 80299, 80316, 80336,
+  80359, 80377, 80394, 80410, 80428, 80448, 80462, 80481,
+  80498, 80514, 80529, 80547, 80568, 80586, 80599, 80615,
+  80631, 80652, 80673, 80688, 80709, 80723, 80738, 80755,
+  80771, 80785, 80804, 80823, 80832, 80845, 80864, 80884,
+  80904, 80920, 80941, 80961, 80976, 80989, 81012, 81029,
+  81049, 81063, 81080, 81100, 81115, 81130, 81151, 81169,
+  81187, 81202, 81216, 81234, 81250, 81267, 81285, 81301,
+  81322, 81336, 81353, 81367, 81383, 81395, 81416, 81430,
+  81445, 81468, 81484, 81507, 81523, 81539, 81556, 81576,
+  81591, 81609, 81623, 81640, 81656, 81676, 81694, 81713,
+  81734, 81747, 81769, 81789, 81807, 81826, 81839, 81852,
+  81870, 81884, 81900, 81917, 81938, 81955, 81974, 81994,
+  82007, 82020
+};
+
+const uint64_t bitValues[8] = { 7, 11, 13, 17, 19, 23, 29, 31 };
+
+const uint64_t smallPrimes[3] = { 2, 3, 5 };
+
+} // namespace
+
+namespace primesieve {
+
+uint64_t SmallPrimeTable::pi(uint64_t x)
+{
+  assert(x <= LIMIT);
+  if (x < 7)
+    return (x >= 2) + (x >= 3) + (x >= 5);
+
+  // number of bits (numbers) <= x
+  uint64_t value = (x - 7) % NUMBERS_PER_BYTE + 7;
+  uint64_t pos = (x - 7) / NUMBERS_PER_BYTE * 8;
+  for (int i = 0; i < 8 && bitValues[i] <= value; i++)
+    pos++;
+
+  uint64_t word = pos / 64;
+  uint64_t count = 3 + prefixSums[word];
+  if (pos % 64 != 0)
+    count += popcount64(bitmap[word] & ((UINT64_C(1) << (pos % 64)) - 1));
+
+  return count;
+}
+
+uint64_t SmallPrimeTable::countPrimes(uint64_t start, uint64_t stop)
+{
+  if (start > stop)
+    return 0;
+  return pi(stop) - ((start > 0) ? pi(start - 1) : 0);
+}
+
+uint64_t SmallPrimeTable::nthPrime(uint64_t n)
+{
+  assert(n >= 1 && n <= pi(LIMIT));
+  if (n <= 3)
+    return smallPrimes[n - 1];
+
+  // binary search the word of the nth prime
+  n -= 3;
+  uint64_t word = (std::upper_bound(prefixSums, prefixSums + WORDS, n - 1) - prefixSums) - 1;
+  n -= prefixSums[word];
+
+  uint64_t bits = bitmap[word];
+  uint64_t pos = word * 64;
+  for (; (bits & 1) == 0 || --n > 0; bits >>= 1)
+    pos++;
+
+  return pos / 8 * NUMBERS_PER_BYTE + bitValues[pos % 8];
+}
+
+uint64_t SmallPrimeTable::nthPrime(int64_t n, uint64_t start)
+{
+  int64_t maxRank = static_cast<int64_t>(pi(LIMIT));
+  if (start > LIMIT || n > maxRank || n < -maxRank)
+    return 0;
+
+  // rank of the nth prime i.e. nthPrime = p_rank
+  int64_t rank = 0;
+  if (n > 0)
+    rank = pi(start) + n;
+  else if (start > 0)
+    rank = pi(start - 1) + ((n == 0) ? 1 : n + 1);
+  else if (n == 0)
+    rank = 1;
+
+  if (rank < 1 || rank > maxRank)
+    return 0;
+  return nthPrime(static_cast<uint64_t>(rank));
+}
+
+void SmallPrimeTable::generatePrimes(uint64_t start, uint64_t stop, std::vector<uint64_t>* primes)
+{
+  assert(stop <= LIMIT);
+  for (int i = 0; i < 3; i++)
+    if (smallPrimes[i] >= start && smallPrimes[i] <= stop)
+      primes->push_back(smallPrimes[i]);
+  if (stop < 7 || start > stop)
+    return;
+
+  uint64_t first = (std::max<uint64_t>(start, 7) - 7) / NUMBERS_PER_BYTE;
+  uint64_t last = (stop - 7) / NUMBERS_PER_BYTE;
+
+  for (uint64_t byte = first; byte <= last; byte++)
+  {
+    uint64_t bits = (bitmap[byte / 8] >> (byte % 8 * 8)) & 0xff;
+    for (int i = 0; bits != 0; i++, bits >>= 1)
+    {
+      uint64_t prime = byte * NUMBERS_PER_BYTE + bitValues[i];
+      if ((bits & 1) && prime >= start && prime <= stop)
+        primes->push_back(prime);
+    }
+  }
+}
+
+void SmallPrimeTable::storePrimes(uint64_t start, uint64_t stop, std::vector<uint64_t>* primes)
+{
+  if (stop <= LIMIT)
+    generatePrimes(start, stop, primes);
+  else
+    generate_primes(start, stop, primes);
+}
+
+} // namespace primesieve
@@ -0,0 +1,533 @@
+///
+/// @file   batch.cpp
+/// @brief  Answer many count_primes() and nth_prime() queries at
+///         once. The queries are sorted so that the sieve sweeps
+///         each region only once in ascending order and reuses
+///         its sieving primes for all nearby queries.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/config.hpp>
+#include <primesieve/batch.hpp>
+#include <primesieve/EratBig.hpp>
+#include <primesieve/parallel_for.hpp>
+#include <primesieve/pmath.hpp>
+#include <primesieve/pi_lmo.hpp>
+#include <primesieve/PiTable.hpp>
+#include <primesieve/PrimeSieve.hpp>
+#include <primesieve/SieveOfEratosthenes.hpp>
+#include <primesieve/SmallPrimeTable.hpp>
+#include <primesieve/Callback.hpp>
+#include <primesieve/cancel_callback.hpp>
+#include <primesieve/primesieve_error.hpp>
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace primesieve;
+
+namespace {
+
+/// Orders query indexes by start number
+class StartLess
+{
+public:
+  StartLess(const std::vector<uint64_t>& starts) : starts_(starts) { }
+  bool operator()(std::size_t i, std::size_t j) const
+  {
+    return starts_[i] < starts_[j];
+  }
+private:
+  const std::vector<uint64_t>& starts_;
+};
+
+/// Overlapping or nearby intervals that are sieved as one,
+/// checkpoints [first, last) are within [low, high].
+///
+struct Cluster
+{
+  uint64_t low;
+  uint64_t high;
+  std::size_t first;
+  std::size_t last;
+};
+
+/// Part of an interval that is sieved by a single thread,
+/// checkpoints [first, last) are within [start, stop].
+///
+struct Piece
+{
+  std::size_t cluster;
+  uint64_t start;
+  uint64_t stop;
+  std::size_t first;
+  std::size_t last;
+  uint64_t count;
+};
+
+/// Intervals that are closer than this are merged, sieving the
+/// gap in between is cheaper than initializing a new sieve.
+///
+uint64_t getMaxGap(uint64_t high)
+{
+  return std::max(config::MIN_THREAD_INTERVAL, isqrt(high));
+}
+
+/// Split [low, high] into pieces of pieceSize and
+/// assign the checkpoints of the cluster to them.
+///
+void addPieces(const std::vector<Cluster>& clusters,
+               const std::vector<uint64_t>& checkpoints,
+               uint64_t pieceSize,
+               std::vector<Piece>& pieces)
+{
+  for (std::size_t i = 0; i < clusters.size(); i++)
+  {
+    const Cluster& c = clusters[i];
+    const uint64_t* first = &checkpoints[0] + c.first;
+    const uint64_t* last = &checkpoints[0] + c.last;
+
+    int size = getNumChunks(c.low, c.high, pieceSize);
+
+    for (int j = 0; j < size; j++)
+    {
+      Piece piece;
+      piece.cluster = i;
+      getChunk(c.low, c.high, pieceSize, j, &piece.start, &piece.stop);
+      piece.first = std::lower_bound(first, last, piece.start) - &checkpoints[0];
+      piece.last = std::upper_bound(first, last, piece.stop) - &checkpoints[0];
+      piece.count = 0;
+      pieces.push_back(piece);
+    }
+  }
+}
+
+/// Counts the primes of each piece and the primes
+/// up to each checkpoint within the piece.
+///
+class CountPieces : public ChunkWork
+{
+public:
+  CountPieces(std::vector<Piece>& pieces,
+              const std::vector<uint64_t>& checkpoints,
+              std::vector<uint64_t>& checkpointCounts,
+              int sieveSize) :
+    pieces_(pieces),
+    checkpoints_(checkpoints),
+    checkpointCounts_(checkpointCounts),
+    sieveSize_(sieveSize)
+  { }
+  void process(int i)
+  {
+    Piece& piece = pieces_[i];
+    std::vector<uint64_t> pieceCheckpoints(checkpoints_.begin() + piece.first,
+                                           checkpoints_.begin() + piece.last);
+    std::vector<uint64_t> pieceCounts;
+    PrimeSieve ps;
+    ps.setSieveSize(sieveSize_);
+    ps.countPrimes(piece.start, piece.stop, pieceCheckpoints, &pieceCounts);
+    std::copy(pieceCounts.begin(), pieceCounts.end(), checkpointCounts_.begin() + piece.first);
+    piece.count = ps.getPrimeCount();
+  }
+private:
+  std::vector<Piece>& pieces_;
+  const std::vector<uint64_t>& checkpoints_;
+  std::vector<uint64_t>& checkpointCounts_;
+  int sieveSize_;
+};
+
+/// This class is used to find the primes of the given
+/// (sorted) ranks and then stop by throwing an exception.
+///
+class NthPrimes : public SegmentCallback
+{
+public:
+  /// @param rank  Number of primes before the first prime
+  ///              that will be called back.
+  ///
+  NthPrimes(uint64_t rank, const uint64_t* ranks, uint64_t* primes, std::size_t size) :
+    rank_(rank),
+    ranks_(ranks),
+    primes_(primes),
+    size_(size),
+    found_(0)
+  { }
+  void callback(const uint64_t* primes, std::size_t size)
+  {
+    for (; found_ < size_ && ranks_[found_] - rank_ <= size; found_++)
+      primes_[found_] = primes[ranks_[found_] - rank_ - 1];
+    rank_ += size;
+    if (found_ == size_)
+      throw cancel_callback();
+  }
+  uint64_t getRank() const { return rank_; }
+  std::size_t getFound() const { return found_; }
+private:
+  uint64_t rank_;
+  const uint64_t* ranks_;
+  uint64_t* primes_;
+  std::size_t size_;
+  std::size_t found_;
+};
+
+/// Find the primes of ranks[first, last) that are within
+/// [start, stop], rank = number of primes < start.
+/// @param stopRank  Number of primes <= stop, unless all
+///                  primes have been found.
+/// @return          The number of primes found.
+///
+std::size_t sweep(uint64_t start,
+                  uint64_t stop,
+                  uint64_t rank,
+                  const std::vector<uint64_t>& ranks,
+                  std::size_t first,
+                  std::size_t last,
+                  std::vector<uint64_t>& primes,
+                  int sieveSize,
+                  uint64_t* stopRank)
+{
+  *stopRank = rank;
+  if (first >= last)
+    return 0;
+  NthPrimes nthPrimes(rank, &ranks[first], &primes[first], last - first);
+  PrimeSieve ps;
+  ps.setSieveSize(sieveSize);
+  try {
+    ps.callbackPrimes(start, stop, &nthPrimes);
+  }
+  catch (cancel_callback&) { }
+  *stopRank = nthPrimes.getRank();
+  return nthPrimes.getFound();
+}
+
+/// Counts the primes of the pieces of [low, stop]
+class CountRanks : public ChunkWork
+{
+public:
+  CountRanks(uint64_t low,
+             uint64_t stop,
+             uint64_t pieceSize,
+             std::vector<uint64_t>& pieceCounts,
+             int sieveSize) :
+    low_(low),
+    stop_(stop),
+    pieceSize_(pieceSize),
+    pieceCounts_(pieceCounts),
+    sieveSize_(sieveSize)
+  { }
+  void process(int j)
+  {
+    uint64_t start, pieceStop;
+    getChunk(low_, stop_, pieceSize_, j, &start, &pieceStop);
+    PrimeSieve ps;
+    ps.setSieveSize(sieveSize_);
+    pieceCounts_[j] = ps.countPrimes(start, pieceStop);
+  }
+private:
+  uint64_t low_;
+  uint64_t stop_;
+  uint64_t pieceSize_;
+  std::vector<uint64_t>& pieceCounts_;
+  int sieveSize_;
+};
+
+/// Finds the primes of ranks[first, last) within
+/// the pieces of [low, stop] using the prime counts
+/// of the pieces.
+///
+class SweepRanks : public ChunkWork
+{
+public:
+  SweepRanks(uint64_t low,
+             uint64_t stop,
+             uint64_t pieceSize,
+             const std::vector<uint64_t>& pieceRanks,
+             const std::vector<uint64_t>& pieceCounts,
+             const std::vector<uint64_t>& ranks,
+             std::size_t first,
+             std::size_t last,
+             std::vector<uint64_t>& primes,
+             int sieveSize) :
+    low_(low),
+    stop_(stop),
+    pieceSize_(pieceSize),
+    pieceRanks_(pieceRanks),
+    pieceCounts_(pieceCounts),
+    ranks_(ranks),
+    first_(first),
+    last_(last),
+    primes_(primes),
+    sieveSize_(sieveSize)
+  { }
+  void process(int j)
+  {
+    uint64_t start, pieceStop;
+    getChunk(low_, stop_, pieceSize_, j, &start, &pieceStop);
+    std::vector<uint64_t>::const_iterator first = ranks_.begin() + first_;
+    std::vector<uint64_t>::const_iterator end = ranks_.begin() + last_;
+    std::size_t pieceFirst = std::upper_bound(first, end, pieceRanks_[j]) - ranks_.begin();
+    std::size_t pieceLast = std::upper_bound(first, end, pieceRanks_[j] + pieceCounts_[j]) - ranks_.begin();
+    uint64_t stopRank;
+    sweep(start, pieceStop, pieceRanks_[j], ranks_, pieceFirst, pieceLast, primes_, sieveSize_, &stopRank);
+  }
+private:
+  uint64_t low_;
+  uint64_t stop_;
+  uint64_t pieceSize_;
+  const std::vector<uint64_t>& pieceRanks_;
+  const std::vector<uint64_t>& pieceCounts_;
+  const std::vector<uint64_t>& ranks_;
+  std::size_t first_;
+  std::size_t last_;
+  std::vector<uint64_t>& primes_;
+  int sieveSize_;
+};
+
+/// Estimated value of the nth prime
+double nthPrimeApprox(uint64_t n)
+{
+  double x = static_cast<double>(std::max<uint64_t>(n, 6));
+  double logx = std::log(x);
+  return x * (logx + std::log(logx) - 1);
+}
+
+/// Returns true if finding the prime of rank next from scratch
+/// using the pi(x) table is cheaper than sieving forward from the
+/// prime of rank prev.
+///
+bool isJumpFaster(uint64_t prev, uint64_t next)
+{
+  double spacing = static_cast<double>(static_cast<uint64_t>(1) << PiTable::LOG2_SPACING);
+  double pos = nthPrimeApprox(next);
+  return pos <= static_cast<double>(PiTable::getMaxX()) &&
+         pos - nthPrimeApprox(prev) > spacing;
+}
+
+} // namespace
+
+namespace primesieve {
+
+void countPrimesBatch(const std::vector<uint64_t>& starts,
+                      const std::vector<uint64_t>& stops,
+                      std::vector<uint64_t>* counts,
+                      int threads,
+                      int sieveSize,
+                      bool numa)
+{
+  if (starts.size() != stops.size())
+    throw primesieve_error("starts and stops must have the same size");
+
+  counts->assign(starts.size(), 0);
+  std::vector<std::size_t> queries;
+
+  for (std::size_t i = 0; i < starts.size(); i++)
+  {
+    uint64_t start = starts[i];
+    uint64_t stop = stops[i];
+    if (stop > get_max_stop())
+      throw primesieve_error("stop must be <= " + SieveOfEratosthenes::getMaxStopString());
+    if (start > stop)
+      continue;
+    // small and huge intervals are counted individually
+    if (stop <= SmallPrimeTable::LIMIT)
+      (*counts)[i] = SmallPrimeTable::countPrimes(start, stop);
+    else if (PiTable::isFaster(start, stop) || isPiLmoFaster(start, stop))
+      (*counts)[i] = (threads > 1) ? parallel_count_primes(start, stop) : count_primes(start, stop);
+    else
+      queries.push_back(i);
+  }
+
+  if (queries.empty())
+    return;
+
+  // merge the sorted intervals into clusters, the checkpoints
+  // of a cluster are the stop numbers and start - 1 numbers
+  std::sort(queries.begin(), queries.end(), StartLess(starts));
+  std::vector<Cluster> clusters;
+  std::vector<std::size_t> queryCluster(starts.size());
+  std::vector<uint64_t> checkpoints;
+  uint64_t sum = 0;
+
+  for (std::size_t i = 0; i <= queries.size(); i++)
+  {
+    bool isNew = (i == queries.size() || clusters.empty());
+    if (!isNew)
+    {
+      Cluster& c = clusters.back();
+      uint64_t start = starts[queries[i]];
+      isNew = (start > c.high && start - c.high > getMaxGap(c.high));
+    }
+    if (isNew && !clusters.empty())
+    {
+      Cluster& c = clusters.back();
+      std::vector<uint64_t>::iterator first = checkpoints.begin() + c.first;
+      std::sort(first, checkpoints.end());
+      checkpoints.erase(std::unique(first, checkpoints.end()), checkpoints.end());
+      c.last = checkpoints.size();
+      sum += c.high - c.low + 1;
+    }
+    if (i == queries.size())
+      break;
+
+    std::size_t q = queries[i];
+    if (isNew)
+    {
+      Cluster c;
+      c.low = starts[q];
+      c.high = stops[q];
+      c.first = checkpoints.size();
+      c.last = c.first;
+      clusters.push_back(c);
+    }
+    Cluster& c = clusters.back();
+    c.high = std::max(c.high, stops[q]);
+    checkpoints.push_back(stops[q]);
+    if (starts[q] > c.low)
+      checkpoints.push_back(starts[q] - 1);
+    queryCluster[q] = clusters.size() - 1;
+  }
+
+  // single-threaded each cluster is sieved at once
+  uint64_t pieceSize = std::numeric_limits<uint64_t>::max();
+  if (threads > 1)
+    pieceSize = std::max(config::MIN_THREAD_INTERVAL, sum / (threads * 8));
+
+  std::vector<Piece> pieces;
+  addPieces(clusters, checkpoints, pieceSize, pieces);
+  std::vector<uint64_t> checkpointCounts(checkpoints.size(), 0);
+  int size = static_cast<int>(pieces.size());
+
+  CountPieces countPieces(pieces, checkpoints, checkpointCounts, sieveSize);
+  parallel_for(size, threads, numa, countPieces);
+
+  // checkpointCounts[j] = primes within [cluster low, checkpoints[j]]
+  uint64_t offset = 0;
+  for (std::size_t i = 0; i < pieces.size(); i++)
+  {
+    if (i > 0 && pieces[i].cluster != pieces[i - 1].cluster)
+      offset = 0;
+    for (std::size_t j = pieces[i].first; j < pieces[i].last; j++)
+      checkpointCounts[j] += offset;
+    offset += pieces[i].count;
+  }
+
+  for (std::size_t i = 0; i < queries.size(); i++)
+  {
+    std::size_t q = queries[i];
+    const Cluster& c = clusters[queryCluster[q]];
+    const uint64_t* first = &checkpoints[0] + c.first;
+    const uint64_t* last = &checkpoints[0] + c.last;
+    std::size_t j = std::lower_bound(first, last, stops[q]) - &checkpoints[0];
+    (*counts)[q] = checkpointCounts[j];
+    if (starts[q] > c.low)
+    {
+      j = std::lower_bound(first, last, starts[q] - 1) - &checkpoints[0];
+      (*counts)[q] -= checkpointCounts[j];
+    }
+  }
+}
+
+void nthPrimesBatch(const std::vector<uint64_t>& n,
+                    std::vector<uint64_t>* primes,
+                    int threads,
+                    int sieveSize,
+                    bool numa)
+{
+  primes->assign(n.size(), 0);
+  std::vector<uint64_t> ranks;
+  uint64_t maxSmallRank = SmallPrimeTable::pi(SmallPrimeTable::LIMIT);
+
+  for (std::size_t i = 0; i < n.size(); i++)
+  {
+    if (n[i] > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+      throw primesieve_error("nth prime is too large > 2^64 - 2^32 * 11");
+    // nth_prime(0) = nth_prime(1) = 2
+    uint64_t rank = std::max<uint64_t>(n[i], 1);
+    if (rank <= maxSmallRank)
+      (*primes)[i] = SmallPrimeTable::nthPrime(rank);
+    else
+      ranks.push_back(rank);
+  }
+
+  std::sort(ranks.begin(), ranks.end());
+  ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+  std::vector<uint64_t> found(ranks.size(), 0);
+  std::size_t i = 0;
+  // reuse the bucket memory among the sweeps
+  BucketPool pool;
+
+  while (i < ranks.size())
+  {
+    // find the first prime from scratch
+    int64_t first = static_cast<int64_t>(ranks[i]);
+    found[i] = (threads > 1) ? parallel_nth_prime(first) : nth_prime(first);
+    uint64_t low = found[i] + 1;
+    uint64_t rank = ranks[i++];
+    std::size_t last = i;
+    while (last < ranks.size() && !isJumpFaster(ranks[last - 1], ranks[last]))
+      last++;
+
+    // sieve forward to find the following primes,
+    // stop = estimated prime of rank ranks[last - 1]
+    while (i < last)
+    {
+      double logx = std::log(std::max(4.0, static_cast<double>(low)));
+      double dist = static_cast<double>(ranks[last - 1] - rank) * logx * 1.1;
+      dist += static_cast<double>(config::MIN_THREAD_INTERVAL);
+      uint64_t maxStop = get_max_stop();
+      if (low > maxStop)
+        throw primesieve_error("nth prime is too large > 2^64 - 2^32 * 11");
+      uint64_t stop = maxStop;
+      if (dist < static_cast<double>(maxStop - low))
+        stop = low + static_cast<uint64_t>(dist);
+
+      if (threads <= 1)
+      {
+        i += sweep(low, stop, rank, ranks, i, last, found, sieveSize, &rank);
+        low = stop + 1;
+        continue;
+      }
+
+      // count the primes of each piece in parallel, then sieve
+      // the pieces that contain primes of the given ranks
+      uint64_t pieceSize = getChunkSize(low, stop, threads);
+      int size = getNumChunks(low, stop, pieceSize);
+      std::vector<uint64_t> pieceCounts(size, 0);
+      std::vector<uint64_t> pieceRanks(size, 0);
+
+      CountRanks countRanks(low, stop, pieceSize, pieceCounts, sieveSize);
+      parallel_for(size, threads, numa, countRanks);
+
+      for (int j = 0; j < size; j++)
+      {
+        pieceRanks[j] = rank;
+        rank += pieceCounts[j];
+      }
+
+      SweepRanks sweepRanks(low, stop, pieceSize, pieceRanks, pieceCounts, ranks, i, last, found, sieveSize);
+      parallel_for(size, threads, numa, sweepRanks);
+
+      i = std::upper_bound(ranks.begin() + i, ranks.begin() + last, rank) - ranks.begin();
+      low = stop + 1;
+    }
+  }
+
+  for (std::size_t j = 0; j < n.size(); j++)
+  {
+    uint64_t rank = std::max<uint64_t>(n[j], 1);
+    if (rank > maxSmallRank)
+      (*primes)[j] = found[std::lower_bound(ranks.begin(), ranks.end(), rank) - ranks.begin()];
+  }
+}
+
+} // namespace primesieve
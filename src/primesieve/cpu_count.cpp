@@ -0,0 +1,182 @@
+///
+/// @file   cpu_count.cpp
+/// @brief  Detect the number of CPU cores available to the current
+///         process. On Linux omp_get_max_threads() reports all the
+///         CPU cores of the host, this is not what we want inside
+///         containers with restricted cpusets or CPU quotas.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/cpu_count.hpp>
+
+#if defined(__linux__)
+
+#include <sched.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+const std::string CGROUP_ROOT("/sys/fs/cgroup");
+
+/// Update cpus to min(cpus, ceil(quota / period))
+void applyQuota(int& cpus, double quota, double period)
+{
+  if (quota > 0 && period > 0)
+  {
+    int limit = std::max(1, static_cast<int>((quota + period - 1) / period));
+    if (cpus <= 0 || limit < cpus)
+      cpus = limit;
+  }
+}
+
+bool readLine(const std::string& filename, std::string& line)
+{
+  std::ifstream file(filename.c_str());
+  return file && std::getline(file, line);
+}
+
+/// Remove the last path component, "/a/b" -> "/a"
+bool parentPath(std::string& path)
+{
+  if (path.empty() || path == "/")
+    return false;
+  std::string::size_type pos = path.find_last_of('/');
+  path.erase((pos == std::string::npos) ? 0 : pos);
+  return true;
+}
+
+/// cgroup v2: <mount>/<path>/cpu.max contains "$MAX $PERIOD"
+/// with $MAX = "max" if unlimited. A quota may be set on any
+/// ancestor cgroup hence we walk up to the mount point.
+///
+void cgroupV2Quota(std::string path, int& cpus)
+{
+  do {
+    std::string line;
+    if (readLine(CGROUP_ROOT + path + "/cpu.max", line))
+    {
+      std::istringstream iss(line);
+      std::string quota;
+      double period = 0;
+      if (iss >> quota >> period && quota != "max")
+        applyQuota(cpus, std::atof(quota.c_str()), period);
+    }
+  } while (parentPath(path));
+}
+
+/// cgroup v1: <mount>/<path>/cpu.cfs_quota_us contains -1 if
+/// unlimited, <mount>/<path>/cpu.cfs_period_us the period.
+///
+void cgroupV1Quota(const std::string& mount, std::string path, int& cpus)
+{
+  do {
+    std::string quota;
+    std::string period;
+    if (readLine(mount + path + "/cpu.cfs_quota_us", quota) &&
+        readLine(mount + path + "/cpu.cfs_period_us", period))
+      applyQuota(cpus, std::atof(quota.c_str()), std::atof(period.c_str()));
+  } while (parentPath(path));
+}
+
+/// @return true if the comma separated controllers list
+///         of a cgroup v1 hierarchy contains "cpu".
+///
+bool hasCpuController(const std::string& controllers)
+{
+  std::istringstream iss(controllers);
+  std::string name;
+  while (std::getline(iss, name, ','))
+    if (name == "cpu")
+      return true;
+  return false;
+}
+
+/// Each line of /proc/self/cgroup has the format
+/// "hierarchy-ID:controller-list:cgroup-path", for
+/// cgroup v2 the hierarchy-ID is 0 and the list is empty.
+///
+void cgroupQuota(int& cpus)
+{
+  std::ifstream file("/proc/self/cgroup");
+  std::string line;
+
+  while (std::getline(file, line))
+  {
+    std::string::size_type c1 = line.find(':');
+    std::string::size_type c2 = line.find(':', c1 + 1);
+    if (c1 == std::string::npos || c2 == std::string::npos)
+      continue;
+    std::string controllers = line.substr(c1 + 1, c2 - c1 - 1);
+    std::string path = line.substr(c2 + 1);
+    if (path == "/")
+      path.clear();
+
+    if (controllers.empty())
+      cgroupV2Quota(path, cpus);
+    else if (hasCpuController(controllers))
+    {
+      cgroupV1Quota(CGROUP_ROOT + "/cpu,cpuacct", path, cpus);
+      cgroupV1Quota(CGROUP_ROOT + "/cpu", path, cpus);
+    }
+  }
+}
+
+int detectCpus()
+{
+  int cpus = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+
+#if defined(CPU_COUNT)
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+  {
+    int affinity = CPU_COUNT(&mask);
+    if (affinity > 0 && (cpus <= 0 || affinity < cpus))
+      cpus = affinity;
+  }
+#endif
+
+  cgroupQuota(cpus);
+  return std::max(cpus, 0);
+}
+
+} // namespace
+
+namespace primesieve {
+
+int getAvailableCpus()
+{
+  // cached, the CPU quota is not supposed to
+  // change during the lifetime of the process
+  static int cpus = -1;
+  if (cpus < 0)
+    cpus = detectCpus();
+  return cpus;
+}
+
+} // namespace primesieve
+
+#else
+
+namespace primesieve {
+
+/// Unknown on this platform, the caller
+/// falls back to omp_get_max_threads().
+///
+int getAvailableCpus()
+{
+  return 0;
+}
+
+} // namespace primesieve
+
+#endif
@@ -10,6 +10,7 @@
 #include <primesieve/config.hpp>
 #include <primesieve/pmath.hpp>
 #include <primesieve/PrimeFinder.hpp>
+#include <primesieve/SmallPrimeTable.hpp>
 #include <primesieve.hpp>
 
 #include <algorithm>
@@ -59,7 +60,7 @@ void iterator::generate_next_primes()
     stop_ = add_overflow_safe(start_, get_interval_size(start_));
     if (start_ <= stop_hint_ && stop_ >= stop_hint_)
       stop_ = add_overflow_safe(stop_hint_, max_prime_gap(stop_hint_));
-    primesieve::generate_primes(start_, stop_, &primes_);
+    SmallPrimeTable::storePrimes(start_, stop_, &primes_);
     if (primes_.empty() && stop_ >= get_max_stop())
       throw primesieve_error("next_prime() > " + PrimeFinder::getMaxStopString());
   }
@@ -78,7 +79,7 @@ void iterator::generate_previous_primes()
     start_ = subtract_underflow_safe(stop_, get_interval_size(stop_));
     if (start_ <= stop_hint_ && stop_ >= stop_hint_)
       start_ = subtract_underflow_safe(stop_hint_, max_prime_gap(stop_hint_));
-    primesieve::generate_primes(start_, stop_, &primes_);
+    SmallPrimeTable::storePrimes(start_, stop_, &primes_);
     if (primes_.empty() && start_ < 2)
       throw primesieve_error("previous_prime(): smallest prime is 2");
   }
@@ -0,0 +1,184 @@
+///
+/// @file   numa.cpp
+/// @brief  NUMA-aware thread placement for ParallelPrimeSieve.
+///         The NUMA topology is read from /sys/devices/system/node
+///         (Linux only), on other systems NumaAffinity does nothing.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/config.hpp>
+#include <primesieve/numa.hpp>
+
+#include <cstddef>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+namespace primesieve {
+
+int getThreadNum()
+{
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+} // namespace primesieve
+
+#if defined(__linux__)
+
+#include <sched.h>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Parse a Linux cpulist e.g. "0-7,16-23" into a CPU mask
+void parseCpuList(const std::string& cpuList, cpu_set_t* mask)
+{
+  std::istringstream iss(cpuList);
+  std::string range;
+
+  while (std::getline(iss, range, ','))
+  {
+    if (range.empty())
+      continue;
+    std::string::size_type dash = range.find('-');
+    int first = std::atoi(range.c_str());
+    int last = first;
+    if (dash != std::string::npos)
+      last = std::atoi(range.c_str() + dash + 1);
+    for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++)
+      CPU_SET(cpu, mask);
+  }
+}
+
+/// Read the CPU masks of all NUMA nodes, only the CPU cores
+/// the process is allowed to run on (affinity mask) are
+/// considered. Nodes without available CPU cores are skipped.
+///
+std::vector<cpu_set_t> readNodes()
+{
+  std::vector<cpu_set_t> nodes;
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+    return nodes;
+
+  // node ids may have gaps e.g. after CPU hotplug
+  for (int node = 0, missing = 0; missing < 64; node++)
+  {
+    std::ostringstream filename;
+    filename << "/sys/devices/system/node/node" << node << "/cpulist";
+    std::ifstream file(filename.str().c_str());
+    std::string cpuList;
+    if (!file || !std::getline(file, cpuList))
+    {
+      missing++;
+      continue;
+    }
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    parseCpuList(cpuList, &mask);
+    CPU_AND(&mask, &mask, &allowed);
+    if (CPU_COUNT(&mask) > 0)
+      nodes.push_back(mask);
+  }
+
+  return nodes;
+}
+
+const std::vector<cpu_set_t>& getNodes()
+{
+  static const std::vector<cpu_set_t> nodes = readNodes();
+  return nodes;
+}
+
+} // namespace
+
+namespace primesieve {
+
+int getNumaNodes()
+{
+  int size = static_cast<int>(getNodes().size());
+  return (size > 1) ? size : 1;
+}
+
+int getNumaNode()
+{
+  const std::vector<cpu_set_t>& nodes = getNodes();
+  int cpu = sched_getcpu();
+  if (cpu < 0 || cpu >= CPU_SETSIZE)
+    return 0;
+
+  for (std::size_t i = 0; i < nodes.size(); i++)
+    if (CPU_ISSET(cpu, &nodes[i]))
+      return static_cast<int>(i);
+
+  return 0;
+}
+
+NumaAffinity::NumaAffinity(int threadNum, bool enabled) :
+  oldMask_(NULL)
+{
+  if (!enabled || getNumaNodes() < 2)
+    return;
+
+  const std::vector<cpu_set_t>& nodes = getNodes();
+  const cpu_set_t& node = nodes[threadNum % nodes.size()];
+  cpu_set_t* oldMask = new cpu_set_t;
+
+  // on Linux pid 0 refers to the calling thread
+  if (sched_getaffinity(0, sizeof(cpu_set_t), oldMask) == 0 &&
+      sched_setaffinity(0, sizeof(cpu_set_t), &node) == 0)
+    oldMask_ = oldMask;
+  else
+    delete oldMask;
+}
+
+NumaAffinity::~NumaAffinity()
+{
+  if (oldMask_)
+  {
+    cpu_set_t* oldMask = static_cast<cpu_set_t*>(oldMask_);
+    sched_setaffinity(0, sizeof(cpu_set_t), oldMask);
+    delete oldMask;
+  }
+}
+
+} // namespace primesieve
+
+#else
+
+namespace primesieve {
+
+int getNumaNodes()
+{
+  return 1;
+}
+
+int getNumaNode()
+{
+  return 0;
+}
+
+NumaAffinity::NumaAffinity(int, bool) :
+  oldMask_(NULL)
+{ }
+
+NumaAffinity::~NumaAffinity()
+{ }
+
+} // namespace primesieve
+
+#endif
@@ -0,0 +1,82 @@
+///
+/// @file   parallel_for.cpp
+/// @brief  Chunked parallel loop used by ParallelPrimeSieve's
+///         count-then-fill functions and the batch functions.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/config.hpp>
+#include <primesieve/parallel_for.hpp>
+#include <primesieve/EratBig.hpp>
+#include <primesieve/numa.hpp>
+#include <primesieve/pmath.hpp>
+#include <primesieve/primesieve_error.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <exception>
+#include <string>
+
+namespace primesieve {
+
+uint64_t getChunkSize(uint64_t start, uint64_t stop, int threads)
+{
+  // stop <= 2^64 - 2^32 * 10, no overflow
+  uint64_t interval = stop - start;
+  if (threads <= 1)
+    return interval + 1;
+
+  uint64_t minChunkSize = std::max(config::MIN_THREAD_INTERVAL, isqrt(stop));
+  return std::max(minChunkSize, interval / (threads * 4) + 1);
+}
+
+int getNumChunks(uint64_t start, uint64_t stop, uint64_t chunkSize)
+{
+  return static_cast<int>((stop - start) / chunkSize + 1);
+}
+
+void getChunk(uint64_t start,
+              uint64_t stop,
+              uint64_t chunkSize,
+              int i,
+              uint64_t* chunkStart,
+              uint64_t* chunkStop)
+{
+  *chunkStart = start + chunkSize * i;
+  *chunkStop = (stop - *chunkStart < chunkSize) ? stop : *chunkStart + chunkSize - 1;
+}
+
+void parallel_for(int size, int threads, bool numa, ChunkWork& work)
+{
+  // read the NUMA topology before pinning any thread
+  numa = numa && getNumaNodes() > 1;
+  BucketPool pool;
+  std::string error;
+
+  #pragma omp parallel num_threads(threads)
+  {
+    NumaAffinity affinity(getThreadNum(), numa);
+
+    #pragma omp for schedule(dynamic)
+    for (int i = 0; i < size; i++)
+    {
+      try {
+        work.process(i);
+      }
+      catch (std::exception& e)
+      {
+        #pragma omp critical (primesieve_parallel_for)
+        error = e.what();
+      }
+    }
+  }
+
+  if (!error.empty())
+    throw primesieve_error(error);
+}
+
+} // namespace primesieve
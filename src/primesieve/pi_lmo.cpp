@@ -0,0 +1,469 @@
+///
+/// @file   pi_lmo.cpp
+/// @brief  Count the primes <= x using the combinatorial
+///         Lagarias-Miller-Odlyzko algorithm:
+///         pi(x) = S1 + S2 + pi(y) - 1 - P2, with y >= x^(1/3).
+///         S1 (ordinary leaves) is a sum over the squarefree
+///         numbers <= y, S2 (special leaves) is computed using a
+///         segmented sieve of Eratosthenes on [1, x / y] with a
+///         binary indexed tree for counting and P2 (the numbers
+///         <= x with 2 prime factors > y) is computed by sieving
+///         (sqrt(x), x / y] with PrimeSieve.
+///
+/// Copyright (C) 2014 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/config.hpp>
+#include <primesieve/pi_lmo.hpp>
+#include <primesieve/pmath.hpp>
+#include <primesieve/Callback.hpp>
+#include <primesieve/PrimeSieve.hpp>
+#include <primesieve/PushBackPrimes.hpp>
+#include <primesieve/iterator.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+using namespace primesieve;
+
+/// Calculate y = alpha * x^(1/3), the larger alpha the less
+/// work for P2 and the more work for S2.
+///
+uint32_t getY(uint64_t x)
+{
+  double logx = std::log(static_cast<double>(x));
+  double alpha = std::max(1.0, logx * logx / 150);
+  uint64_t y = static_cast<uint64_t>(static_cast<double>(icbrt(x) + 1) * alpha);
+  y = std::min(y, isqrt(x));
+  y = std::max(y, icbrt(x) + 1);
+  return static_cast<uint32_t>(y);
+}
+
+/// Tables of the numbers <= y: least prime factor and Moebius
+/// function (mu = 0 if not squarefree).
+///
+void initLpfMu(uint32_t y, std::vector<uint32_t>& lpf, std::vector<int8_t>& mu)
+{
+  lpf.assign(y + 1, 0);
+  mu.assign(y + 1, 1);
+  lpf[1] = std::numeric_limits<uint32_t>::max();
+
+  for (uint32_t i = 2; i <= y; i++)
+  {
+    if (lpf[i] == 0)
+    {
+      for (uint32_t j = i; j <= y; j += i)
+      {
+        if (lpf[j] == 0)
+          lpf[j] = i;
+        mu[j] = static_cast<int8_t>(-mu[j]);
+      }
+      uint64_t square = static_cast<uint64_t>(i) * i;
+      for (uint64_t j = square; j <= y; j += square)
+        mu[j] = 0;
+    }
+  }
+}
+
+/// Ordinary leaves: sum of mu(n) * phi(x / n, 0) for the
+/// squarefree numbers n <= y. All arithmetic in this file is
+/// modulo 2^64, the final result pi(x) < 2^64 is exact.
+///
+uint64_t S1(uint64_t x, uint32_t y, const std::vector<int8_t>& mu)
+{
+  uint64_t sum = 0;
+  for (uint32_t n = 1; n <= y; n++)
+  {
+    if (mu[n] > 0) sum += x / n;
+    if (mu[n] < 0) sum -= x / n;
+  }
+  return sum;
+}
+
+/// Sieve array with a binary indexed tree (Fenwick tree) for
+/// counting the unsieved numbers <= n in O(log n).
+///
+/// S2 cannot use SieveOfEratosthenes (EratSmall, EratMedium,
+/// EratBig): S2 needs the number of unsieved numbers <= n after
+/// each single sieving prime has been crossed off, but
+/// SieveOfEratosthenes crosses off all sieving primes of a
+/// segment at once (EratBig even in bucket order) and only then
+/// hands the segment to PrimeFinder. Its bit array also skips
+/// the multiples of 2, 3 and 5 which S2 must count for b <= 3.
+/// The price of the separate sieve: 5 bytes per number (1 byte
+/// sieve, 4 bytes tree) instead of 1 bit per 30 / 8 numbers, for
+/// segmentSize = 2 * sqrt(x / y) numbers this is e.g. 160
+/// kilobytes per thread for x = 10^14, and each crossed-off
+/// number costs O(log segmentSize) tree updates.
+///
+class CountSieve
+{
+public:
+  void reset(uint64_t low, uint64_t high)
+  {
+    low_ = low;
+    size_ = high - low;
+    sieve_.assign(size_, 1);
+    tree_.resize(size_);
+    for (std::size_t i = 0; i < size_; i++)
+      tree_[i] = 1;
+    for (std::size_t i = 0; i < size_; i++)
+    {
+      std::size_t j = i | (i + 1);
+      if (j < size_)
+        tree_[j] += tree_[i];
+    }
+  }
+  /// Count the unsieved numbers within [low, n]
+  uint64_t count(uint64_t n) const
+  {
+    uint64_t sum = 0;
+    for (int64_t i = static_cast<int64_t>(n - low_); i >= 0; i = (i & (i + 1)) - 1)
+      sum += tree_[i];
+    return sum;
+  }
+  /// Count all unsieved numbers of the segment
+  uint64_t count() const
+  {
+    return count(low_ + size_ - 1);
+  }
+  /// Cross-off the multiples of prime within the segment.
+  /// @param next  Next multiple of prime, updated.
+  ///
+  void crossOff(uint64_t prime, uint64_t& next)
+  {
+    std::size_t i = static_cast<std::size_t>(next - low_);
+    for (; i < size_; i += static_cast<std::size_t>(prime))
+    {
+      if (sieve_[i])
+      {
+        sieve_[i] = 0;
+        for (std::size_t j = i; j < size_; j |= j + 1)
+          tree_[j]--;
+      }
+    }
+    next = low_ + i;
+  }
+private:
+  uint64_t low_;
+  std::size_t size_;
+  std::vector<char> sieve_;
+  std::vector<int32_t> tree_;
+};
+
+struct Tables
+{
+  uint64_t x;
+  uint32_t y;
+  /// pi(y)
+  uint32_t a;
+  /// pi(sqrt(y))
+  uint32_t pi_sqrty;
+  /// primes[1] = 2, primes[2] = 3, ...
+  std::vector<uint32_t> primes;
+  std::vector<uint32_t> pi;
+  std::vector<uint32_t> lpf;
+  std::vector<int8_t> mu;
+};
+
+/// Special leaves of a batch of consecutive segments. phi[b] and
+/// muSum[b] are relative to the batch: phi[b] is the number of
+/// unsieved numbers (not divisible by the first b - 1 primes)
+/// within the batch and muSum[b] is the sum of -mu(m) of the
+/// special leaves x / (primes[b] * m) within the batch. The
+/// special leaves of the following batches are corrected using
+/// these values, see S2().
+///
+class S2Batch
+{
+public:
+  S2Batch() : sum(0) { }
+  uint64_t sum;
+  std::vector<uint64_t> phi;
+  std::vector<int64_t> muSum;
+
+  void sieve(const Tables& t, uint64_t low, uint64_t high, uint64_t segmentSize)
+  {
+    sum = 0;
+    phi.assign(t.a + 1, 0);
+    muSum.assign(t.a + 1, 0);
+    next_.resize(t.a + 1);
+    for (uint32_t b = 1; b <= t.a; b++)
+    {
+      uint64_t prime = t.primes[b];
+      next_[b] = ((low + prime - 1) / prime) * prime;
+    }
+
+    for (; low < high; low += segmentSize)
+      sieveSegment(t, low, std::min(low + segmentSize, high));
+  }
+
+private:
+  std::vector<uint64_t> next_;
+  CountSieve sieve_;
+
+  void sieveSegment(const Tables& t, uint64_t low, uint64_t high)
+  {
+    sieve_.reset(low, high);
+    uint32_t b = 1;
+
+    // leaves x / (prime * m) with m squarefree, lpf(m) > prime
+    for (; b <= t.pi_sqrty; b++)
+    {
+      uint64_t prime = t.primes[b];
+      uint64_t xp = t.x / prime;
+      uint64_t min_m = std::max(xp / high, t.y / prime);
+      uint64_t max_m = std::min<uint64_t>(xp / low, t.y);
+      if (prime >= max_m)
+        return;
+      for (uint64_t m = max_m; m > min_m; m--)
+      {
+        if (t.mu[m] != 0 && prime < t.lpf[m])
+        {
+          uint64_t count = phi[b] + sieve_.count(xp / m);
+          if (t.mu[m] > 0) sum -= count;
+          else             sum += count;
+          muSum[b] -= t.mu[m];
+        }
+      }
+      phi[b] += sieve_.count();
+      sieve_.crossOff(prime, next_[b]);
+    }
+
+    // leaves x / (prime * q) with q prime, y / prime < q <= y
+    for (; b <= t.a; b++)
+    {
+      uint64_t prime = t.primes[b];
+      uint64_t xp = t.x / prime;
+      uint32_t l = t.pi[std::min<uint64_t>(xp / low, t.y)];
+      uint64_t min_m = std::max(xp / high, prime);
+      if (prime >= t.primes[l])
+        return;
+      for (; t.primes[l] > min_m; l--)
+      {
+        sum += phi[b] + sieve_.count(xp / t.primes[l]);
+        muSum[b]++;
+      }
+      phi[b] += sieve_.count();
+      sieve_.crossOff(prime, next_[b]);
+    }
+  }
+};
+
+/// Special leaves: the segments of [1, x / y] are sieved in
+/// rounds, in each round the threads sieve consecutive batches
+/// of segments. Then the batches are combined in order.
+///
+uint64_t S2(const Tables& t, int threads)
+{
+  uint64_t limit = t.x / t.y + 1;
+  uint64_t segmentSize = std::max<uint64_t>(1 << 12, floorPowerOf2(isqrt(limit)) * 2);
+  uint64_t segments = (limit + segmentSize - 1) / segmentSize;
+  uint64_t batchSegments = std::max<uint64_t>(1, segments / (threads * 8));
+  uint64_t batchSize = batchSegments * segmentSize;
+
+  std::vector<S2Batch> batches(threads);
+  std::vector<uint64_t> phi(t.a + 1, 0);
+  uint64_t sum = 0;
+
+  for (uint64_t low = 1; low < limit; low += batchSize * threads)
+  {
+    int n = static_cast<int>(std::min<uint64_t>(threads, (limit - low + batchSize - 1) / batchSize));
+
+    #pragma omp parallel for num_threads(n) schedule(static, 1)
+    for (int i = 0; i < n; i++)
+    {
+      uint64_t batchLow = low + batchSize * i;
+      uint64_t batchHigh = std::min(batchLow + batchSize, limit);
+      batches[i].sieve(t, batchLow, batchHigh, segmentSize);
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+      sum += batches[i].sum;
+      for (uint32_t b = 1; b <= t.a; b++)
+      {
+        sum += static_cast<uint64_t>(batches[i].muSum[b]) * phi[b];
+        phi[b] += batches[i].phi[b];
+      }
+    }
+  }
+
+  return sum;
+}
+
+/// Calculates the sum of pi(x / p) for the primes p with
+/// x / p within [low, high] and p > y, x / p ascending
+/// i.e. p descending, relative to pi(low - 1).
+///
+class P2Chunk : public SegmentCallback
+{
+public:
+  P2Chunk(uint64_t x, uint64_t y, uint64_t sqrtx, uint64_t low, uint64_t high) :
+    count(0),
+    sum(0),
+    leaves(0),
+    x_(x),
+    pmin_(std::max(y + 1, x / (high + 1) + 1))
+  {
+    uint64_t pmax = std::min(x / low, sqrtx);
+    if (pmin_ <= pmax)
+    {
+      it_.skipto(pmax + 1);
+      nextPrime();
+    }
+    else
+      prime_ = 0;
+  }
+  /// Number of primes within [low, high]
+  uint64_t count;
+  uint64_t sum;
+  uint64_t leaves;
+
+  void callback(const uint64_t* primes, std::size_t size)
+  {
+    for (std::size_t i = 0; i < size; i++)
+    {
+      while (prime_ != 0 && x_ / prime_ < primes[i])
+        add();
+      count++;
+    }
+  }
+  void finish()
+  {
+    while (prime_ != 0)
+      add();
+  }
+private:
+  uint64_t x_;
+  uint64_t pmin_;
+  /// Current prime p, 0 if done
+  uint64_t prime_;
+  primesieve::iterator it_;
+  void add()
+  {
+    sum += count;
+    leaves++;
+    nextPrime();
+  }
+  void nextPrime()
+  {
+    prime_ = it_.previous_prime();
+    if (prime_ < pmin_)
+      prime_ = 0;
+  }
+};
+
+/// P2 = sum of pi(x / p) - pi(p) + 1 for the primes
+/// y < p <= sqrt(x), the numbers <= x with 2 prime
+/// factors > y.
+///
+uint64_t P2(uint64_t x, uint32_t y, uint32_t a, int threads)
+{
+  uint64_t sqrtx = isqrt(x);
+  uint64_t z = x / y;
+  if (sqrtx <= y || z < sqrtx)
+    return 0;
+
+  PrimeSieve ps;
+  uint64_t pi_low = (sqrtx > 1) ? ps.countPrimes(0, sqrtx - 1) : 0;
+  uint64_t pi_sqrtx = pi_low + ps.countPrimes(sqrtx, sqrtx);
+
+  // sum of pi(p) - 1 for the primes y < p <= sqrt(x)
+  uint64_t sum = 0;
+  sum -= (pi_sqrtx * (pi_sqrtx - 1)) / 2;
+  sum += (static_cast<uint64_t>(a) * (a - 1)) / 2;
+
+  int chunks = threads * 8;
+  uint64_t chunkSize = (z - sqrtx) / chunks + 1;
+  std::vector<uint64_t> counts(chunks);
+  std::vector<uint64_t> sums(chunks);
+  std::vector<uint64_t> leaves(chunks);
+
+  #pragma omp parallel for num_threads(threads) schedule(dynamic)
+  for (int i = 0; i < chunks; i++)
+  {
+    uint64_t low = sqrtx + chunkSize * i;
+    uint64_t high = std::min(low + chunkSize - 1, z);
+    if (low <= high)
+    {
+      P2Chunk chunk(x, y, sqrtx, low, high);
+      PrimeSieve ps;
+      ps.callbackPrimes(low, high, &chunk);
+      chunk.finish();
+      counts[i] = chunk.count;
+      sums[i] = chunk.sum;
+      leaves[i] = chunk.leaves;
+    }
+  }
+
+  for (int i = 0; i < chunks; i++)
+  {
+    sum += sums[i] + leaves[i] * pi_low;
+    pi_low += counts[i];
+  }
+
+  return sum;
+}
+
+} // namespace
+
+namespace primesieve {
+
+uint64_t pi_lmo(uint64_t x, int threads)
+{
+  if (x < 2)
+    return 0;
+
+  Tables t;
+  t.x = x;
+  t.y = getY(x);
+  t.primes.push_back(0);
+  PushBackPrimes<uint32_t> pb(t.primes);
+  pb.pushBackPrimes(0, t.y);
+  t.a = static_cast<uint32_t>(t.primes.size() - 1);
+  t.pi_sqrty = 0;
+  while (t.pi_sqrty < t.a && isquare<uint64_t>(t.primes[t.pi_sqrty + 1]) <= t.y)
+    t.pi_sqrty++;
+
+  t.pi.assign(t.y + 1, 0);
+  for (uint32_t b = 1; b <= t.a; b++)
+    t.pi[t.primes[b]] = 1;
+  for (uint32_t i = 1; i <= t.y; i++)
+    t.pi[i] += t.pi[i - 1];
+
+  initLpfMu(t.y, t.lpf, t.mu);
+
+  threads = std::max(threads, 1);
+  uint64_t pix = S1(x, t.y, t.mu);
+  pix += S2(t, threads);
+  pix += t.a - 1;
+  pix -= P2(x, t.y, t.a, threads);
+
+  return pix;
+}
+
+double getPiLmoCost(uint64_t start, uint64_t stop)
+{
+  double cost = std::pow(static_cast<double>(stop), 2.0 / 3.0);
+  if (start > 1)
+    cost += std::pow(static_cast<double>(start), 2.0 / 3.0);
+  return config::PI_LMO_THRESHOLD * cost;
+}
+
+bool isPiLmoFaster(uint64_t start, uint64_t stop)
+{
+  if (start > stop)
+    return false;
+  return static_cast<double>(stop - start) > getPiLmoCost(start, stop);
+}
+
+} // namespace primesieve
@@ -12,6 +12,8 @@
   #define __STDC_CONSTANT_MACROS
 #endif
 
+#include <primesieve/pmath.hpp>
+
 #include <stdint.h>
 
 namespace primesieve {
@@ -31,13 +33,11 @@ uint64_t popcount(const uint64_t* array, uint64_t size)
   const uint64_t m2  = UINT64_C(0x3333333333333333);
   const uint64_t m4  = UINT64_C(0x0F0F0F0F0F0F0F0F);
   const uint64_t m8  = UINT64_C(0x00FF00FF00FF00FF);
-  const uint64_t h01 = UINT64_C(0x0101010101010101);
 
   uint64_t limit30 = size - size % 30;
   uint64_t i, j;
   uint64_t count1, count2, half1, half2, acc;
   uint64_t bit_count = 0;
-  uint64_t x;
 
   if (array == 0)
     return 0;
@@ -67,15 +67,8 @@ uint64_t popcount(const uint64_t* array, uint64_t size)
   }
 
   // Count the bits of the remaining bytes (max 29*8 = 232)
-  // http://en.wikipedia.org/wiki/Hamming_weight#Efficient_implementation
-  for (i = 0; i < size - limit30; i++) {
-    x = array[i];
-    x =  x       - ((x >> 1)  & m1);
-    x = (x & m2) + ((x >> 2)  & m2);
-    x = (x       +  (x >> 4)) & m4;
-    x = (x * h01) >> 56;
-    bit_count += x;
-  }
+  for (i = 0; i < size - limit30; i++)
+    bit_count += popcount64(array[i]);
 
   return bit_count;
 }
@@ -18,9 +18,11 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <algorithm>
 #include <exception>
 #include <limits>
 #include <cerrno>
+#include <vector>
 
 //////////////////////////////////////////////////////////////////////
 //                    Internal helper functions
@@ -36,7 +38,7 @@ const int BUFFER_BYTES = 128;
 /// primes[index-2] = integer type, e.g. INT_PRIMES.
 ///
 template <typename T>
-void* generate_primes_helper(uint64_t start, uint64_t stop, size_t* size, int type)
+void* generate_primes_helper(uint64_t start, uint64_t stop, size_t* size, int type, bool parallel)
 {
 #if __cplusplus >= 201103L
   static_assert(BUFFER_BYTES % sizeof(T) == 0, "Prime type sizeof must be a power of 2.");
@@ -49,7 +51,10 @@ void* generate_primes_helper(uint64_t start, uint64_t stop, size_t* size, int ty
     reinterpret_cast<uintptr_t*>(&primes[index])[-1] = reinterpret_cast<uintptr_t>(&primes);
     reinterpret_cast<uintptr_t*>(&primes[index])[-2] = type;
 
-    primesieve::generate_primes(start, stop, &primes);
+    if (parallel)
+      primesieve::parallel_generate_primes(start, stop, &primes);
+    else
+      primesieve::generate_primes(start, stop, &primes);
     if (size)
       *size = primes.size() - index;
     return reinterpret_cast<void*>(&primes[index]);
@@ -95,6 +100,21 @@ void* generate_n_primes_helper(uint64_t n, uint64_t start, int type)
   return NULL;
 }
 
+/// Adapter that calls back a C function with the
+/// primes and the rank of the first prime.
+///
+class RankCallback_c : public primesieve::RankCallback
+{
+public:
+  RankCallback_c(callback_c_rank_t callback) : callback_(callback) { }
+  void callback(const uint64_t* primes, size_t size, uint64_t rank)
+  {
+    callback_(primes, size, rank);
+  }
+private:
+  callback_c_rank_t callback_;
+};
+
 } // namespace
 
 /// All C API functions declared in primesieve.h
@@ -110,20 +130,45 @@ void* primesieve_generate_primes(uint64_t start, uint64_t stop, size_t* size, in
 {
   switch (type)
   {
-    case SHORT_PRIMES:     return generate_primes_helper<short>(start, stop, size, type);
-    case USHORT_PRIMES:    return generate_primes_helper<unsigned short>(start, stop, size, type);
-    case INT_PRIMES:       return generate_primes_helper<int>(start, stop, size, type);
-    case UINT_PRIMES:      return generate_primes_helper<unsigned int>(start, stop, size, type);
-    case LONG_PRIMES:      return generate_primes_helper<long>(start, stop, size, type);
-    case ULONG_PRIMES:     return generate_primes_helper<unsigned long>(start, stop, size, type);
-    case LONGLONG_PRIMES:  return generate_primes_helper<long long>(start, stop, size, type);
-    case ULONGLONG_PRIMES: return generate_primes_helper<unsigned long long>(start, stop, size, type);
-    case INT16_PRIMES:     return generate_primes_helper<int16_t>(start, stop, size, type);
-    case UINT16_PRIMES:    return generate_primes_helper<uint16_t>(start, stop, size, type);
-    case INT32_PRIMES:     return generate_primes_helper<int32_t>(start, stop, size, type);
-    case UINT32_PRIMES:    return generate_primes_helper<uint32_t>(start, stop, size, type);
-    case INT64_PRIMES:     return generate_primes_helper<int64_t>(start, stop, size, type);
-    case UINT64_PRIMES:    return generate_primes_helper<uint64_t>(start, stop, size, type);
+    case SHORT_PRIMES:     return generate_primes_helper<short>(start, stop, size, type, false);
+    case USHORT_PRIMES:    return generate_primes_helper<unsigned short>(start, stop, size, type, false);
+    case INT_PRIMES:       return generate_primes_helper<int>(start, stop, size, type, false);
+    case UINT_PRIMES:      return generate_primes_helper<unsigned int>(start, stop, size, type, false);
+    case LONG_PRIMES:      return generate_primes_helper<long>(start, stop, size, type, false);
+    case ULONG_PRIMES:     return generate_primes_helper<unsigned long>(start, stop, size, type, false);
+    case LONGLONG_PRIMES:  return generate_primes_helper<long long>(start, stop, size, type, false);
+    case ULONGLONG_PRIMES: return generate_primes_helper<unsigned long long>(start, stop, size, type, false);
+    case INT16_PRIMES:     return generate_primes_helper<int16_t>(start, stop, size, type, false);
+    case UINT16_PRIMES:    return generate_primes_helper<uint16_t>(start, stop, size, type, false);
+    case INT32_PRIMES:     return generate_primes_helper<int32_t>(start, stop, size, type, false);
+    case UINT32_PRIMES:    return generate_primes_helper<uint32_t>(start, stop, size, type, false);
+    case INT64_PRIMES:     return generate_primes_helper<int64_t>(start, stop, size, type, false);
+    case UINT64_PRIMES:    return generate_primes_helper<uint64_t>(start, stop, size, type, false);
+  }
+  errno = EDOM;
+  if (size)
+    *size = 0;
+  return NULL;
+}
+
+void* primesieve_parallel_generate_primes(uint64_t start, uint64_t stop, size_t* size, int type)
+{
+  switch (type)
+  {
+    case SHORT_PRIMES:     return generate_primes_helper<short>(start, stop, size, type, true);
+    case USHORT_PRIMES:    return generate_primes_helper<unsigned short>(start, stop, size, type, true);
+    case INT_PRIMES:       return generate_primes_helper<int>(start, stop, size, type, true);
+    case UINT_PRIMES:      return generate_primes_helper<unsigned int>(start, stop, size, type, true);
+    case LONG_PRIMES:      return generate_primes_helper<long>(start, stop, size, type, true);
+    case ULONG_PRIMES:     return generate_primes_helper<unsigned long>(start, stop, size, type, true);
+    case LONGLONG_PRIMES:  return generate_primes_helper<long long>(start, stop, size, type, true);
+    case ULONGLONG_PRIMES: return generate_primes_helper<unsigned long long>(start, stop, size, type, true);
+    case INT16_PRIMES:     return generate_primes_helper<int16_t>(start, stop, size, type, true);
+    case UINT16_PRIMES:    return generate_primes_helper<uint16_t>(start, stop, size, type, true);
+    case INT32_PRIMES:     return generate_primes_helper<int32_t>(start, stop, size, type, true);
+    case UINT32_PRIMES:    return generate_primes_helper<uint32_t>(start, stop, size, type, true);
+    case INT64_PRIMES:     return generate_primes_helper<int64_t>(start, stop, size, type, true);
+    case UINT64_PRIMES:    return generate_primes_helper<uint64_t>(start, stop, size, type, true);
   }
   errno = EDOM;
   if (size)
@@ -189,9 +234,7 @@ uint64_t primesieve_nth_prime(int64_t n, uint64_t start)
 {
   try
   {
-    primesieve::PrimeSieve ps;
-    ps.setSieveSize(primesieve::get_sieve_size());
-    return ps.nthPrime(n, start);
+    return primesieve::nth_prime(n, start);
   }
   catch (std::exception&)
   {
@@ -204,10 +247,7 @@ uint64_t primesieve_parallel_nth_prime(int64_t n, uint64_t start)
 {
   try
   {
-    primesieve::ParallelPrimeSieve pps;
-    pps.setSieveSize (primesieve::get_sieve_size());
-    pps.setNumThreads(primesieve::get_num_threads());
-    return pps.nthPrime(n, start);
+    return primesieve::parallel_nth_prime(n, start);
   }
   catch (std::exception&)
   {
@@ -216,6 +256,38 @@ uint64_t primesieve_parallel_nth_prime(int64_t n, uint64_t start)
   return PRIMESIEVE_ERROR;
 }
 
+int primesieve_nth_primes(const uint64_t* n, uint64_t* primes, size_t size)
+{
+  try
+  {
+    std::vector<uint64_t> result;
+    primesieve::nth_primes(std::vector<uint64_t>(n, n + size), &result);
+    std::copy(result.begin(), result.end(), primes);
+    return 1;
+  }
+  catch (std::exception&)
+  {
+    errno = EDOM;
+  }
+  return 0;
+}
+
+int primesieve_parallel_nth_primes(const uint64_t* n, uint64_t* primes, size_t size)
+{
+  try
+  {
+    std::vector<uint64_t> result;
+    primesieve::parallel_nth_primes(std::vector<uint64_t>(n, n + size), &result);
+    std::copy(result.begin(), result.end(), primes);
+    return 1;
+  }
+  catch (std::exception&)
+  {
+    errno = EDOM;
+  }
+  return 0;
+}
+
 //////////////////////////////////////////////////////////////////////
 //                      Count functions
 //////////////////////////////////////////////////////////////////////
@@ -224,9 +296,7 @@ uint64_t primesieve_count_primes(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::PrimeSieve ps;
-    ps.setSieveSize(primesieve::get_sieve_size());
-    return ps.countPrimes(start, stop);
+    return primesieve::count_primes(start, stop);
   }
   catch (std::exception&)
   {
@@ -239,9 +309,7 @@ uint64_t primesieve_count_twins(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::PrimeSieve ps;
-    ps.setSieveSize(primesieve::get_sieve_size());
-    return ps.countTwins(start, stop);
+    return primesieve::count_twins(start, stop);
   }
   catch (std::exception&)
   {
@@ -254,9 +322,7 @@ uint64_t primesieve_count_triplets(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::PrimeSieve ps;
-    ps.setSieveSize(primesieve::get_sieve_size());
-    return ps.countTriplets(start, stop);
+    return primesieve::count_triplets(start, stop);
   }
   catch (std::exception&)
   {
@@ -269,9 +335,7 @@ uint64_t primesieve_count_quadruplets(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::PrimeSieve ps;
-    ps.setSieveSize(primesieve::get_sieve_size());
-    return ps.countQuadruplets(start, stop);
+    return primesieve::count_quadruplets(start, stop);
   }
   catch (std::exception&)
   {
@@ -284,9 +348,7 @@ uint64_t primesieve_count_quintuplets(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::PrimeSieve ps;
-    ps.setSieveSize(primesieve::get_sieve_size());
-    return ps.countQuintuplets(start, stop);
+    return primesieve::count_quintuplets(start, stop);
   }
   catch (std::exception&)
   {
@@ -299,9 +361,7 @@ uint64_t primesieve_count_sextuplets(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::PrimeSieve ps;
-    ps.setSieveSize(primesieve::get_sieve_size());
-    return ps.countSextuplets(start, stop);
+    return primesieve::count_sextuplets(start, stop);
   }
   catch (std::exception&)
   {
@@ -314,9 +374,7 @@ uint64_t primesieve_count_septuplets(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::PrimeSieve ps;
-    ps.setSieveSize(primesieve::get_sieve_size());
-    return ps.countSeptuplets(start, stop);
+    return primesieve::count_septuplets(start, stop);
   }
   catch (std::exception&)
   {
@@ -333,10 +391,7 @@ uint64_t primesieve_parallel_count_primes(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::ParallelPrimeSieve pps;
-    pps.setSieveSize (primesieve::get_sieve_size());
-    pps.setNumThreads(primesieve::get_num_threads());
-    return pps.countPrimes(start, stop);
+    return primesieve::parallel_count_primes(start, stop);
   }
   catch (std::exception&)
   {
@@ -349,10 +404,7 @@ uint64_t primesieve_parallel_count_twins(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::ParallelPrimeSieve pps;
-    pps.setSieveSize (primesieve::get_sieve_size());
-    pps.setNumThreads(primesieve::get_num_threads());
-    return pps.countTwins(start, stop);
+    return primesieve::parallel_count_twins(start, stop);
   }
   catch (std::exception&)
   {
@@ -365,10 +417,7 @@ uint64_t primesieve_parallel_count_triplets(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::ParallelPrimeSieve pps;
-    pps.setSieveSize (primesieve::get_sieve_size());
-    pps.setNumThreads(primesieve::get_num_threads());
-    return pps.countTriplets(start, stop);
+    return primesieve::parallel_count_triplets(start, stop);
   }
   catch (std::exception&)
   {
@@ -381,10 +430,7 @@ uint64_t primesieve_parallel_count_quadruplets(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::ParallelPrimeSieve pps;
-    pps.setSieveSize (primesieve::get_sieve_size());
-    pps.setNumThreads(primesieve::get_num_threads());
-    return pps.countQuadruplets(start, stop);
+    return primesieve::parallel_count_quadruplets(start, stop);
   }
   catch (std::exception&)
   {
@@ -397,10 +443,7 @@ uint64_t primesieve_parallel_count_quintuplets(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::ParallelPrimeSieve pps;
-    pps.setSieveSize (primesieve::get_sieve_size());
-    pps.setNumThreads(primesieve::get_num_threads());
-    return pps.countQuintuplets(start, stop);
+    return primesieve::parallel_count_quintuplets(start, stop);
   }
   catch (std::exception&)
   {
@@ -413,10 +456,7 @@ uint64_t primesieve_parallel_count_sextuplets(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::ParallelPrimeSieve pps;
-    pps.setSieveSize (primesieve::get_sieve_size());
-    pps.setNumThreads(primesieve::get_num_threads());
-    return pps.countSextuplets(start, stop);
+    return primesieve::parallel_count_sextuplets(start, stop);
   }
   catch (std::exception&)
   {
@@ -429,10 +469,7 @@ uint64_t primesieve_parallel_count_septuplets(uint64_t start, uint64_t stop)
 {
   try
   {
-    primesieve::ParallelPrimeSieve pps;
-    pps.setSieveSize (primesieve::get_sieve_size());
-    pps.setNumThreads(primesieve::get_num_threads());
-    return pps.countSeptuplets(start, stop);
+    return primesieve::parallel_count_septuplets(start, stop);
   }
   catch (std::exception&)
   {
@@ -441,6 +478,40 @@ uint64_t primesieve_parallel_count_septuplets(uint64_t start, uint64_t stop)
   return PRIMESIEVE_ERROR;
 }
 
+int primesieve_count_primes_batch(const uint64_t* starts, const uint64_t* stops, uint64_t* counts, size_t size)
+{
+  try
+  {
+    std::vector<uint64_t> result;
+    primesieve::count_primes(std::vector<uint64_t>(starts, starts + size),
+                             std::vector<uint64_t>(stops, stops + size), &result);
+    std::copy(result.begin(), result.end(), counts);
+    return 1;
+  }
+  catch (std::exception&)
+  {
+    errno = EDOM;
+  }
+  return 0;
+}
+
+int primesieve_parallel_count_primes_batch(const uint64_t* starts, const uint64_t* stops, uint64_t* counts, size_t size)
+{
+  try
+  {
+    std::vector<uint64_t> result;
+    primesieve::parallel_count_primes(std::vector<uint64_t>(starts, starts + size),
+                                      std::vector<uint64_t>(stops, stops + size), &result);
+    std::copy(result.begin(), result.end(), counts);
+    return 1;
+  }
+  catch (std::exception&)
+  {
+    errno = EDOM;
+  }
+  return 0;
+}
+
 //////////////////////////////////////////////////////////////////////
 //                      Print functions
 //////////////////////////////////////////////////////////////////////
@@ -569,6 +640,7 @@ void primesieve_parallel_callback_primes(uint64_t start, uint64_t stop, void (*c
     primesieve::ParallelPrimeSieve pps;
     pps.setSieveSize (primesieve::get_sieve_size());
     pps.setNumThreads(primesieve::get_num_threads());
+    pps.setNuma(primesieve::is_numa());
     // temporarily cast away extern "C" linkage
     pps.callbackPrimes_c(start, stop, reinterpret_cast<callback_tn_t>(callback));
   }
@@ -578,6 +650,19 @@ void primesieve_parallel_callback_primes(uint64_t start, uint64_t stop, void (*c
   }
 }
 
+void primesieve_parallel_callback_ranks(uint64_t start, uint64_t stop, void (*callback)(const uint64_t*, size_t, uint64_t))
+{
+  try
+  {
+    RankCallback_c cb(callback);
+    primesieve::parallel_callback_primes(start, stop, &cb);
+  }
+  catch (std::exception&)
+  {
+    errno = EDOM;
+  }
+}
+
 //////////////////////////////////////////////////////////////////////
 //                        Getters and Setters
 //////////////////////////////////////////////////////////////////////
@@ -592,11 +677,41 @@ int primesieve_get_num_threads()
   return primesieve::get_num_threads();
 }
 
+int primesieve_get_available_threads()
+{
+  return primesieve::get_available_threads();
+}
+
+int primesieve_is_numa()
+{
+  return primesieve::is_numa() ? 1 : 0;
+}
+
+int primesieve_is_huge_pages()
+{
+  return primesieve::is_huge_pages() ? 1 : 0;
+}
+
 uint64_t primesieve_get_max_stop()
 {
   return primesieve::get_max_stop();
 }
 
+int primesieve_get_cache_size()
+{
+  return primesieve::get_cache_size();
+}
+
+uint64_t primesieve_get_cache_hits()
+{
+  return primesieve::get_cache_hits();
+}
+
+uint64_t primesieve_get_cache_misses()
+{
+  return primesieve::get_cache_misses();
+}
+
 void primesieve_set_sieve_size(int sieve_size)
 {
   primesieve::set_sieve_size(sieve_size);
@@ -607,6 +722,40 @@ void primesieve_set_num_threads(int num_threads)
   primesieve::set_num_threads(num_threads);
 }
 
+void primesieve_set_numa(int enable)
+{
+  primesieve::set_numa(enable != 0);
+}
+
+void primesieve_set_huge_pages(int enable)
+{
+  primesieve::set_huge_pages(enable != 0);
+}
+
+void primesieve_set_allocator(void* (*allocate)(size_t), void (*deallocate)(void*))
+{
+  primesieve::set_allocator(allocate, deallocate);
+}
+
+void primesieve_set_cache_size(int size)
+{
+  primesieve::set_cache_size(size);
+}
+
+int primesieve_set_count_index(const char* filename)
+{
+  try
+  {
+    primesieve::set_count_index(filename);
+    return 1;
+  }
+  catch (std::exception&)
+  {
+    errno = EDOM;
+  }
+  return 0;
+}
+
 //////////////////////////////////////////////////////////////////////
 //                           Miscellaneous
 //////////////////////////////////////////////////////////////////////
@@ -15,12 +15,17 @@
 #include <primesieve/ParallelPrimeSieve.hpp>
 #include <primesieve/Callback.hpp>
 #include <primesieve/PrimeFinder.hpp>
+#include <primesieve/Allocator.hpp>
+#include <primesieve/pi_lmo.hpp>
+#include <primesieve/PiTable.hpp>
+#include <primesieve/CountIndex.hpp>
+#include <primesieve/ResultCache.hpp>
+#include <primesieve/SmallPrimeTable.hpp>
+#include <primesieve/batch.hpp>
 
 #include <stdint.h>
-
-#ifdef _OPENMP
-  #include <omp.h>
-#endif
+#include <cstddef>
+#include <algorithm>
 
 namespace
 {
@@ -29,6 +34,65 @@ int num_threads = primesieve::MAX_THREADS;
 
 /// Sieve size in kilobytes used for sieving
 int sieve_size = SIEVESIZE;
+
+/// Pin threads to NUMA nodes
+bool numa = false;
+
+using primesieve::PrimeSieve;
+using primesieve::ResultCache;
+
+/// Count using ps unless the result is in the result cache
+uint64_t cachedCount(PrimeSieve& ps,
+                     uint64_t (PrimeSieve::*count)(uint64_t, uint64_t),
+                     ResultCache::Query query,
+                     uint64_t start,
+                     uint64_t stop)
+{
+  uint64_t result;
+  if (!ResultCache::find(query, start, stop, &result))
+  {
+    result = (ps.*count)(start, stop);
+    ResultCache::insert(query, start, stop, result);
+  }
+  return result;
+}
+
+/// Count the primes within [start, stop] using the pi(x)
+/// checkpoint table, the Lagarias-Miller-Odlyzko algorithm
+/// or by sieving, whichever is the fastest.
+///
+uint64_t cachedCountPrimes(PrimeSieve& ps, int threads, uint64_t start, uint64_t stop)
+{
+  using namespace primesieve;
+  uint64_t result;
+  if (ResultCache::find(ResultCache::COUNT_PRIMES, start, stop, &result))
+    return result;
+
+  if (start <= stop && stop <= get_max_stop() && PiTable::isFaster(start, stop))
+    result = PiTable::countPrimes(start, stop, ps);
+  else if (start <= stop && stop <= get_max_stop() && isPiLmoFaster(start, stop))
+    result = pi_lmo(stop, threads) - ((start > 0) ? pi_lmo(start - 1, threads) : 0);
+  else
+    result = ps.countPrimes(start, stop);
+
+  ResultCache::insert(ResultCache::COUNT_PRIMES, start, stop, result);
+  return result;
+}
+
+/// Find the nth prime using ps unless the result
+/// is in the result cache.
+///
+uint64_t cachedNthPrime(PrimeSieve& ps, int64_t n, uint64_t start)
+{
+  uint64_t result;
+  if (!ResultCache::find(ResultCache::NTH_PRIME, n, start, &result))
+  {
+    result = ps.nthPrime(n, start);
+    ResultCache::insert(ResultCache::NTH_PRIME, n, start, result);
+  }
+  return result;
+}
+
 }
 
 namespace primesieve
@@ -40,17 +104,37 @@ namespace primesieve
 
 uint64_t nth_prime(int64_t n, uint64_t start)
 {
+  uint64_t prime = SmallPrimeTable::nthPrime(n, start);
+  if (prime != 0)
+    return prime;
   PrimeSieve ps;
   ps.setSieveSize(get_sieve_size());
-  return ps.nthPrime(n, start);
+  return cachedNthPrime(ps, n, start);
 }
 
 uint64_t parallel_nth_prime(int64_t n, uint64_t start)
 {
+  uint64_t prime = SmallPrimeTable::nthPrime(n, start);
+  if (prime != 0)
+    return prime;
   ParallelPrimeSieve pps;
   pps.setSieveSize(get_sieve_size());
   pps.setNumThreads(get_num_threads());
-  return pps.nthPrime(n, start);
+  pps.setNuma(is_numa());
+  return cachedNthPrime(pps, n, start);
+}
+
+void nth_primes(const std::vector<uint64_t>& n, std::vector<uint64_t>* primes)
+{
+  nthPrimesBatch(n, primes, 1, get_sieve_size(), false);
+}
+
+void parallel_nth_primes(const std::vector<uint64_t>& n, std::vector<uint64_t>* primes)
+{
+  ParallelPrimeSieve pps;
+  pps.setNumThreads(get_num_threads());
+  pps.setNuma(is_numa());
+  nthPrimesBatch(n, primes, pps.getNumThreads(), get_sieve_size(), pps.isNuma());
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -59,51 +143,53 @@ uint64_t parallel_nth_prime(int64_t n, uint64_t start)
 
 uint64_t count_primes(uint64_t start, uint64_t stop)
 {
+  if (stop <= SmallPrimeTable::LIMIT)
+    return SmallPrimeTable::countPrimes(start, stop);
   PrimeSieve ps;
   ps.setSieveSize(get_sieve_size());
-  return ps.countPrimes(start, stop);
+  return cachedCountPrimes(ps, 1, start, stop);
 }
 
 uint64_t count_twins(uint64_t start, uint64_t stop)
 {
   PrimeSieve ps;
   ps.setSieveSize(get_sieve_size());
-  return ps.countTwins(start, stop);
+  return cachedCount(ps, &PrimeSieve::countTwins, ResultCache::COUNT_TWINS, start, stop);
 }
 
 uint64_t count_triplets(uint64_t start, uint64_t stop)
 {
   PrimeSieve ps;
   ps.setSieveSize(get_sieve_size());
-  return ps.countTriplets(start, stop);
+  return cachedCount(ps, &PrimeSieve::countTriplets, ResultCache::COUNT_TRIPLETS, start, stop);
 }
 
 uint64_t count_quadruplets(uint64_t start, uint64_t stop)
 {
   PrimeSieve ps;
   ps.setSieveSize(get_sieve_size());
-  return ps.countQuadruplets(start, stop);
+  return cachedCount(ps, &PrimeSieve::countQuadruplets, ResultCache::COUNT_QUADRUPLETS, start, stop);
 }
 
 uint64_t count_quintuplets(uint64_t start, uint64_t stop)
 {
   PrimeSieve ps;
   ps.setSieveSize(get_sieve_size());
-  return ps.countQuintuplets(start, stop);
+  return cachedCount(ps, &PrimeSieve::countQuintuplets, ResultCache::COUNT_QUINTUPLETS, start, stop);
 }
 
 uint64_t count_sextuplets(uint64_t start, uint64_t stop)
 {
   PrimeSieve ps;
   ps.setSieveSize(get_sieve_size());
-  return ps.countSextuplets(start, stop);
+  return cachedCount(ps, &PrimeSieve::countSextuplets, ResultCache::COUNT_SEXTUPLETS, start, stop);
 }
 
 uint64_t count_septuplets(uint64_t start, uint64_t stop)
 {
   PrimeSieve ps;
   ps.setSieveSize(get_sieve_size());
-  return ps.countSeptuplets(start, stop);
+  return cachedCount(ps, &PrimeSieve::countSeptuplets, ResultCache::COUNT_SEPTUPLETS, start, stop);
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -112,10 +198,13 @@ uint64_t count_septuplets(uint64_t start, uint64_t stop)
 
 uint64_t parallel_count_primes(uint64_t start, uint64_t stop)
 {
+  if (stop <= SmallPrimeTable::LIMIT)
+    return SmallPrimeTable::countPrimes(start, stop);
   ParallelPrimeSieve pps;
   pps.setSieveSize(get_sieve_size());
   pps.setNumThreads(get_num_threads());
-  return pps.countPrimes(start, stop);
+  pps.setNuma(is_numa());
+  return cachedCountPrimes(pps, pps.getNumThreads(), start, stop);
 }
 
 uint64_t parallel_count_twins(uint64_t start, uint64_t stop)
@@ -123,7 +212,8 @@ uint64_t parallel_count_twins(uint64_t start, uint64_t stop)
   ParallelPrimeSieve pps;
   pps.setSieveSize(get_sieve_size());
   pps.setNumThreads(get_num_threads());
-  return pps.countTwins(start, stop);
+  pps.setNuma(is_numa());
+  return cachedCount(pps, &PrimeSieve::countTwins, ResultCache::COUNT_TWINS, start, stop);
 }
 
 uint64_t parallel_count_triplets(uint64_t start, uint64_t stop)
@@ -131,7 +221,8 @@ uint64_t parallel_count_triplets(uint64_t start, uint64_t stop)
   ParallelPrimeSieve pps;
   pps.setSieveSize(get_sieve_size());
   pps.setNumThreads(get_num_threads());
-  return pps.countTriplets(start, stop);
+  pps.setNuma(is_numa());
+  return cachedCount(pps, &PrimeSieve::countTriplets, ResultCache::COUNT_TRIPLETS, start, stop);
 }
 
 uint64_t parallel_count_quadruplets(uint64_t start, uint64_t stop)
@@ -139,7 +230,8 @@ uint64_t parallel_count_quadruplets(uint64_t start, uint64_t stop)
   ParallelPrimeSieve pps;
   pps.setSieveSize(get_sieve_size());
   pps.setNumThreads(get_num_threads());
-  return pps.countQuadruplets(start, stop);
+  pps.setNuma(is_numa());
+  return cachedCount(pps, &PrimeSieve::countQuadruplets, ResultCache::COUNT_QUADRUPLETS, start, stop);
 }
 
 uint64_t parallel_count_quintuplets(uint64_t start, uint64_t stop)
@@ -147,7 +239,8 @@ uint64_t parallel_count_quintuplets(uint64_t start, uint64_t stop)
   ParallelPrimeSieve pps;
   pps.setSieveSize(get_sieve_size());
   pps.setNumThreads(get_num_threads());
-  return pps.countQuintuplets(start, stop);
+  pps.setNuma(is_numa());
+  return cachedCount(pps, &PrimeSieve::countQuintuplets, ResultCache::COUNT_QUINTUPLETS, start, stop);
 }
 
 uint64_t parallel_count_sextuplets(uint64_t start, uint64_t stop)
@@ -155,7 +248,8 @@ uint64_t parallel_count_sextuplets(uint64_t start, uint64_t stop)
   ParallelPrimeSieve pps;
   pps.setSieveSize(get_sieve_size());
   pps.setNumThreads(get_num_threads());
-  return pps.countSextuplets(start, stop);
+  pps.setNuma(is_numa());
+  return cachedCount(pps, &PrimeSieve::countSextuplets, ResultCache::COUNT_SEXTUPLETS, start, stop);
 }
 
 uint64_t parallel_count_septuplets(uint64_t start, uint64_t stop)
@@ -163,7 +257,29 @@ uint64_t parallel_count_septuplets(uint64_t start, uint64_t stop)
   ParallelPrimeSieve pps;
   pps.setSieveSize(get_sieve_size());
   pps.setNumThreads(get_num_threads());
-  return pps.countSeptuplets(start, stop);
+  pps.setNuma(is_numa());
+  return cachedCount(pps, &PrimeSieve::countSeptuplets, ResultCache::COUNT_SEPTUPLETS, start, stop);
+}
+
+//////////////////////////////////////////////////////////////////////
+//                     Batch count functions
+//////////////////////////////////////////////////////////////////////
+
+void count_primes(const std::vector<uint64_t>& starts,
+                  const std::vector<uint64_t>& stops,
+                  std::vector<uint64_t>* counts)
+{
+  countPrimesBatch(starts, stops, counts, 1, get_sieve_size(), false);
+}
+
+void parallel_count_primes(const std::vector<uint64_t>& starts,
+                           const std::vector<uint64_t>& stops,
+                           std::vector<uint64_t>* counts)
+{
+  ParallelPrimeSieve pps;
+  pps.setNumThreads(get_num_threads());
+  pps.setNuma(is_numa());
+  countPrimesBatch(starts, stops, counts, pps.getNumThreads(), get_sieve_size(), pps.isNuma());
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -237,6 +353,13 @@ void callback_primes(uint64_t start, uint64_t stop, Callback<uint64_t>* callback
   ps.callbackPrimes(start, stop, callback);
 }
 
+void callback_primes(uint64_t start, uint64_t stop, SegmentCallback* callback)
+{
+  PrimeSieve ps;
+  ps.setSieveSize(get_sieve_size());
+  ps.callbackPrimes(start, stop, callback);
+}
+
 //////////////////////////////////////////////////////////////////////
 //                   Parallel callback functions
 //////////////////////////////////////////////////////////////////////
@@ -246,6 +369,7 @@ void parallel_callback_primes(uint64_t start, uint64_t stop, void (*callback)(ui
   ParallelPrimeSieve pps;
   pps.setSieveSize(get_sieve_size());
   pps.setNumThreads(get_num_threads());
+  pps.setNuma(is_numa());
   pps.callbackPrimes(start, stop, callback);
 }
 
@@ -254,6 +378,7 @@ void parallel_callback_primes(uint64_t start, uint64_t stop, void (*callback)(ui
   ParallelPrimeSieve pps;
   pps.setSieveSize(get_sieve_size());
   pps.setNumThreads(get_num_threads());
+  pps.setNuma(is_numa());
   pps.callbackPrimes(start, stop, callback);
 }
 
@@ -262,6 +387,7 @@ void parallel_callback_primes(uint64_t start, uint64_t stop, Callback<uint64_t>*
   ParallelPrimeSieve pps;
   pps.setSieveSize(get_sieve_size());
   pps.setNumThreads(get_num_threads());
+  pps.setNuma(is_numa());
   pps.callbackPrimes(start, stop, callback);
 }
 
@@ -270,9 +396,40 @@ void parallel_callback_primes(uint64_t start, uint64_t stop, Callback<uint64_t,
   ParallelPrimeSieve pps;
   pps.setSieveSize(get_sieve_size());
   pps.setNumThreads(get_num_threads());
+  pps.setNuma(is_numa());
+  pps.callbackPrimes(start, stop, callback);
+}
+
+void parallel_callback_primes(uint64_t start, uint64_t stop, SegmentCallback* callback)
+{
+  ParallelPrimeSieve pps;
+  pps.setSieveSize(get_sieve_size());
+  pps.setNumThreads(get_num_threads());
+  pps.setNuma(is_numa());
   pps.callbackPrimes(start, stop, callback);
 }
 
+void parallel_callback_primes(uint64_t start, uint64_t stop, RankCallback* callback)
+{
+  ParallelPrimeSieve pps;
+  pps.setSieveSize(get_sieve_size());
+  pps.setNumThreads(get_num_threads());
+  pps.setNuma(is_numa());
+  uint64_t rank = 0;
+  if (start > 0 && start <= stop)
+    rank = parallel_count_primes(0, start - 1);
+  pps.callbackPrimes(start, stop, rank, callback);
+}
+
+void parallel_store_primes(uint64_t start, uint64_t stop, PrimeSlices* slices)
+{
+  ParallelPrimeSieve pps;
+  pps.setSieveSize(get_sieve_size());
+  pps.setNumThreads(get_num_threads());
+  pps.setNuma(is_numa());
+  pps.storePrimes(start, stop, slices);
+}
+
 //////////////////////////////////////////////////////////////////////
 //                      Getters and Setters
 //////////////////////////////////////////////////////////////////////
@@ -292,6 +449,21 @@ int get_num_threads()
   return num_threads;
 }
 
+int get_available_threads()
+{
+  return ParallelPrimeSieve::getAvailableThreads();
+}
+
+bool is_numa()
+{
+  return numa;
+}
+
+bool is_huge_pages()
+{
+  return Allocator::isHugePages();
+}
+
 void set_sieve_size(int kilobytes)
 {
   sieve_size = getInBetween(1, kilobytes, 2048);
@@ -301,16 +473,51 @@ void set_num_threads(int threads)
 {
   if (threads != MAX_THREADS)
   {
-#ifdef _OPENMP
-    int max_threads = omp_get_max_threads();
+    int max_threads = ParallelPrimeSieve::getMaxThreads();
     threads = getInBetween(1, threads, max_threads);
-#else
-    // no multi-threading
-    threads = 1;
-#endif
   }
 
   num_threads = threads;
 }
 
+void set_numa(bool enable)
+{
+  numa = enable;
+}
+
+void set_huge_pages(bool enable)
+{
+  Allocator::setHugePages(enable);
+}
+
+void set_allocator(void* (*allocate)(std::size_t), void (*deallocate)(void*))
+{
+  Allocator::setFunctions(allocate, deallocate);
+}
+
+void set_count_index(const char* filename)
+{
+  CountIndex::open(filename);
+}
+
+void set_cache_size(int size)
+{
+  ResultCache::setSize(std::max(size, 0));
+}
+
+int get_cache_size()
+{
+  return static_cast<int>(ResultCache::getSize());
+}
+
+uint64_t get_cache_hits()
+{
+  return ResultCache::getHits();
+}
+
+uint64_t get_cache_misses()
+{
+  return ResultCache::getMisses();
+}
+
 } // end namespace
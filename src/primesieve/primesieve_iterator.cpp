@@ -10,6 +10,7 @@
 
 #include <primesieve/config.hpp>
 #include <primesieve/pmath.hpp>
+#include <primesieve/SmallPrimeTable.hpp>
 #include <primesieve.hpp>
 #include <primesieve.h>
 
@@ -112,7 +113,7 @@ void primesieve_generate_next_primes(primesieve_iterator* pi)
         pi->stop_ = add_overflow_safe(pi->start_, get_interval_size(pi->start_, pi->tiny_cache_size_));
         if (pi->start_ <= pi->stop_hint_ && pi->stop_ >= pi->stop_hint_)
           pi->stop_ = add_overflow_safe(pi->stop_hint_, max_prime_gap(pi->stop_hint_));
-        primesieve::generate_primes(pi->start_, pi->stop_, &primes);
+        SmallPrimeTable::storePrimes(pi->start_, pi->stop_, &primes);
         if (primes.empty() && pi->stop_ >= get_max_stop())
           throw primesieve_error("next_prime() > primesieve_get_max_stop()");
       }
@@ -147,7 +148,7 @@ void primesieve_generate_previous_primes(primesieve_iterator* pi)
         pi->start_ = subtract_underflow_safe(pi->stop_, get_interval_size(pi->stop_, pi->tiny_cache_size_));
         if (pi->start_ <= pi->stop_hint_ && pi->stop_ >= pi->stop_hint_)
           pi->start_ = subtract_underflow_safe(pi->stop_hint_, max_prime_gap(pi->stop_hint_));
-        primesieve::generate_primes(pi->start_, pi->stop_, &primes);
+        SmallPrimeTable::storePrimes(pi->start_, pi->stop_, &primes);
         if (primes.empty() && pi->start_ < 2)
           throw primesieve_error("previous_prime(): smallest prime is 2");
       }
@@ -10,15 +10,23 @@
 ///
 
 #include <primesieve.hpp>
+#include <primesieve/PrimeBitmap.hpp>
+#include <primesieve/SmallPrimeTable.hpp>
+#include <primesieve/PiTable.hpp>
+#include <primesieve/CountIndex.hpp>
+#include <primesieve/pmath.hpp>
 
 #include <iostream>
 #include <iomanip>
 #include <exception>
 #include <stdexcept>
 #include <algorithm>
+#include <cstdio>
 #include <cstdlib>
 #include <ctime>
 #include <stdint.h>
+#include <string>
+#include <vector>
 
 using namespace std;
 
@@ -67,6 +75,23 @@ uint64_t ipow(uint64_t x, int n)
   return result;
 }
 
+/// Get the path of name within the temporary directory
+string getTempFile(const char* name)
+{
+#if defined(_WIN32)
+  const char* dir = getenv("TEMP");
+  const char* separator = "\\";
+#else
+  const char* dir = getenv("TMPDIR");
+  const char* separator = "/";
+  if (!dir)
+    dir = "/tmp";
+#endif
+  if (!dir)
+    dir = ".";
+  return string(dir) + separator + name;
+}
+
 /// Get a random 64-bit integer < limit
 uint64_t getRand64(uint64_t limit)
 {
@@ -104,6 +129,331 @@ void testPix()
   cout << endl;
 }
 
+/// Count the primes up to 10^10 and within [10^12, 10^12+2^32]
+/// using count_primes() which uses the Lagarias-Miller-Odlyzko
+/// algorithm for large intervals.
+///
+void testPiLmo()
+{
+  cout << "pi(x) : Lagarias-Miller-Odlyzko test" << endl;
+
+  for (int i = 1; i <= 10; i++)
+  {
+    uint64_t primeCount = parallel_count_primes(0, ipow(10, i));
+    cout << "pi(10^" << i << (i < 10 ? ")  = " : ") = ") << setw(12) << primeCount;
+    check(primeCount == primeCounts[i - 1]);
+  }
+
+  uint64_t primeCount = count_primes(ipow(10, 12), ipow(10, 12) + ipow(2, 32));
+  cout << "pi[10^12, 10^12+2^32] = " << setw(11) << primeCount;
+  check(primeCount == primeCounts[10]);
+
+  // x^(1/3) of the largest x, (r + 1)^3 must not overflow
+  uint64_t r = 2642245;
+  cout << "icbrt(2^64 - 2^32 * 10) = " << setw(9) << icbrt(get_max_stop());
+  check(icbrt(get_max_stop()) == r &&
+        icbrt(r * r * r) == r &&
+        icbrt(r * r * r - 1) == r - 1 &&
+        icbrt(~UINT64_C(0)) == r);
+  cout << endl;
+}
+
+/// Get the expected result of SmallPrimeTable::nthPrime(n, start)
+/// from the sieved primes <= SmallPrimeTable::LIMIT.
+///
+uint64_t getNthPrime(const vector<uint64_t>& primes, int64_t n, uint64_t start)
+{
+  if (start > SmallPrimeTable::LIMIT || (start == 0 && n < 0))
+    return 0;
+  int64_t i = (n > 0) ? upper_bound(primes.begin(), primes.end(), start) - primes.begin() + n - 1
+                      : lower_bound(primes.begin(), primes.end(), start) - primes.begin() + n;
+  if (i < 0 || i >= static_cast<int64_t>(primes.size()))
+    return 0;
+  return primes[i];
+}
+
+/// Compare the embedded table of the primes <= 2^20 with
+/// the primes <= 2^20 generated by the sieve.
+///
+void testSmallPrimeTable()
+{
+  cout << "Small prime table test" << endl;
+  uint64_t limit = SmallPrimeTable::LIMIT;
+  vector<uint64_t> primes;
+  generate_primes(0, limit, &primes);
+  uint64_t size = primes.size();
+  bool isCorrect = (SmallPrimeTable::pi(limit) == size);
+
+  for (uint64_t x = 0, i = 0; x <= limit; x++)
+  {
+    if (i < size && primes[i] == x)
+      i++;
+    isCorrect = isCorrect && SmallPrimeTable::pi(x) == i;
+  }
+  cout << "pi(x) for x <= 2^20 = " << setw(10) << size;
+  check(isCorrect);
+
+  for (uint64_t n = 1; n <= size; n++)
+    isCorrect = isCorrect && SmallPrimeTable::nthPrime(n) == primes[n - 1];
+  vector<uint64_t> tablePrimes;
+  SmallPrimeTable::generatePrimes(0, limit, &tablePrimes);
+  cout << setw(32) << "nth prime and primes <= 2^20";
+  check(isCorrect && tablePrimes == primes);
+
+  // nth_prime(n, start) near 0 and near the LIMIT boundary
+  for (uint64_t start = 0; start <= 100; start++)
+    for (int64_t n = -30; n <= 30; n++)
+    {
+      isCorrect = isCorrect && SmallPrimeTable::nthPrime(n, start) == getNthPrime(primes, n, start);
+      isCorrect = isCorrect && SmallPrimeTable::nthPrime(n, limit - start) == getNthPrime(primes, n, limit - start);
+    }
+  for (uint64_t start = limit + 1; start <= limit + 10; start++)
+    for (int64_t n = -10; n <= 10; n++)
+      isCorrect = isCorrect && SmallPrimeTable::nthPrime(n, start) == 0;
+  int64_t maxN = static_cast<int64_t>(size);
+  for (int64_t n = maxN - 1; n <= maxN + 1; n++)
+  {
+    isCorrect = isCorrect && SmallPrimeTable::nthPrime(n, 0) == getNthPrime(primes, n, 0);
+    isCorrect = isCorrect && SmallPrimeTable::nthPrime(-n, limit) == getNthPrime(primes, -n, limit);
+  }
+  cout << setw(32) << "nth_prime(n, start) near 2^20";
+  check(isCorrect);
+  cout << endl;
+}
+
+/// Count the primes up to 10^12 and find the 37607912018th
+/// prime using the embedded pi(k * 2^32) checkpoints.
+///
+void testPiTable()
+{
+  cout << "pi(x) : Checkpoint table test" << endl;
+  uint64_t primeCount = count_primes(0, ipow(10, 12));
+  cout << "pi(10^12) = " << setw(15) << primeCount;
+  check(primeCount == 37607912018ull);
+  uint64_t nthPrime = parallel_nth_prime(primeCount);
+  cout << "nth_prime(" << primeCount << ") = " << setw(15) << nthPrime;
+  check(nthPrime == 999999999989ull);
+  cout << endl;
+}
+
+/// Sieve 3 random intervals ]k * 2^32, (k + 1) * 2^32], one
+/// from each third of the pi(x) table, and compare their prime
+/// counts with the embedded counts.
+///
+void testPiTableCounts()
+{
+  cout << "pi(x) : Checkpoint table counts test" << endl;
+  srand(static_cast<unsigned int>(time(0)));
+  ParallelPrimeSieve pps;
+  pps.setNumThreads(get_num_threads());
+  uint64_t size = PiTable::MAX_INDEX / 3;
+
+  for (int i = 0; i < 3; i++)
+  {
+    uint64_t k = size * i + getRand64(size);
+    uint64_t low = k << PiTable::LOG2_SPACING;
+    uint64_t high = (k + 1) << PiTable::LOG2_SPACING;
+    pps.sieve(low + 1, high);
+    cout << "pi]" << k << " * 2^32, " << k + 1 << " * 2^32] = " << setw(10) << pps.getPrimeCount();
+    check(pps.getPrimeCount() == PiTable::pi(high) - PiTable::pi(low));
+  }
+  cout << endl;
+}
+
+/// Sieve the primes up to 10^9 into a bitmap and
+/// check its pi(x), nth prime and next prime queries.
+///
+void testPrimeBitmap()
+{
+  cout << "Prime bitmap test" << endl;
+  PrimeBitmap bitmap(0, ipow(10, 9));
+
+  for (int i = 1; i <= 9; i++)
+  {
+    uint64_t primeCount = bitmap.countPrimes(ipow(10, i));
+    uint64_t prime = bitmap.nthPrime(primeCount);
+    uint64_t nextPrime = bitmap.nextPrime(prime + 1);
+    cout << "pi(10^" << i << ")  = " << setw(12) << primeCount;
+    check(primeCount == primeCounts[i - 1] &&
+          prime == bitmap.prevPrime(ipow(10, i)) &&
+          bitmap.isPrime(prime) &&
+          (nextPrime == 0 || bitmap.countPrimes(nextPrime) == primeCount + 1));
+  }
+  cout << endl;
+}
+
+/// Count the primes within [10^(i-1), 10^i] and find the
+/// pi(10^i)th prime for i = 1 to 9 using the batch functions.
+///
+void testBatch()
+{
+  cout << "Batch count and nth prime test" << endl;
+  vector<uint64_t> starts, stops, counts, n, primes;
+
+  for (int i = 1; i <= 9; i++)
+  {
+    starts.push_back((i > 1) ? ipow(10, i - 1) + 1 : 0);
+    stops.push_back(ipow(10, i));
+    n.push_back(primeCounts[i - 1]);
+  }
+
+  parallel_count_primes(starts, stops, &counts);
+  nth_primes(n, &primes);
+  uint64_t primeCount = 0;
+
+  for (int i = 1; i <= 9; i++)
+  {
+    primeCount += counts[i - 1];
+    cout << "pi(10^" << i << ")  = " << setw(12) << primeCount;
+    check(primeCount == primeCounts[i - 1] &&
+          count_primes(primes[i - 1], ipow(10, i)) == 1);
+  }
+  cout << endl;
+}
+
+/// Count the primes within [0, 10^9] per interval of 10^8
+void testHistogram()
+{
+  cout << "Histogram test" << endl;
+  ParallelPrimeSieve pps;
+  pps.setNumThreads(get_num_threads());
+  pps.setHistogramStep(ipow(10, 8));
+  pps.sieve(0, ipow(10, 9));
+  const vector<uint64_t>& histogram = pps.getHistogram(0);
+  uint64_t primeCount = 0;
+  for (size_t i = 0; i < histogram.size(); i++)
+    primeCount += histogram[i];
+
+  cout << "pi(10^8)  = " << setw(12) << histogram[0];
+  check(histogram[0] == primeCounts[7]);
+  cout << "pi(10^9)  = " << setw(12) << primeCount;
+  check(primeCount == primeCounts[8] && primeCount == pps.getPrimeCount());
+  cout << endl;
+}
+
+/// Count the primes and twin primes with and without the count
+/// index, the first run fills the index
+///
+void testCountIndex()
+{
+  cout << "Count index test" << endl;
+  if (!CountIndex::isSupported())
+  {
+    cout << "Memory-mapped files are not supported" << endl << endl;
+    return;
+  }
+
+  // a failure to create the index is a test error
+  string filename = getTempFile("primesieve_test.cidx");
+  remove(filename.c_str());
+  set_count_index(filename.c_str());
+
+  PrimeSieve ps;
+  ps.setFlags(ps.COUNT_PRIMES | ps.COUNT_TWINS);
+  ps.sieve(0, ipow(10, 9));
+  uint64_t primeCount = ps.getPrimeCount();
+  uint64_t start = ipow(10, 7) + 12345;
+  uint64_t stop = ipow(10, 9) - 6789;
+  ps.sieve(start, stop);
+  uint64_t indexed[2] = { ps.getPrimeCount(), ps.getTwinCount() };
+
+  set_count_index(NULL);
+  remove(filename.c_str());
+  ps.sieve(start, stop);
+  cout << "pi(10^9)  = " << setw(12) << primeCount;
+  check(primeCount == primeCounts[8] &&
+        indexed[0] == ps.getPrimeCount() &&
+        indexed[1] == ps.getTwinCount());
+  cout << endl;
+}
+
+/// Repeated count calls must be answered from the result
+/// cache, set_cache_size(0) must disable it
+void testResultCache()
+{
+  cout << "Result cache test" << endl;
+  int size = get_cache_size();
+  set_cache_size(16);
+  if (get_cache_size() == 0)
+  {
+    cout << "The result cache requires OpenMP" << endl << endl;
+    return;
+  }
+
+  uint64_t start = ipow(10, 9) + 4321;
+  uint64_t stop = start + ipow(10, 7);
+  uint64_t hits = get_cache_hits();
+  uint64_t misses = get_cache_misses();
+  uint64_t count1 = count_twins(start, stop);
+  uint64_t count2 = parallel_count_twins(start, stop);
+  bool cached = (get_cache_misses() == misses + 1 &&
+                 get_cache_hits() == hits + 1);
+
+  set_cache_size(0);
+  hits = get_cache_hits();
+  misses = get_cache_misses();
+  uint64_t count3 = count_twins(start, stop);
+  bool disabled = (get_cache_size() == 0 &&
+                   get_cache_hits() == hits &&
+                   get_cache_misses() == misses);
+
+  set_cache_size(size);
+  cout << "Twin count  = " << setw(10) << count1;
+  check(cached && disabled && count1 == count2 && count1 == count3);
+  cout << endl;
+}
+
+/// Store the primes <= 10^8 using multiple threads
+void testParallelGeneratePrimes()
+{
+  cout << "Parallel generate primes test" << endl;
+  vector<uint32_t> primes;
+  vector<uint32_t> parallelPrimes;
+  generate_primes(ipow(10, 8), &primes);
+  parallel_generate_primes(ipow(10, 8), &parallelPrimes);
+  cout << "pi(10^8)  = " << setw(12) << parallelPrimes.size();
+  check(parallelPrimes.size() == primeCounts[7] && parallelPrimes == primes);
+  cout << endl;
+}
+
+/// Checks that the ranks of the primes are contiguous
+class CheckRanks : public RankCallback
+{
+public:
+  CheckRanks() : primeCount(0), minRank(~UINT64_C(0)), maxRank(0), firstPrime(0) { }
+  void callback(const uint64_t* primes, size_t size, uint64_t rank)
+  {
+    #pragma omp critical (primesieve_test)
+    {
+      primeCount += size;
+      if (rank < minRank)
+      {
+        minRank = rank;
+        firstPrime = primes[0];
+      }
+      maxRank = max(maxRank, rank + size - 1);
+    }
+  }
+  uint64_t primeCount;
+  uint64_t minRank;
+  uint64_t maxRank;
+  uint64_t firstPrime;
+};
+
+/// Call back the primes within [10^7, 10^8] with their ranks
+void testParallelRanks()
+{
+  cout << "Parallel prime ranks test" << endl;
+  CheckRanks ranks;
+  parallel_callback_primes(ipow(10, 7), ipow(10, 8), &ranks);
+  cout << "pi(10^8)  = " << setw(12) << ranks.maxRank;
+  check(ranks.minRank == primeCounts[6] + 1 &&
+        ranks.maxRank == primeCounts[7] &&
+        ranks.primeCount == primeCounts[7] - primeCounts[6] &&
+        ranks.firstPrime == nth_prime(primeCounts[6] + 1));
+  cout << endl;
+}
+
 /// Count the primes within [10^i, 10^i+2^32] for i = 12 to 19
 void testBigPrimes()
 {
@@ -169,6 +519,17 @@ bool test()
   {
     cout << left;
     testPix();
+    testSmallPrimeTable();
+    testPiLmo();
+    testPiTable();
+    testPiTableCounts();
+    testPrimeBitmap();
+    testBatch();
+    testHistogram();
+    testCountIndex();
+    testResultCache();
+    testParallelGeneratePrimes();
+    testParallelRanks();
     testBigPrimes();
     testRandomIntervals();
   }